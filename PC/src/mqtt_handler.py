@@ -132,6 +132,7 @@ class MQTTHandler:
             self.client.subscribe("esp32/sound/setpoint")
             self.client.subscribe("esp32/sound/response")
             self.client.subscribe("esp32/sound/get_state")
+            self.client.subscribe("esp32/latency/probe")
             
             # Update UI status (handled in the main thread via queue)
             if self.app and hasattr(self.app, 'sound_tab'):
@@ -178,6 +179,13 @@ class MQTTHandler:
         
         # Detect if message is from ourselves
         is_self_message = f"sender={self.client_id}" in payload
+
+        # Echo latency probes straight from the network thread so the UI queue adds no delay
+        if topic == "esp32/latency/probe":
+            if not is_self_message:
+                probe = payload.split(",")[-1].strip()
+                self.client.publish("esp32/latency/echo", f"sender={self.client_id},{probe}", qos=0)
+            return
         
         # Add received message to queue
         self.message_queue.put(("mqtt_received", f"Received [{topic}]: {payload}", is_self_message))
@@ -0,0 +1,96 @@
+import socket
+import threading
+import time
+
+
+class UDPSetpointListener:
+    """Receives setpoint datagrams streamed by the device over the LAN"""
+
+    DEVICE_UDP_PORT = 4210      # Port the device listens on for pings
+    PING_INTERVAL = 2.0         # Must be well below the device's 5 s peer timeout
+
+    def __init__(self, setpoint_callback=None, local_port=4211):
+        self.setpoint_callback = setpoint_callback
+        self.local_port = local_port
+        self.device_ip = None
+        self.sock = None
+        self.running = False
+        self.last_sequence = 0
+        self.lost_datagrams = 0
+
+    def register(self, tcp_socket, device_ip):
+        """Open the local UDP port and register it with the device over TCP"""
+        self.device_ip = device_ip
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.sock.bind(("", self.local_port))
+        self.sock.settimeout(0.5)
+
+        tcp_socket.sendall(f"udpRegister:{self.local_port}\n".encode("utf-8"))
+
+        self.running = True
+        threading.Thread(target=self._receive_loop, daemon=True).start()
+        threading.Thread(target=self._ping_loop, daemon=True).start()
+
+    def stop(self):
+        """Stop listening; the device stops streaming after its peer timeout"""
+        self.running = False
+        if self.sock:
+            self.sock.close()
+            self.sock = None
+
+    def _ping_loop(self):
+        while self.running:
+            try:
+                self.sock.sendto(b"ping", (self.device_ip, self.DEVICE_UDP_PORT))
+            except OSError:
+                break
+            time.sleep(self.PING_INTERVAL)
+
+    def _receive_loop(self):
+        while self.running:
+            try:
+                data, _ = self.sock.recvfrom(64)
+            except socket.timeout:
+                continue
+            except OSError:
+                break
+
+            message = data.decode("utf-8", errors="ignore")
+            if not message.startswith("sp:"):
+                continue
+
+            try:
+                _, seq_str, value_str = message.split(":")
+                sequence = int(seq_str)
+                value = int(value_str)
+            except ValueError:
+                continue
+
+            # Values are absolute, so stale (reordered) datagrams are simply ignored
+            if sequence <= self.last_sequence:
+                continue
+            if self.last_sequence and sequence > self.last_sequence + 1:
+                self.lost_datagrams += sequence - self.last_sequence - 1
+            self.last_sequence = sequence
+
+            if self.setpoint_callback:
+                self.setpoint_callback(value)
+
+
+if __name__ == "__main__":
+    # Minimal local peer for testing: python udp_setpoint_listener.py <device_ip>
+    import sys
+
+    device_ip = sys.argv[1] if len(sys.argv) > 1 else "192.168.4.1"
+    tcp = socket.create_connection((device_ip, 23), timeout=3.0)
+    listener = UDPSetpointListener(lambda value: print(f"{time.monotonic():.3f} setpoint {value}"))
+    listener.register(tcp, device_ip)
+    print(f"Registered with {device_ip}, turn the knob (Ctrl+C to quit)")
+
+    try:
+        while True:
+            time.sleep(1.0)
+    except KeyboardInterrupt:
+        print(f"Lost datagrams: {listener.lost_datagrams}")
+        listener.stop()
+        tcp.close()
@@ -2,6 +2,8 @@
 #define ANIMATION_HELPER_H
 
 #include <Arduino_GFX_Library.h>
+#include "PowerManager.h"
+#include "EventTrace.h"
 
 class AnimationHelper {
 public:
@@ -19,6 +21,10 @@ public:
 
   // Static method to perform screen transitions
   static void performTransition(Arduino_GFX* gfx, TransitionType type, uint16_t duration = 300) {
+    // Full-screen animation - run it at max CPU frequency
+    CpuBoost boost;
+    TRACE_SPAN(TRACE_SCREEN_TRANSITION);
+
     int width = gfx->width();
     int height = gfx->height();
 
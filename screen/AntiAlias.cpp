@@ -0,0 +1,164 @@
+#include "AntiAlias.h"
+
+// Edge of a disc of radius r: pixels within r are fully covered, coverage
+// then falls off to none at r + 1 (the aliased edge sits halfway, at r + 0.5)
+struct EdgeTable {
+  bool used;
+  int16_t radius;
+  uint16_t lastUse;                        // For evicting the least recently used
+  uint8_t coverage[2 * AA_MAX_RADIUS + 1]; // By squared distance - r² - 1, inside ((r)², (r + 1)²)
+  uint8_t full[AA_MAX_RADIUS + 1];         // By row: last column fully covered
+  uint8_t extent[AA_MAX_RADIUS + 1];       // By row: last column covered at all
+};
+
+static EdgeTable edgeTables[AA_TABLE_SLOTS];
+static uint16_t edgeTableUses = 0;
+
+static const EdgeTable& edgeTable(int radius) {
+  EdgeTable* table = &edgeTables[0];
+  for (int i = 0; i < AA_TABLE_SLOTS; i++) {
+    if (edgeTables[i].used && edgeTables[i].radius == radius) {
+      edgeTables[i].lastUse = ++edgeTableUses;
+      return edgeTables[i];
+    }
+    if (!edgeTables[i].used || (table->used && edgeTables[i].lastUse < table->lastUse)) {
+      table = &edgeTables[i];
+    }
+  }
+
+  // Built once per radius - the only square roots
+  long radius2 = (long)radius * radius;
+  for (int k = 0; k <= 2 * radius; k++) {
+    float distance = sqrtf(radius2 + 1 + k);
+    int alpha = (int)((radius + 1 - distance) * AA_LEVELS + 0.5f);
+    table->coverage[k] = constrain(alpha, 0, AA_LEVELS);
+  }
+  long outside2 = (long)(radius + 1) * (radius + 1);
+  int full = radius;
+  int extent = radius;
+  for (int y = 0; y <= radius; y++) {
+    long y2 = (long)y * y;
+    while (full * full + y2 > radius2) full--;
+    while (extent * extent + y2 >= outside2) extent--;
+    table->full[y] = full;
+    table->extent[y] = extent;
+  }
+
+  table->used = true;
+  table->radius = radius;
+  table->lastUse = ++edgeTableUses;
+  return *table;
+}
+
+uint16_t AntiAlias::blend(uint16_t color, uint16_t background, uint8_t alpha) {
+  // Spread to 0000 0GGG GGG0 0000 RRRR R000 000B BBBB so all three channels
+  // blend in one multiply, then fold back
+  uint32_t fg = (color | ((uint32_t)color << 16)) & 0x07E0F81F;
+  uint32_t bg = (background | ((uint32_t)background << 16)) & 0x07E0F81F;
+  uint32_t mixed = (bg + (((fg - bg) * alpha) >> 5)) & 0x07E0F81F;
+  return (uint16_t)(mixed | (mixed >> 16));
+}
+
+void AntiAlias::fillCircle(Arduino_GFX* gfx, int centerX, int centerY, int radius, uint16_t color, uint16_t background) {
+  fillArc(gfx, centerX, centerY, radius, 0, 0, 360, color, background);
+}
+
+void AntiAlias::fillArc(Arduino_GFX* gfx, int centerX, int centerY, int outerRadius, int innerRadius,
+                        float start, float end, uint16_t color, uint16_t background) {
+  if (outerRadius > AA_MAX_RADIUS) {
+    gfx->fillArc(centerX, centerY, outerRadius, innerRadius, start, end, color);
+    return;
+  }
+  if (outerRadius < 0 || innerRadius > outerRadius) {
+    return;
+  }
+
+  // Same wrap as fillArc: end before start goes round through 0, equal is a full ring
+  float sweep = end - start;
+  if (sweep <= 0) sweep += 360;
+  bool full = sweep >= 360;
+  bool reflex = sweep > 180;
+  float startX = cosf(start * DEG_TO_RAD), startY = sinf(start * DEG_TO_RAD);
+  float endX = cosf(end * DEG_TO_RAD), endY = sinf(end * DEG_TO_RAD);
+
+  // In the segment: at or after the start edge and before the end edge. The
+  // edge directions are fixed point so the test is exact - a segment ending
+  // at an angle and the next one starting there split its pixels, leaving none
+  int32_t startDX = lroundf(startX * 4096), startDY = lroundf(startY * 4096);
+  int32_t endDX = lroundf(endX * 4096), endDY = lroundf(endY * 4096);
+  auto inside = [&](int32_t x, int32_t y) {
+    if (full) return true;
+    bool afterStart = startDX * y - startDY * x >= 0;
+    bool beforeEnd = endDY * x - endDX * y > 0;
+    return reflex ? (afterStart || beforeEnd) : (afterStart && beforeEnd);
+  };
+
+  // Bounding box of the segment: its corners and any extreme point of the ring it passes
+  int left = -outerRadius, right = outerRadius, top = -outerRadius, bottom = outerRadius;
+  if (!full) {
+    float minX = min(startX * innerRadius, startX * outerRadius), maxX = max(startX * innerRadius, startX * outerRadius);
+    float minY = min(startY * innerRadius, startY * outerRadius), maxY = max(startY * innerRadius, startY * outerRadius);
+    minX = min(minX, min(endX * innerRadius, endX * outerRadius));
+    maxX = max(maxX, max(endX * innerRadius, endX * outerRadius));
+    minY = min(minY, min(endY * innerRadius, endY * outerRadius));
+    maxY = max(maxY, max(endY * innerRadius, endY * outerRadius));
+    if (inside(1, 0)) maxX = outerRadius;
+    if (inside(-1, 0)) minX = -outerRadius;
+    if (inside(0, 1)) maxY = outerRadius;
+    if (inside(0, -1)) minY = -outerRadius;
+    left = max(left, (int)floorf(minX) - 1);
+    right = min(right, (int)ceilf(maxX) + 1);
+    top = max(top, (int)floorf(minY) - 1);
+    bottom = min(bottom, (int)ceilf(maxY) + 1);
+  }
+
+  const EdgeTable& outer = edgeTable(outerRadius);
+  long outer2 = (long)outerRadius * outerRadius;
+
+  // The hole is a disc of innerRadius - 1, so the inner edge also lands halfway
+  int holeRadius = innerRadius - 1;
+  const EdgeTable* hole = holeRadius >= 0 ? &edgeTable(holeRadius) : nullptr;
+  long hole2 = (long)holeRadius * holeRadius;
+  long holeEdge2 = (long)(holeRadius + 1) * (holeRadius + 1);
+
+  gfx->startWrite();
+  for (int y = top; y <= bottom; y++) {
+    int row = abs(y);
+    int first = max(left, -(int)outer.extent[row]);
+    int last = min(right, (int)outer.extent[row]);
+    int holeFull = (hole && row <= holeRadius) ? hole->full[row] : -1;
+    long y2 = (long)y * y;
+    int runStart = 0, runLength = 0;
+
+    for (int x = first; x <= last; x++) {
+      uint8_t alpha = 0;
+      if (abs(x) <= holeFull) {
+        x = holeFull;  // Skip the hole
+      } else if (inside(x, y)) {
+        long distance2 = (long)x * x + y2;
+        alpha = distance2 > outer2 ? outer.coverage[distance2 - outer2 - 1] : AA_LEVELS;
+        if (hole && distance2 > hole2 && distance2 < holeEdge2) {
+          alpha = alpha * (AA_LEVELS - hole->coverage[distance2 - hole2 - 1]) / AA_LEVELS;
+        }
+      }
+
+      // Full coverage extends the run, edge pixels are blended one by one
+      if (alpha == AA_LEVELS) {
+        if (runLength == 0) runStart = x;
+        runLength++;
+        continue;
+      }
+      if (runLength > 0) {
+        gfx->writeFastHLine(centerX + runStart, centerY + y, runLength, color);
+        runLength = 0;
+      }
+      if (alpha > 0) {
+        gfx->writePixel(centerX + x, centerY + y, blend(color, background, alpha));
+      }
+    }
+    if (runLength > 0) {
+      gfx->writeFastHLine(centerX + runStart, centerY + y, runLength, color);
+    }
+  }
+  gfx->endWrite();
+}
@@ -0,0 +1,38 @@
+#ifndef ANTI_ALIAS_H
+#define ANTI_ALIAS_H
+
+#include <Arduino_GFX_Library.h>
+
+#define AA_MAX_RADIUS 127       // Largest circle edge with a coverage table
+#define AA_TABLE_SLOTS 8        // Radii kept at once (each slot ~3 bytes per pixel of radius)
+#define AA_LEVELS 32            // Coverage steps, 0 = background and 32 = full color
+
+/**
+ * Anti-aliased ring segments and discs.
+ *
+ * The round edges are smoothed: a pixel on an edge gets the color blended with
+ * the background by how much of it the shape covers. That coverage depends
+ * only on the pixel's squared distance from the centre, which the scanline
+ * walk computes anyway, so it is looked up in a per-radius table built once
+ * (the only square roots) - edge pixels cost a table read and a blend, the
+ * rest are the same horizontal runs the aliased fillArc emits.
+ *
+ * The straight ends of a segment stay hard, so segments drawn side by side
+ * (an arc growing a few degrees per frame) meet without a seam. Angles are
+ * in degrees, clockwise from 3 o'clock, as for Arduino_GFX::fillArc.
+ *
+ * There is no framebuffer to read back, so edges blend against the given
+ * background color - the color the shape is drawn over.
+ */
+class AntiAlias {
+public:
+  // Ring between innerRadius and outerRadius (0 = a pie slice), from start to end
+  static void fillArc(Arduino_GFX* gfx, int centerX, int centerY, int outerRadius, int innerRadius,
+                      float start, float end, uint16_t color, uint16_t background);
+  static void fillCircle(Arduino_GFX* gfx, int centerX, int centerY, int radius, uint16_t color, uint16_t background);
+
+  // color over background; alpha from 0 to AA_LEVELS
+  static uint16_t blend(uint16_t color, uint16_t background, uint8_t alpha);
+};
+
+#endif // ANTI_ALIAS_H
@@ -1,7 +1,8 @@
 #include "Arc.h"
+#include "AntiAlias.h"
 
 Arc::Arc(Arduino_GFX* graphics)
-  : gfx(graphics), centerX(0), centerY(0), radius(0), arcWidth(0),
+  : Widget(graphics), centerX(0), centerY(0), radius(0), arcWidth(0),
     maxArcLength(0), startAngle(0), currentPercentage(0), previousPercentage(0),
     targetPercentage(0), animationSpeed(5), arcColor(WHITE), backgroundColor(BLACK),
     segmentVisible(true), currentSegmentPercentage(100),
@@ -32,8 +33,11 @@ void Arc::initialize(int cx, int cy, int rad, int width, int length, int start)
   animationEndPoint = 100;
   arcAnimationStartTime = 0;
 
-  // Draw the full segment (background arc/slot)
-  drawFullSegment();
+  // The clear margin of clearFullSegment() belongs to the arc too
+  int outerRadius = radius + arcWidth / 2 + 2;
+  setBounds(centerX - outerRadius, centerY - outerRadius, outerRadius * 2 + 1, outerRadius * 2 + 1);
+  setHole(centerX, centerY, radius - arcWidth / 2 - 2);
+  invalidate();
 }
 
 void Arc::update() {
@@ -63,44 +67,64 @@ void Arc::update() {
     currentPercentage = arcAnimationStartPoint + (targetPercentage - arcAnimationStartPoint) * progress;
     
     // Draw the updated arc
-    draw();
+    drawProgress();
     
     // Check if animation is complete
     if (progress >= 1.0f) {
       currentPercentage = targetPercentage;
       arcAnimationStartTime = 0; // Reset animation start time
     }
+  } else if (pendingInputStamp != 0) {
+    // Input that cancelled out before anything moved - nothing will be drawn for it
+    pendingInputStamp = 0;
+  }
+}
+
+void Arc::draw(const WidgetRect& clip) {
+  // The segment animation repaints its own frames - just restore the slot it has grown
+  if (segmentAnimationActive) {
+    drawSegment(0, currentSegmentPercentage);
+    return;
+  }
+
+  // Full repaint: the slot, then the filled part
+  drawFullSegment();
+  if (currentPercentage > 0) {
+    AntiAlias::fillArc(gfx, centerX, centerY, radius + arcWidth/2, radius - arcWidth/2,
+                startAngle, startAngle + constrain((maxArcLength * currentPercentage) / 100.0f, 0.0f, maxArcLength - 0.5f), arcColor, backgroundColor);
   }
+  previousPercentage = currentPercentage;
 }
 
-void Arc::draw() {
+void Arc::drawProgress() {
   // Only redraw if percentage has changed
   if (currentPercentage != previousPercentage) {
     // Calculate current and previous arc sweep angles, ensuring we don't exceed maxArcLength
     float currentArcLength = constrain((maxArcLength * currentPercentage) / 100.0f, 0.0f, maxArcLength - 0.5f);
     float previousArcLength = constrain((maxArcLength * previousPercentage) / 100.0f, 0.0f, maxArcLength - 0.5f);
     
-    // Calculate arc end points
-    float currentEndAngle = startAngle + currentArcLength;
-    float previousEndAngle = startAngle + previousArcLength;
-    
     if (currentPercentage > previousPercentage) {
       // Growing the arc - draw only the new part
       if (startAngle + previousArcLength != startAngle + currentArcLength) {
-        gfx->fillArc(centerX, centerY, radius + arcWidth/2, radius - arcWidth/2,
-                    startAngle + previousArcLength, startAngle + currentArcLength, arcColor);
+        AntiAlias::fillArc(gfx, centerX, centerY, radius + arcWidth/2, radius - arcWidth/2,
+                    startAngle + previousArcLength, startAngle + currentArcLength, arcColor, backgroundColor);
       }
     } 
     else if (currentPercentage < previousPercentage) {
       // Shrinking the arc - erase only the part that should be hidden
       if (startAngle + currentArcLength != startAngle + previousArcLength) {
-        gfx->fillArc(centerX, centerY, radius + arcWidth/2, radius - arcWidth/2,
-                    startAngle + currentArcLength, startAngle + previousArcLength, segmentColor);
+        AntiAlias::fillArc(gfx, centerX, centerY, radius + arcWidth/2, radius - arcWidth/2,
+                    startAngle + currentArcLength, startAngle + previousArcLength, segmentColor, backgroundColor);
       }
     }
     
     // Update previous percentage
     previousPercentage = currentPercentage;
+
+    if (pendingInputStamp != 0) {
+      LatencyTracer::getInstance()->record(LATENCY_KNOB_TO_PIXEL, pendingInputStamp);
+      pendingInputStamp = 0;
+    }
   }
 }
 
@@ -116,8 +140,8 @@ void Arc::drawSegment(int startPercent, int endPercent) {
   // Only draw if there's actually an arc to draw
   if (startDeg < endDeg) {
     // Draw the segment with the same dimensions as the arc
-    gfx->fillArc(centerX, centerY, radius + arcWidth/2, radius - arcWidth/2,
-                startDeg, endDeg, segmentColor);
+    AntiAlias::fillArc(gfx, centerX, centerY, radius + arcWidth/2, radius - arcWidth/2,
+                startDeg, endDeg, segmentColor, backgroundColor);
   }
 }
 
@@ -154,8 +178,8 @@ void Arc::clearFullSegment() {
 
 void Arc::clearArc() {
   // Clear the arc area (not segment walls) and draw segment color
-  gfx->fillArc(centerX, centerY, radius + arcWidth/2, radius - arcWidth/2,
-               startAngle, startAngle + maxArcLength, segmentColor);
+  AntiAlias::fillArc(gfx, centerX, centerY, radius + arcWidth/2, radius - arcWidth/2,
+               startAngle, startAngle + maxArcLength, segmentColor, backgroundColor);
 }
 
 void Arc::setColor(uint16_t color) {
@@ -166,12 +190,12 @@ void Arc::setColor(uint16_t color) {
   // If we have a visible arc, redraw it with the new color
   if (currentPercentage > 0) {
     // Redraw the arc with the new color
-    gfx->fillArc(centerX, centerY, radius + arcWidth/2, radius - arcWidth/2,
-                startAngle, startAngle + constrain((maxArcLength * currentPercentage) / 100.0f, 0.0f, maxArcLength - 0.5f), arcColor);
+    AntiAlias::fillArc(gfx, centerX, centerY, radius + arcWidth/2, radius - arcWidth/2,
+                startAngle, startAngle + constrain((maxArcLength * currentPercentage) / 100.0f, 0.0f, maxArcLength - 0.5f), arcColor, backgroundColor);
   }
 }
 
-void Arc::setPercentage(int percentage) {
+void Arc::setPercentage(int percentage, LatencyStamp inputStamp) {
   // Clamp percentage to 0-100 range
   if (percentage < 0) percentage = 0;
   if (percentage > 100) percentage = 100;
@@ -183,6 +207,10 @@ void Arc::setPercentage(int percentage) {
       targetPercentage = percentage;
       // Reset animation start time to trigger animation in update()
       arcAnimationStartTime = 0;
+      // Keep the oldest stamp - detents coalesced into one animation wait for its first frame
+      if (pendingInputStamp == 0) {
+        pendingInputStamp = inputStamp;
+      }
     }
   } else {
     // Save the setpoint for later use when animation stops
@@ -196,6 +224,7 @@ void Arc::reset() {
   previousPercentage = 0;
   targetPercentage = 0;
   arcAnimationStartTime = 0;
+  pendingInputStamp = 0;
 
   // Clear everything
   clearFullSegment();
@@ -352,8 +381,8 @@ void Arc::updateAnimationStep() {
           float previousArcLength = constrain((maxArcLength * previousPercentage) / 100.0f, 0.0f, maxArcLength - 0.5f);
           
           if (startAngle + previousArcLength != startAngle + currentArcLength) {
-            gfx->fillArc(centerX, centerY, radius + arcWidth/2, radius - arcWidth/2,
-                        startAngle + previousArcLength, startAngle + currentArcLength, arcColor);
+            AntiAlias::fillArc(gfx, centerX, centerY, radius + arcWidth/2, radius - arcWidth/2,
+                        startAngle + previousArcLength, startAngle + currentArcLength, arcColor, backgroundColor);
           }
         }
       } else {
@@ -2,6 +2,8 @@
 #define ARC_H
 
 #include <Arduino_GFX_Library.h>
+#include "LatencyTracer.h"
+#include "Widget.h"
 
 enum class AnimationStep {
   NONE,
@@ -14,9 +16,10 @@ enum class AnimationStep {
   GROW_ARC_TO_SETPOINT
 };
 
-class Arc {
+// Arc gauge widget - animates itself and draws only what changed between frames,
+// with anti-aliased round edges
+class Arc : public Widget {
 private:
-  Arduino_GFX* gfx;
   int centerX, centerY;      // Center position
   int radius;                // Radius of the arc
   int arcWidth;              // Width of the arc
@@ -49,10 +52,13 @@ private:
   int arcAnimationStartPoint;           // Starting percentage for animation
   unsigned long stepStartTime = 0;      // Start time for animation step
 
+  // Oldest traced input whose change has not reached the panel yet (0 = none)
+  LatencyStamp pendingInputStamp = 0;
+
 public:
   Arc(Arduino_GFX* graphics);
 
-  // Initialize arc properties
+  // Initialize arc properties; the arc is drawn on the next render
   void initialize(int centerX, int centerY, int radius, int arcWidth, int maxArcLength, int startAngle = 120);
 
   // Update arc animation
@@ -61,8 +67,12 @@ public:
   // Update arc animation
   void updateAnimationStep();
 
-  // Draw the arc
-  void draw();
+  // Draw the part of the arc that changed since the last frame
+  void drawProgress();
+
+  // Widget: step the animation every frame, repaint the whole arc when asked
+  void animate() override { update(); }
+  void draw(const WidgetRect& clip) override;
   
   // Draw a rounded end cap for the arc
   void drawRoundedEndCap(int percentPosition, uint16_t color);
@@ -94,8 +104,8 @@ public:
   // Set the arc color
   void setColor(uint16_t color);
 
-  // Set the arc percentage (0-100)
-  void setPercentage(int percentage);
+  // Set the arc percentage (0-100); a traced input is recorded when its first pixels are drawn
+  void setPercentage(int percentage, LatencyStamp inputStamp = 0);
 
   // Reset the arc and segment
   void reset();
@@ -4,230 +4,169 @@
 // Base Button Class Implementation
 //////////////////////////////////////////////////
 
-Button::Button(Arduino_GFX* graphics, TouchPanel* touch)
-  : gfx(graphics), touchPanel(touch), isPressed(false), wasPressed(false),
-    isVisible(true), normalColor(WHITE), pressedColor(RED) {}
+Button::Button(Arduino_GFX* graphics)
+  : Widget(graphics), isPressed(false), normalColor(WHITE), pressedColor(RED),
+    touchGrid(nullptr), touchTarget(-1), releaseHandler(nullptr), releaseContext(nullptr) {}
 
 void Button::initialize(int centerX, int centerY, int buttonWidth, int buttonHeight) {
   x = centerX;
   y = centerY;
   width = buttonWidth;
   height = buttonHeight;
-}
-
-void Button::update() {
-  // Don't process touches if the button is hidden
-  if (!isVisible) {
-    isPressed = false;
-    wasPressed = false;
-    return;
+  setBounds(x - width / 2, y - height / 2, width + 1, height + 1);
+}
+
+void Button::attach(TouchGrid* grid) {
+  touchGrid = grid;
+  touchTarget = addTouchTarget(grid);
+  touchGrid->setEnabled(touchTarget, visible);
+  setPressed(false);
+}
+
+int Button::addTouchTarget(TouchGrid* grid) {
+  return grid->addCircle(x, y, width / 2, handleTouch, this);
+}
+
+void Button::setOnRelease(ButtonHandler handler, void* context) {
+  releaseHandler = handler;
+  releaseContext = context;
+}
+
+void Button::handleTouch(TouchEvent event, void* context) {
+  Button* button = static_cast<Button*>(context);
+  switch (event) {
+    case TOUCH_PRESS:
+      button->setPressed(true);
+      break;
+    case TOUCH_HOLD:
+      break;
+    case TOUCH_RELEASE:
+      button->setPressed(false);
+      if (button->releaseHandler) {
+        button->releaseHandler(button, button->releaseContext);
+      }
+      break;
+    case TOUCH_CANCEL:
+      button->setPressed(false);
+      break;
   }
+}
 
-  wasPressed = isPressed;
-
-  // Check if button is being pressed
-  if (touchPanel->isPressed()) {
-    int touchX = touchPanel->getTouchX();
-    int touchY = touchPanel->getTouchY();
-
-    // Check if touch is within button bounds
-    if (touchX >= (x - width / 2) && touchX <= (x + width / 2) && touchY >= (y - height / 2) && touchY <= (y + height / 2)) {
-      isPressed = true;
-    } else {
-      isPressed = false;
-    }
-  } else {
-    isPressed = false;
+void Button::setPressed(bool pressed) {
+  // Pressed and normal are drawn in different colors
+  if (pressed != isPressed) {
+    isPressed = pressed;
+    invalidate();
   }
 }
 
 void Button::hide() {
-  if (isVisible) {
-    // Clear the button area
-    gfx->fillCircle(x, y, width / 2, BLACK);
-    isVisible = false;
+  setVisible(false);
+  if (touchGrid) {
+    touchGrid->setEnabled(touchTarget, false);
   }
 }
 
 void Button::unhide() {
-  if (!isVisible) {
-    isVisible = true;
-    draw();  // Redraw the button
+  setVisible(true);
+  if (touchGrid) {
+    touchGrid->setEnabled(touchTarget, true);
   }
 }
 
-bool Button::getHasNewPress() {
-  return isPressed && !wasPressed;
-}
-
-bool Button::getHasNewRelease() {
-  return touchPanel->getHasNewRelease() && wasPressed;
-}
-
 bool Button::getIsPressed() const {
   return isPressed;
 }
 
-bool Button::getIsVisible() const {
-  return isVisible;
-}
-
 //////////////////////////////////////////////////
 // PlayButton Implementation
 //////////////////////////////////////////////////
 
-PlayButton::PlayButton(Arduino_GFX* graphics, TouchPanel* touch)
-  : Button(graphics, touch) {}
+PlayButton::PlayButton(Arduino_GFX* graphics)
+  : Button(graphics) {}
 
 void PlayButton::initialize(int centerX, int centerY, int buttonSize) {
   Button::initialize(centerX, centerY, buttonSize, buttonSize);
 }
 
-void PlayButton::draw() {
-  if (!isVisible) return;
-
-  uint16_t color = isPressed ? pressedColor : normalColor;
-
-  // Clear the button area first to prevent overdraw
-  gfx->fillCircle(x, y, width / 2, BLACK);
-
-  // Draw play triangle
-  gfx->fillTriangle(
-    x - width / 4, y - height / 3,  // Top left
-    x - width / 4, y + height / 3,  // Bottom left
-    x + width / 3, y,               // Right point
-    color);
+void PlayButton::draw(const WidgetRect& clip) {
+  // Pre-rendered - covers the whole button, its background included
+  SPRITE_PLAY.draw(gfx, x, y, isPressed ? pressedColor : normalColor);
 }
 
 //////////////////////////////////////////////////
 // PauseButton Implementation
 //////////////////////////////////////////////////
 
-PauseButton::PauseButton(Arduino_GFX* graphics, TouchPanel* touch)
-  : Button(graphics, touch) {}
+PauseButton::PauseButton(Arduino_GFX* graphics)
+  : Button(graphics) {}
 
 void PauseButton::initialize(int centerX, int centerY, int buttonSize) {
   Button::initialize(centerX, centerY, buttonSize, buttonSize);
 }
 
-void PauseButton::draw() {
-  if (!isVisible) return;
-
-  uint16_t color = isPressed ? pressedColor : normalColor;
-
-  // Clear the button area first to prevent overdraw
-  gfx->fillCircle(x, y, width / 2, BLACK);
-
-  // Draw pause bars
-  int barWidth = width / 5;
-  int barHeight = height / 2;
-  int spacing = width / 8;
-
-  // Left bar
-  gfx->fillRect(x - spacing - barWidth / 2, y - barHeight / 2, barWidth, barHeight, color);
-  // Right bar
-  gfx->fillRect(x + spacing - barWidth / 2, y - barHeight / 2, barWidth, barHeight, color);
+void PauseButton::draw(const WidgetRect& clip) {
+  // Pre-rendered - covers the whole button, its background included
+  SPRITE_PAUSE.draw(gfx, x, y, isPressed ? pressedColor : normalColor);
 }
 
 //////////////////////////////////////////////////
 // RewindButton Implementation
 //////////////////////////////////////////////////
 
-RewindButton::RewindButton(Arduino_GFX* graphics, TouchPanel* touch)
-  : Button(graphics, touch) {}
+RewindButton::RewindButton(Arduino_GFX* graphics)
+  : Button(graphics) {}
 
 void RewindButton::initialize(int centerX, int centerY, int buttonSize) {
   Button::initialize(centerX, centerY, buttonSize, buttonSize);
 }
 
-void RewindButton::draw() {
-  if (!isVisible) return;
-
-  uint16_t color = isPressed ? pressedColor : normalColor;
-
-  // Clear the button area first to prevent overdraw
-  gfx->fillCircle(x, y, width / 2, BLACK);
-
-  // Draw two backward triangles
-  int triangleWidth = width / 3;
-  int triangleHeight = height / 2;
-  int spacing = width / 12;
-
-  // Right triangle
-  gfx->fillTriangle(
-    x + triangleWidth / 2 - spacing, y,                       // Right point
-    x - triangleWidth / 2 - spacing, y - triangleHeight / 2,  // Top left
-    x - triangleWidth / 2 - spacing, y + triangleHeight / 2,  // Bottom left
-    color);
-
-  // Left triangle
-  gfx->fillTriangle(
-    x - spacing, y,                                       // Right point
-    x - triangleWidth - spacing, y - triangleHeight / 2,  // Top left
-    x - triangleWidth - spacing, y + triangleHeight / 2,  // Bottom left
-    color);
+void RewindButton::draw(const WidgetRect& clip) {
+  // Pre-rendered - covers the whole button, its background included
+  SPRITE_REWIND.draw(gfx, x, y, isPressed ? pressedColor : normalColor);
 }
 
 //////////////////////////////////////////////////
 // ForwardButton Implementation
 //////////////////////////////////////////////////
 
-ForwardButton::ForwardButton(Arduino_GFX* graphics, TouchPanel* touch)
-  : Button(graphics, touch) {}
+ForwardButton::ForwardButton(Arduino_GFX* graphics)
+  : Button(graphics) {}
 
 void ForwardButton::initialize(int centerX, int centerY, int buttonSize) {
   Button::initialize(centerX, centerY, buttonSize, buttonSize);
 }
 
-void ForwardButton::draw() {
-  if (!isVisible) return;
-
-  uint16_t color = isPressed ? pressedColor : normalColor;
-
-  // Clear the button area first to prevent overdraw
-  gfx->fillCircle(x, y, width / 2, BLACK);
-
-  // Draw two forward triangles
-  int triangleWidth = width / 3;
-  int triangleHeight = height / 2;
-  int spacing = width / 12;
-
-  // Left triangle
-  gfx->fillTriangle(
-    x - triangleWidth / 2 + spacing, y,                       // Left point
-    x + triangleWidth / 2 + spacing, y - triangleHeight / 2,  // Top right
-    x + triangleWidth / 2 + spacing, y + triangleHeight / 2,  // Bottom right
-    color);
-
-  // Right triangle
-  gfx->fillTriangle(
-    x + spacing, y,                                       // Left point
-    x + triangleWidth + spacing, y - triangleHeight / 2,  // Top right
-    x + triangleWidth + spacing, y + triangleHeight / 2,  // Bottom right
-    color);
+void ForwardButton::draw(const WidgetRect& clip) {
+  // Pre-rendered - covers the whole button, its background included
+  SPRITE_FORWARD.draw(gfx, x, y, isPressed ? pressedColor : normalColor);
 }
 
 //////////////////////////////////////////////////
 // BackButton Implementation
 //////////////////////////////////////////////////
 
-BackButton::BackButton(Arduino_GFX* graphics, TouchPanel* touch)
-  : Button(graphics, touch) {
+BackButton::BackButton(Arduino_GFX* graphics)
+  : Button(graphics) {
   // Use gray for normal color instead of white
   normalColor = graphics->color565(128, 128, 128);  // Gray
 }
 
 void BackButton::initialize(int centerX, int centerY, int buttonWidth, int buttonHeight) {
   Button::initialize(centerX, centerY, buttonWidth, buttonHeight);
+  // The ellipse's radii are the width and height
+  setBounds(x - width, y - height, width * 2 + 1, height * 2 + 1);
 }
 
-void BackButton::draw() {
-  if (!isVisible) return;
+int BackButton::addTouchTarget(TouchGrid* grid) {
+  // The central part of the ellipse, as before the grid
+  return grid->addRect(x - width / 2, y - height / 2, width + 1, height + 1, handleTouch, this);
+}
 
+void BackButton::draw(const WidgetRect& clip) {
   uint16_t bgColor = isPressed ? pressedColor : normalColor;
 
-  // Clear area and draw elliptical button
-  gfx->fillEllipse(x, y, width, height, BLACK);
+  // Elliptical button - paints its whole area, so there is nothing to clear first
   gfx->fillEllipse(x, y, width, height, bgColor);
 
   // Draw the arrow inside the back button (always white)
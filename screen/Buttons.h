@@ -2,80 +2,92 @@
 #define BUTTONS_H
 
 #include <Arduino_GFX_Library.h>
-#include "TouchPanel.h"
+#include "TouchGrid.h"
+#include "Widget.h"
+#include "Sprite.h"
 
-// Base Button class
-class Button {
+#define MEDIA_BUTTON_SIZE 60       // Size the media button sprites are rendered at
+
+class Button;
+typedef void (*ButtonHandler)(Button* button, void* context);
+
+// Base Button class - a widget that repaints itself when its press state changes
+// Touches arrive from the screen's TouchGrid; hidden buttons are disabled there
+class Button : public Widget {
 protected:
-  Arduino_GFX* gfx;
-  TouchPanel* touchPanel;
   int x, y;                  // Center position
   int width, height;         // Button dimensions
   bool isPressed;            // Current press state
-  bool wasPressed;           // Previous press state
-  bool isVisible;            // Visibility state
   uint16_t normalColor;      // Color when not pressed
   uint16_t pressedColor;     // Color when pressed
+  TouchGrid* touchGrid;      // Grid the button is registered with
+  int touchTarget;           // Its id there (-1 = not registered)
+  ButtonHandler releaseHandler;
+  void* releaseContext;
+
+  virtual int addTouchTarget(TouchGrid* grid); // Round target by default
+  void setPressed(bool pressed);
+  static void handleTouch(TouchEvent event, void* context);
 
 public:
-  Button(Arduino_GFX* graphics, TouchPanel* touch);
+  Button(Arduino_GFX* graphics);
   
   virtual void initialize(int centerX, int centerY, int buttonWidth, int buttonHeight);
-  virtual void update();
-  virtual void draw() = 0;   // Pure virtual, must be implemented by derived classes
+  void attach(TouchGrid* grid); // Register with the screen's grid, after initialize()
+  void setOnRelease(ButtonHandler handler, void* context); // Called for a tap that lifts on the button
   
-  void hide();               // Hide the button (clear its area)
+  void hide();               // Hide the button (its area is cleared on the next render)
   void unhide();             // Make the button visible again
   
-  bool getHasNewPress();     // Returns true if button was just pressed
-  bool getHasNewRelease();   // Returns true if button was just released
   bool getIsPressed() const; // Returns current press state
-  bool getIsVisible() const; // Returns current visibility state
 };
 
 // Play Button class
 class PlayButton : public Button {
 public:
-  PlayButton(Arduino_GFX* graphics, TouchPanel* touch);
+  PlayButton(Arduino_GFX* graphics);
   
   void initialize(int centerX, int centerY, int buttonSize);
-  void draw() override;
+  void draw(const WidgetRect& clip) override;
 };
 
 // Pause Button class
 class PauseButton : public Button {
 public:
-  PauseButton(Arduino_GFX* graphics, TouchPanel* touch);
+  PauseButton(Arduino_GFX* graphics);
   
   void initialize(int centerX, int centerY, int buttonSize);
-  void draw() override;
+  void draw(const WidgetRect& clip) override;
 };
 
 // Rewind Button class
 class RewindButton : public Button {
 public:
-  RewindButton(Arduino_GFX* graphics, TouchPanel* touch);
+  RewindButton(Arduino_GFX* graphics);
   
   void initialize(int centerX, int centerY, int buttonSize);
-  void draw() override;
+  void draw(const WidgetRect& clip) override;
 };
 
 // Forward Button class
 class ForwardButton : public Button {
 public:
-  ForwardButton(Arduino_GFX* graphics, TouchPanel* touch);
+  ForwardButton(Arduino_GFX* graphics);
   
   void initialize(int centerX, int centerY, int buttonSize);
-  void draw() override;
+  void draw(const WidgetRect& clip) override;
 };
 
 // Back Button class
 class BackButton : public Button {
 public:
-  BackButton(Arduino_GFX* graphics, TouchPanel* touch);
+  BackButton(Arduino_GFX* graphics);
   
   void initialize(int centerX, int centerY, int buttonWidth, int buttonHeight);
-  void draw() override;
+  void draw(const WidgetRect& clip) override;
+
+protected:
+  int addTouchTarget(TouchGrid* grid) override;
 };
 
 #endif // BUTTONS_H
\ No newline at end of file
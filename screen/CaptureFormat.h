@@ -0,0 +1,40 @@
+#ifndef CAPTURE_FORMAT_H
+#define CAPTURE_FORMAT_H
+
+// Input capture record format, shared by the firmware (InputCapture) and the
+// host replay harness (host/tools/replay.cpp) - plain C++, no Arduino
+
+#include <stdint.h>
+
+#define CAPTURE_FORMAT_VERSION 1
+
+// Record kinds
+enum CaptureRecordType : uint8_t {
+  CAPTURE_KNOB_LINE,          // One command line from the knob, without the '\n'
+  CAPTURE_TOUCH,              // One CST816S sample, payload is a CaptureTouch
+  CAPTURE_MQTT                // Incoming message: topic, '\0', payload
+};
+
+// Every record starts with this header, followed by length payload bytes.
+// Records are packed back to back, so the header is read with memcpy.
+struct CaptureRecordHeader {
+  uint32_t time;              // ms since the capture started
+  uint8_t type;               // CaptureRecordType
+  uint8_t reserved;
+  uint16_t length;            // Payload bytes
+};
+
+// Touch sample as read from the controller
+struct CaptureTouch {
+  int16_t x;
+  int16_t y;
+  uint8_t gestureID;
+  uint8_t points;
+  uint8_t event;
+  uint8_t reserved;
+};
+
+static_assert(sizeof(CaptureRecordHeader) == 8, "CaptureRecordHeader is an 8-byte wire format");
+static_assert(sizeof(CaptureTouch) == 8, "CaptureTouch is an 8-byte wire format");
+
+#endif // CAPTURE_FORMAT_H
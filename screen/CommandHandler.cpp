@@ -1,9 +1,20 @@
 #include "CommandHandler.h"
 #include "KnobController.h"  // Include KnobController definition
 #include "WiFiTCPClient.h"   // Include WiFiTCPClient definition
+#include "StateBroadcaster.h"
+#include "SetupHandler.h"      // Boot timing report
+#include "PowerManager.h"      // Power state and frequency residency
+#include "ConfigKeys.h"        // EEPROM key table
+#include "Logger.h"            // Per-module log levels
+#include "SystemMonitor.h"     // Task, stack and heap introspection
+#include "LatencyTracer.h"     // Input-to-effect latency histograms
+#include "EventTrace.h"        // Binary event trace ring
+#include "InputCapture.h"      // Input recording for host replay
 
 CommandHandler::CommandHandler(DisplayController* dc, EEPROMManager* em, WiFiTCPClient* tcp)
-  : displayController(dc), eepromManager(em), knobController(nullptr), tcpClient(tcp), commandCount(0) {
+  : displayController(dc), eepromManager(em), knobController(nullptr), tcpClient(tcp), commandCount(0),
+    replyClientId(-1), dumpClient(-1), dumpSource(DUMP_TRACE), dumpNext(0), dumpEnd(0),
+    traceResumeAfterDump(false) {
 }
 
 void CommandHandler::initialize() {
@@ -26,6 +37,7 @@ void CommandHandler::initialize() {
   commands[commandCount++] = { "getEEPROMValue", &CommandHandler::cmdGetEEPROMValue, "getEEPROMValue:key - Get value from EEPROM by key" };
   commands[commandCount++] = { "setEEPROMValue", &CommandHandler::cmdSetEEPROMValue, "setEEPROMValue:key:value - Set value in EEPROM by key" };
   commands[commandCount++] = { "listEEPROMValues", &CommandHandler::cmdListEEPROMValues, "List all EEPROM values" };
+  commands[commandCount++] = { "commit", &CommandHandler::cmdCommit, "Write pending configuration changes to flash now" };
 
   // Register existing server configuration commands
   commands[commandCount++] = { "configureSoundTCPServer", &CommandHandler::cmdConfigureSoundTCPServer, "configureSoundTCPServer:IP:Port - Configure Sound TCP Server" };
@@ -41,6 +53,23 @@ void CommandHandler::initialize() {
   commands[commandCount++] = { "disableStaticIP", &CommandHandler::cmdDisableStaticIP, "Disable static IP configuration (use DHCP)" };
   commands[commandCount++] = { "showStaticIP", &CommandHandler::cmdShowStaticIP, "Show current static IP configuration" };
 
+  // Register state subscription commands
+  commands[commandCount++] = { "subscribe", &CommandHandler::cmdSubscribe, "subscribe:topics - Push state changes (setpoint,light,mode,play,wifi,mqtt,indoor,outdoor or all)" };
+  commands[commandCount++] = { "unsubscribe", &CommandHandler::cmdUnsubscribe, "unsubscribe:topics - Stop state pushes (no topics = all)" };
+
+  // Register UDP setpoint channel commands
+  commands[commandCount++] = { "udpRegister", &CommandHandler::cmdUDPRegister, "udpRegister:port - Stream setpoints over UDP to this client's address" };
+  commands[commandCount++] = { "udpUnregister", &CommandHandler::cmdUDPUnregister, "Stop UDP setpoint streaming (MQTT only)" };
+
+  // Register diagnostics commands
+  commands[commandCount++] = { "boottime", &CommandHandler::cmdBootTime, "Show per-stage timing of the last boot" };
+  commands[commandCount++] = { "power", &CommandHandler::cmdPower, "Show power state and time spent per power state and CPU frequency" };
+  commands[commandCount++] = { "sys", &CommandHandler::cmdSys, "Show per-task CPU share and stack high-water marks, heap fragmentation and allocation counts" };
+  commands[commandCount++] = { "log", &CommandHandler::cmdLog, "log[:module:level] - Show or set per-module log levels (none,error,warn,info,debug,verbose)" };
+  commands[commandCount++] = { "trace", &CommandHandler::cmdTrace, "trace[:on|off|clear|dump] - Event trace status, control, or stream the ring (decode with trace2chrome)" };
+  commands[commandCount++] = { "capture", &CommandHandler::cmdCapture, "capture[:start|stop|dump] - Record knob, touch and MQTT input for host replay, or stream the capture (replay with qnob_replay)" };
+  commands[commandCount++] = { "latency", &CommandHandler::cmdLatency, "latency[:reset|probe[:count]] - Show knob-to-pixel/publish and MQTT echo p50/p95/p99, reset them or run echo probes" };
+
   commands[commandCount++] = { "help", &CommandHandler::cmdHelp, "Show available commands" };
 
   Serial.println("Serial interface initialized.");
@@ -50,10 +79,18 @@ void CommandHandler::registerKnobController(KnobController* kc) {
   knobController = kc;
 }
 
+void CommandHandler::setTCPClient(WiFiTCPClient* client) {
+  tcpClient = client;
+}
+
 // Replace the update() method in CommandHandler.cpp with this optimized version
 void CommandHandler::update() {
   hasNewMessage = false;
 
+  if (dumpClient >= 0) {
+    pumpDump();
+  }
+
   // Process one source per cycle rather than all at once
   static uint8_t sourceIndex = 0;
 
@@ -109,8 +146,7 @@ void CommandHandler::update() {
     case 1:  // Knob Controller
       if (knobController && knobController->getHasNewMessage()) {
         hasNewMessage = true;
-        String knobCommand = knobController->getReceivedCommand();
-        processKnobCommand(knobCommand);
+        processKnobCommand(knobController->getReceivedCommand(), knobController->getReceivedStamp());
       }
       break;
 
@@ -118,7 +154,10 @@ void CommandHandler::update() {
       if (tcpClient && tcpClient->getHasNewMessage()) {
         hasNewMessage = true;
         String tcpCommand = tcpClient->getMessage();
+        // Responses go back to the client that sent the command
+        replyClientId = tcpClient->getMessageClientId();
         processTCPCommand(tcpCommand);
+        replyClientId = -1;
       }
       break;
   }
@@ -127,26 +166,31 @@ void CommandHandler::update() {
   sourceIndex = (sourceIndex + 1) % 3;
 }
 
-void CommandHandler::processKnobCommand(const String& command) {
-  // Handle specific knob commands
-  if (command == "+") {
-    cmdIncrementSetpoint("");
-  } else if (command == "-") {
-    cmdDecrementSetpoint("");
-  } else if (command == "reset") {
-    cmdReset("");
-  } else if (command.equals("calibrate")) {
+void CommandHandler::processKnobCommand(const char* command, LatencyStamp inputStamp) {
+  // Handle specific knob commands - detents arrive many times a second, so no String copies.
+  // Setpoint changes carry the arrival stamp so their latency can be traced to the screen and broker
+  static const String noParams;
+  if (strcmp(command, "+") == 0) {
+    displayController->incrementSetpoint(inputStamp);
+    LOG_DEBUG(LOG_SYSTEM, "SetPoint incremented.");
+  } else if (strcmp(command, "-") == 0) {
+    displayController->decrementSetpoint(inputStamp);
+    LOG_DEBUG(LOG_SYSTEM, "SetPoint decremented.");
+  } else if (strcmp(command, "reset") == 0) {
+    cmdReset(noParams);
+  } else if (strcmp(command, "calibrate") == 0) {
     // Special handling for calibrate command
     displayController->setSetpoint(1);
-    cmdCalibrateOrientation("");
+    cmdCalibrateOrientation(noParams);
     if (knobController) {
       knobController->sendCommand("switching to calibration");
     }
-  } else if (command.startsWith("setpoint=")) {
-    // Extract setpoint value and pass to handler
-    cmdKnobSetpoint(command.substring(9));
+  } else if (strncmp(command, "setpoint=", 9) == 0) {
+    int setPoint = atoi(command + 9);
+    displayController->setSetpoint(setPoint, inputStamp);
+    LOG_DEBUG(LOG_SYSTEM, "Updated setpoint: %d", setPoint);
   } else {
-    Serial.println("Unknown command from knob: " + command);
+    Serial.printf("Unknown command from knob: %s\n", command);
   }
 }
 
@@ -187,7 +231,21 @@ void CommandHandler::processTCPCommand(const String& command) {
 
 void CommandHandler::sendTCPResponse(const String& response) {
   if (tcpClient) {
-    tcpClient->sendTCPResponse(response);
+    tcpClient->sendTCPResponse(replyClientId, response);
+  }
+}
+
+void CommandHandler::sendMultilineResponse(const String& text) {
+  // One TCP line per line of text
+  size_t startPos = 0;
+  while (startPos < text.length()) {
+    int endPos = text.indexOf('\n', startPos);
+    if (endPos < 0) {
+      sendTCPResponse(text.substring(startPos));
+      return;
+    }
+    sendTCPResponse(text.substring(startPos, endPos));
+    startPos = (size_t)endPos + 1;
   }
 }
 
@@ -213,12 +271,12 @@ void CommandHandler::printHelp() {
 // Existing command implementations
 void CommandHandler::cmdIncrementSetpoint(const String& params) {
   displayController->incrementSetpoint();
-  Serial.println("SetPoint incremented.");
+  LOG_DEBUG(LOG_SYSTEM, "SetPoint incremented.");
 }
 
 void CommandHandler::cmdDecrementSetpoint(const String& params) {
   displayController->decrementSetpoint();
-  Serial.println("SetPoint decremented.");
+  LOG_DEBUG(LOG_SYSTEM, "SetPoint decremented.");
 }
 
 void CommandHandler::cmdReset(const String& params) {
@@ -336,8 +394,7 @@ void CommandHandler::cmdHelp(const String& params) {
 void CommandHandler::cmdKnobSetpoint(const String& params) {
   int setPoint = params.toInt();
   displayController->setSetpoint(setPoint);
-  Serial.print("Updated setpoint: ");
-  Serial.println(setPoint);
+  LOG_DEBUG(LOG_SYSTEM, "Updated setpoint: %d", setPoint);
 }
 
 // New command implementations
@@ -502,18 +559,12 @@ void CommandHandler::cmdCommInfo(const String& params) {
   String info = eepromManager->getConfigurationInfo();
   Serial.println(info);
 
-  // Split the info into lines for TCP response
-  int startPos = 0;
-  int endPos = info.indexOf('\n');
-  while (endPos != -1) {
-    String line = info.substring(startPos, endPos);
-    sendTCPResponse(line);
-    startPos = endPos + 1;
-    endPos = info.indexOf('\n', startPos);
-  }
-  // Send last line if any
-  if (startPos < info.length()) {
-    sendTCPResponse(info.substring(startPos));
+  sendMultilineResponse(info);
+
+  if (tcpClient && tcpClient->getWiFiHandler()) {
+    String report = tcpClient->getWiFiHandler()->getConnectReport();
+    Serial.println(report);
+    sendTCPResponse(report);
   }
 }
 
@@ -631,26 +682,14 @@ void CommandHandler::cmdShowStaticIP(const String& params) {
   String info = eepromManager->getStaticIPInfo();
   Serial.println(info);
 
-  // Split the info into lines for TCP response
-  int startPos = 0;
-  int endPos = info.indexOf('\n');
-  while (endPos != -1) {
-    String line = info.substring(startPos, endPos);
-    sendTCPResponse(line);
-    startPos = endPos + 1;
-    endPos = info.indexOf('\n', startPos);
-  }
-  // Send last line if any
-  if (startPos < info.length()) {
-    sendTCPResponse(info.substring(startPos));
-  }
+  sendMultilineResponse(info);
 }
 
 bool CommandHandler::getHasNewMessage() {
   return hasNewMessage;
 }
 
-// New EEPROM command implementations
+// EEPROM key/value commands - keys and types come from the ConfigKeys table
 void CommandHandler::cmdGetEEPROMValue(const String& params) {
   // Get value for a specific key
   if (params.length() == 0) {
@@ -659,150 +698,425 @@ void CommandHandler::cmdGetEEPROMValue(const String& params) {
     return;
   }
 
-  // Example implementation - in a real implementation, you would retrieve the value from EEPROM
-  String value = "";
-
-  // Check for known configuration values
-  if (params == "deviceName") {
-    value = eepromManager->deviceName;
-  } else if (params == "soundMQTTURL") {
-    value = eepromManager->soundMQTTServerURL;
-  } else if (params == "soundMQTTPort") {
-    value = String(eepromManager->soundMQTTServerPort);
-  } else if (params == "lightMQTTURL") {
-    value = eepromManager->lightMQTTServerURL;
-  } else if (params == "lightMQTTPort") {
-    value = String(eepromManager->lightMQTTServerPort);
-  } else if (params == "staticIPEnabled") {
-    value = eepromManager->staticIPEnabled ? "Yes" : "No";
-  } else if (params == "staticIP") {
-    value = eepromManager->staticIP;
-  } else {
-    // Key not found
+  const ConfigKey* key = ConfigKeys::find(params.c_str());
+  if (key == nullptr) {
     Serial.println("[Error] Unknown key: " + params);
     sendTCPResponse("[Error] Unknown key: " + params);
     return;
   }
 
-  String response = params + "=" + value;
-  Serial.println(response);
-  sendTCPResponse(response);
+  char line[CONFIG_LINE_LENGTH];
+  int len = snprintf(line, sizeof(line), "%s=", key->name);
+  eepromManager->getValue(*key, line + len, sizeof(line) - len);
+  Serial.println(line);
+  sendTCPResponse(line);
 }
 
 void CommandHandler::cmdSetEEPROMValue(const String& params) {
   // Set value for a specific key
   int colonPos = params.indexOf(':');
-  if (colonPos == -1) {
+  if (colonPos <= 0 || colonPos >= CONFIG_KEY_MAX_LENGTH) {
     Serial.println("[Error] Invalid format! Use: setEEPROMValue:key:value");
     sendTCPResponse("[Error] Invalid format! Use: setEEPROMValue:key:value");
     return;
   }
 
-  String key = params.substring(0, colonPos);
-  String value = params.substring(colonPos + 1);
-
-  // Set value based on the key
-  bool success = false;
-
-  // Check for known configuration values
-  if (key == "deviceName") {
-    eepromManager->saveDeviceName(value);
-    success = true;
-  } else if (key == "soundMQTTURL") {
-    // Save but maintain other values
-    eepromManager->saveSoundMQTTServer(
-      value,
-      eepromManager->soundMQTTServerPort,
-      eepromManager->soundMQTTUsername,
-      eepromManager->soundMQTTPassword);
-    success = true;
-  } else if (key == "soundMQTTPort") {
-    int port = value.toInt();
-    if (port > 0 && port <= 65535) {
-      eepromManager->saveSoundMQTTServer(
-        eepromManager->soundMQTTServerURL,
-        port,
-        eepromManager->soundMQTTUsername,
-        eepromManager->soundMQTTPassword);
-      success = true;
-    } else {
-      Serial.println("[Error] Invalid port value. Must be between 1 and 65535.");
-      sendTCPResponse("[Error] Invalid port value. Must be between 1 and 65535.");
-    }
-  } else {
-    // Key not recognized
-    Serial.println("[Error] Unknown key: " + key);
-    sendTCPResponse("[Error] Unknown key: " + key);
+  // Split in place - no substrings
+  char keyName[CONFIG_KEY_MAX_LENGTH];
+  memcpy(keyName, params.c_str(), colonPos);
+  keyName[colonPos] = 0;
+  const char* value = params.c_str() + colonPos + 1;
+
+  const ConfigKey* key = ConfigKeys::find(keyName);
+  if (key == nullptr) {
+    Serial.printf("[Error] Unknown key: %s\n", keyName);
+    sendTCPResponse(String("[Error] Unknown key: ") + keyName);
     return;
   }
 
-  if (success) {
-    String response = "Value saved: " + key + "=" + value;
-    Serial.println(response);
-    sendTCPResponse(response);
+  if (!eepromManager->setValue(*key, value)) {
+    Serial.printf("[Error] Invalid value for %s\n", keyName);
+    sendTCPResponse(String("[Error] Invalid value for ") + keyName);
+    return;
   }
+
+  char line[CONFIG_LINE_LENGTH];
+  int len = snprintf(line, sizeof(line), "Value saved: %s=", key->name);
+  eepromManager->getValue(*key, line + len, sizeof(line) - len);
+  Serial.println(line);
+  sendTCPResponse(line);
 }
 
 void CommandHandler::cmdListEEPROMValues(const String& params) {
-  // List all values in EEPROM
+  // One line per key, formatted into the same buffer
   Serial.println("\n=== EEPROM Configuration Values ===");
 
-  // Device information
-  Serial.println("deviceName=" + eepromManager->deviceName);
-  sendTCPResponse("deviceName=" + eepromManager->deviceName);
-
-  // WiFi networks
-  for (int i = 0; i < 3; i++) {
-    if (eepromManager->wifiCredentials[i].ssid.length() > 0) {
-      Serial.println("wifi" + String(i) + "_ssid=" + eepromManager->wifiCredentials[i].ssid);
-      sendTCPResponse("wifi" + String(i) + "_ssid=" + eepromManager->wifiCredentials[i].ssid);
-      // Don't expose passwords
-      Serial.println("wifi" + String(i) + "_password=********");
-      sendTCPResponse("wifi" + String(i) + "_password=********");
-    }
+  char line[CONFIG_LINE_LENGTH];
+  for (int i = 0; i < ConfigKeys::count(); i++) {
+    const ConfigKey& key = ConfigKeys::at(i);
+    int len = snprintf(line, sizeof(line), "%s=", key.name);
+    eepromManager->getValue(key, line + len, sizeof(line) - len);
+    Serial.println(line);
+    sendTCPResponse(line);
   }
 
-  // Last connected network
-  Serial.println("lastConnectedNetwork=" + String(eepromManager->lastConnectedNetworkIndex));
-  sendTCPResponse("lastConnectedNetwork=" + String(eepromManager->lastConnectedNetworkIndex));
-
-  // MQTT configurations
-  Serial.println("soundMQTTURL=" + eepromManager->soundMQTTServerURL);
-  sendTCPResponse("soundMQTTURL=" + eepromManager->soundMQTTServerURL);
-  Serial.println("soundMQTTPort=" + String(eepromManager->soundMQTTServerPort));
-  sendTCPResponse("soundMQTTPort=" + String(eepromManager->soundMQTTServerPort));
-  Serial.println("soundMQTTUsername=" + eepromManager->soundMQTTUsername);
-  sendTCPResponse("soundMQTTUsername=" + eepromManager->soundMQTTUsername);
-  // Don't expose passwords
-  Serial.println("soundMQTTPassword=********");
-  sendTCPResponse("soundMQTTPassword=********");
-
-  Serial.println("lightMQTTURL=" + eepromManager->lightMQTTServerURL);
-  sendTCPResponse("lightMQTTURL=" + eepromManager->lightMQTTServerURL);
-  Serial.println("lightMQTTPort=" + String(eepromManager->lightMQTTServerPort));
-  sendTCPResponse("lightMQTTPort=" + String(eepromManager->lightMQTTServerPort));
-  Serial.println("lightMQTTUsername=" + eepromManager->lightMQTTUsername);
-  sendTCPResponse("lightMQTTUsername=" + eepromManager->lightMQTTUsername);
-  // Don't expose passwords
-  Serial.println("lightMQTTPassword=********");
-  sendTCPResponse("lightMQTTPassword=********");
-
-  // Static IP configuration
-  Serial.println("staticIPEnabled=" + String(eepromManager->staticIPEnabled ? "Yes" : "No"));
-  sendTCPResponse("staticIPEnabled=" + String(eepromManager->staticIPEnabled ? "Yes" : "No"));
-  Serial.println("staticIP=" + eepromManager->staticIP);
-  sendTCPResponse("staticIP=" + eepromManager->staticIP);
-  Serial.println("staticGateway=" + eepromManager->staticGateway);
-  sendTCPResponse("staticGateway=" + eepromManager->staticGateway);
-  Serial.println("staticSubnet=" + eepromManager->staticSubnet);
-  sendTCPResponse("staticSubnet=" + eepromManager->staticSubnet);
-
   Serial.println("=== End of EEPROM Values ===");
 }
 
+void CommandHandler::cmdCommit(const String& params) {
+  // Configuration changes are batched - force them out (e.g. at the end of a provisioning script)
+  if (eepromManager->commit()) {
+    sendTCPResponse("Configuration committed");
+  } else {
+    Serial.println("No pending configuration changes.");
+    sendTCPResponse("No pending configuration changes");
+  }
+}
+
 void CommandHandler::cmdGetDeviceName(const String& params) {
   // Return the device name
   String deviceName = eepromManager->deviceName;
   Serial.println(deviceName);
   sendTCPResponse(deviceName);
-}
\ No newline at end of file
+}
+
+void CommandHandler::cmdSubscribe(const String& params) {
+  if (replyClientId < 0) {
+    String errorMsg = "[Error] subscribe is only available to TCP clients";
+    Serial.println(errorMsg);
+    return;
+  }
+
+  StateBroadcaster* broadcaster = StateBroadcaster::getInstance();
+  if (StateBroadcaster::parseTopics(params) == 0) {
+    sendTCPResponse("[Error] Unknown topic in: " + params);
+    sendTCPResponse("Topics: setpoint,light,mode,play,wifi,mqtt,indoor,outdoor or all");
+    return;
+  }
+
+  if (!broadcaster->subscribe(replyClientId, params)) {
+    sendTCPResponse("[Error] Too many subscribers");
+    return;
+  }
+
+  sendTCPResponse("[Subscribe] subscribed:" + broadcaster->describeSubscription(replyClientId));
+}
+
+void CommandHandler::cmdUnsubscribe(const String& params) {
+  if (replyClientId < 0) {
+    Serial.println("[Error] unsubscribe is only available to TCP clients");
+    return;
+  }
+
+  StateBroadcaster* broadcaster = StateBroadcaster::getInstance();
+  broadcaster->unsubscribe(replyClientId, params);
+  sendTCPResponse("[Subscribe] subscribed:" + broadcaster->describeSubscription(replyClientId));
+}
+
+void CommandHandler::cmdUDPRegister(const String& params) {
+  if (replyClientId < 0 || !tcpClient || !tcpClient->getUDPHandler()) {
+    Serial.println("[Error] udpRegister is only available to TCP clients");
+    return;
+  }
+
+  int port = params.toInt();
+  if (port <= 0 || port > 65535) {
+    String errorMsg = "[Error] Invalid format! Use: udpRegister:port";
+    Serial.println(errorMsg);
+    sendTCPResponse(errorMsg);
+    return;
+  }
+
+  // Datagrams go to the address the registering TCP client connected from
+  IPAddress peerIP = tcpClient->getTCPClientIP(replyClientId);
+  UDPHandler* udpHandler = tcpClient->getUDPHandler();
+  udpHandler->registerPeer(peerIP, port);
+
+  sendTCPResponse("[UDP] Streaming setpoints to " + peerIP.toString() + ":" + String(port));
+  sendTCPResponse("[UDP] Send 'ping' to port " + String(UDP_SETPOINT_PORT) + " at least every " +
+                  String(UDP_PEER_TIMEOUT / 1000) + "s to keep the channel active");
+}
+
+void CommandHandler::cmdUDPUnregister(const String& params) {
+  if (!tcpClient || !tcpClient->getUDPHandler()) {
+    return;
+  }
+
+  UDPHandler* udpHandler = tcpClient->getUDPHandler();
+  udpHandler->unregisterPeer();
+  String infoMsg = "[UDP] " + udpHandler->getStatus();
+  Serial.println(infoMsg);
+  sendTCPResponse(infoMsg);
+}
+
+void CommandHandler::cmdBootTime(const String& params) {
+  String report = SetupHandler::getBootTimeReport();
+  Serial.println(report);
+
+  sendMultilineResponse(report);
+}
+
+void CommandHandler::cmdPower(const String& params) {
+  String report = PowerManager::getInstance()->getResidencyReport();
+  Serial.println(report);
+
+  sendMultilineResponse(report);
+}
+
+void CommandHandler::cmdSys(const String& params) {
+  String report = SystemMonitor::getInstance()->getReport();
+  Serial.println(report);
+
+  sendMultilineResponse(report);
+}
+
+void CommandHandler::cmdLog(const String& params) {
+  if (params.length() > 0) {
+    int colonPos = params.indexOf(':');
+    if (colonPos <= 0 || colonPos >= 16) {
+      Serial.println("[Error] Invalid format! Use: log:module:level");
+      sendTCPResponse("[Error] Invalid format! Use: log:module:level");
+      return;
+    }
+
+    char moduleName[16];
+    memcpy(moduleName, params.c_str(), colonPos);
+    moduleName[colonPos] = 0;
+    const char* levelName = params.c_str() + colonPos + 1;
+
+    int level = Logger::findLevel(levelName);
+    if (level < 0) {
+      Serial.printf("[Error] Unknown log level: %s\n", levelName);
+      sendTCPResponse(String("[Error] Unknown log level: ") + levelName);
+      return;
+    }
+
+    if (strcasecmp(moduleName, "all") == 0) {
+      Logger::setAllLevels(level);
+    } else {
+      int module = Logger::findModule(moduleName);
+      if (module < 0) {
+        Serial.printf("[Error] Unknown log module: %s\n", moduleName);
+        sendTCPResponse(String("[Error] Unknown log module: ") + moduleName);
+        return;
+      }
+      Logger::setLevel((LogModule)module, level);
+    }
+  }
+
+  char line[48];
+  for (int i = 0; i < LOG_MODULE_COUNT; i++) {
+    snprintf(line, sizeof(line), "%-8s %s", Logger::getModuleName((LogModule)i),
+             Logger::getLevelName(Logger::getLevel((LogModule)i)));
+    Serial.println(line);
+    sendTCPResponse(line);
+  }
+  snprintf(line, sizeof(line), "Dropped: %lu", (unsigned long)Logger::getDroppedCount());
+  Serial.println(line);
+  sendTCPResponse(line);
+}
+
+void CommandHandler::cmdLatency(const String& params) {
+  if (params == "reset") {
+    LatencyTracer::getInstance()->reset();
+    Serial.println("[Latency] Histograms cleared");
+    sendTCPResponse("[Latency] Histograms cleared");
+    return;
+  }
+
+  if (params.startsWith("probe")) {
+    MQTTHandler* mqttHandler = tcpClient ? tcpClient->getMQTTHandler() : nullptr;
+    if (!mqttHandler || !mqttHandler->isMQTTConnected()) {
+      Serial.println("[Error] MQTT not connected, cannot probe");
+      sendTCPResponse("[Error] MQTT not connected, cannot probe");
+      return;
+    }
+
+    int count = params.length() > 6 ? params.substring(6).toInt() : 10;
+    if (count <= 0 || count > 100) {
+      Serial.println("[Error] Probe count must be between 1 and 100");
+      sendTCPResponse("[Error] Probe count must be between 1 and 100");
+      return;
+    }
+
+    mqttHandler->startLatencyProbes(count);
+    String infoMsg = "[Latency] Sending " + String(count) + " echo probes on " LATENCY_PROBE_TOPIC
+                     ", run 'latency' when done";
+    Serial.println(infoMsg);
+    sendTCPResponse(infoMsg);
+    return;
+  }
+
+  if (params.length() > 0) {
+    Serial.println("[Error] Invalid format! Use: latency, latency:reset or latency:probe[:count]");
+    sendTCPResponse("[Error] Invalid format! Use: latency, latency:reset or latency:probe[:count]");
+    return;
+  }
+
+  String report = LatencyTracer::getInstance()->getReport();
+  Serial.println(report);
+
+  sendMultilineResponse(report);
+}
+
+void CommandHandler::cmdTrace(const String& params) {
+  char line[112];
+
+  if (params == "on" || params == "off") {
+    EventTrace::setEnabled(params == "on");
+  } else if (params == "clear") {
+    bool wasEnabled = EventTrace::isEnabled();
+    EventTrace::setEnabled(false);
+    EventTrace::clear();
+    EventTrace::setEnabled(wasEnabled);
+  } else if (params == "dump") {
+    if (!startDump(DUMP_TRACE)) {
+      return;
+    }
+
+    // Pause recording so the ring holds still while it is sent
+    traceResumeAfterDump = EventTrace::isEnabled();
+    EventTrace::setEnabled(false);
+    EventTrace::getRange(dumpNext, dumpEnd);
+
+    snprintf(line, sizeof(line), "trace:begin,version=%d,records=%lu,capacity=%lu,overwritten=%lu",
+             TRACE_FORMAT_VERSION, (unsigned long)(dumpEnd - dumpNext),
+             (unsigned long)EventTrace::getCapacity(), (unsigned long)dumpNext);
+    sendTCPResponse(line);
+
+    // Task names for the decoder - records only carry the task handle
+    static TaskStatus_t tasks[SYS_MAX_TASKS];
+    UBaseType_t taskCount = uxTaskGetSystemState(tasks, SYS_MAX_TASKS, nullptr);
+    for (UBaseType_t i = 0; i < taskCount; i++) {
+      snprintf(line, sizeof(line), "trace:task,%08lx,%s",
+               (unsigned long)(uint32_t)(uintptr_t)tasks[i].xHandle, tasks[i].pcTaskName);
+      sendTCPResponse(line);
+    }
+    return;
+  } else if (params.length() > 0) {
+    Serial.println("[Error] Invalid format! Use: trace[:on|off|clear|dump]");
+    sendTCPResponse("[Error] Invalid format! Use: trace[:on|off|clear|dump]");
+    return;
+  }
+
+  uint32_t first, end;
+  EventTrace::getRange(first, end);
+  snprintf(line, sizeof(line), "[Trace] recording %s, %lu of %lu records in %s (%lu overwritten)",
+           EventTrace::isEnabled() ? "on" : "off", (unsigned long)(end - first),
+           (unsigned long)EventTrace::getCapacity(), EventTrace::isInPSRAM() ? "PSRAM" : "internal RAM",
+           (unsigned long)first);
+  Serial.println(line);
+  sendTCPResponse(line);
+}
+
+void CommandHandler::cmdCapture(const String& params) {
+  char line[192];
+
+  if (params == "start") {
+    if (dumpClient >= 0 && dumpSource == DUMP_CAPTURE) {
+      sendTCPResponse("[Error] A capture dump is still running");
+      return;
+    }
+    // The replay starts from the screen and setpoints shown now
+    ResumeSnapshot initialState = {};
+    if (displayController) {
+      displayController->captureResumeState(initialState);
+    }
+    if (!InputCapture::start(initialState)) {
+      Serial.println("[Error] Could not allocate the capture buffer");
+      sendTCPResponse("[Error] Could not allocate the capture buffer");
+      return;
+    }
+  } else if (params == "stop") {
+    InputCapture::stop();
+  } else if (params == "dump") {
+    if (!startDump(DUMP_CAPTURE)) {
+      return;
+    }
+
+    InputCapture::stop();
+    dumpNext = 0;
+    dumpEnd = InputCapture::getSize();
+
+    const ResumeSnapshot& state = InputCapture::getInitialState();
+    snprintf(line, sizeof(line),
+             "capture:begin,version=%d,bytes=%lu,records=%lu,duration=%lu,truncated=%d,"
+             "mode=%u,sound=%u,light=%u,playing=%u",
+             CAPTURE_FORMAT_VERSION, (unsigned long)dumpEnd, (unsigned long)InputCapture::getRecordCount(),
+             (unsigned long)InputCapture::getDuration(), InputCapture::isTruncated() ? 1 : 0,
+             state.mode, state.soundSetpoint, state.lightSetpoint, state.playing);
+    sendTCPResponse(line);
+    return;
+  } else if (params.length() > 0) {
+    Serial.println("[Error] Invalid format! Use: capture[:start|stop|dump]");
+    sendTCPResponse("[Error] Invalid format! Use: capture[:start|stop|dump]");
+    return;
+  }
+
+  snprintf(line, sizeof(line), "[Capture] %s, %lu records, %lu of %lu bytes over %lu ms%s",
+           InputCapture::isCapturing() ? "capturing" : "stopped",
+           (unsigned long)InputCapture::getRecordCount(), (unsigned long)InputCapture::getSize(),
+           (unsigned long)InputCapture::getCapacity(), (unsigned long)InputCapture::getDuration(),
+           InputCapture::isTruncated() ? " (buffer filled, truncated)" : "");
+  Serial.println(line);
+  sendTCPResponse(line);
+}
+
+bool CommandHandler::startDump(DumpSource source) {
+  if (replyClientId < 0 || !tcpClient) {
+    Serial.println("[Error] Dumps stream over TCP - send the command from a TCP client");
+    sendTCPResponse("[Error] Dumps stream over TCP - send the command from a TCP client");
+    return false;
+  }
+  if (dumpClient >= 0) {
+    sendTCPResponse("[Error] A dump is already running");
+    return false;
+  }
+
+  dumpClient = replyClientId;
+  dumpSource = source;
+  return true;
+}
+
+void CommandHandler::finishDump() {
+  dumpClient = -1;
+  if (dumpSource == DUMP_TRACE) {
+    EventTrace::setEnabled(traceResumeAfterDump);
+  }
+}
+
+void CommandHandler::pumpDump() {
+  if (!tcpClient || !tcpClient->isTCPClientConnected(dumpClient)) {
+    // Client went away - drop the dump
+    finishDump();
+    return;
+  }
+
+  const char* prefix = dumpSource == DUMP_TRACE ? "trace:" : "capture:";
+
+  // Prefix plus "data," and the base64 of one line's records or bytes
+  char line[16 + 4 * ((CAPTURE_DUMP_BYTES_PER_LINE + 2) / 3)];
+  static_assert(TRACE_DUMP_RECORDS_PER_LINE * sizeof(TraceRecord) <= CAPTURE_DUMP_BYTES_PER_LINE,
+                "Dump line buffer is sized for the larger of the two");
+  while (dumpNext < dumpEnd && tcpClient->getTCPOutputSpace(dumpClient) >= sizeof(line) + 2) {
+    size_t length = snprintf(line, sizeof(line), "%sdata,", prefix);
+    uint32_t count = dumpEnd - dumpNext;
+
+    if (dumpSource == DUMP_TRACE) {
+      if (count > TRACE_DUMP_RECORDS_PER_LINE) count = TRACE_DUMP_RECORDS_PER_LINE;
+      length += EventTrace::encodeRecords(dumpNext, count, line + length, sizeof(line) - length);
+    } else {
+      if (count > CAPTURE_DUMP_BYTES_PER_LINE) count = CAPTURE_DUMP_BYTES_PER_LINE;
+      length += EventTrace::encodeBase64(InputCapture::getData() + dumpNext, count,
+                                         line + length, sizeof(line) - length);
+    }
+    tcpClient->sendTCPResponse(dumpClient, line, length, false);
+    dumpNext += count;
+  }
+
+  if (dumpNext >= dumpEnd && tcpClient->getTCPOutputSpace(dumpClient) >= 64) {
+    size_t length = snprintf(line, sizeof(line), "%send", prefix);
+    tcpClient->sendTCPResponse(dumpClient, line, length, false);
+    finishDump();
+  }
+}
@@ -22,7 +22,7 @@ private:
   };
 
   // Command storage
-  Command commands[30];  // Increased to support more commands
+  Command commands[40];  // Increased to support more commands
   int commandCount = 0;
 
   // Dependencies
@@ -33,6 +33,15 @@ private:
 
   // Command buffer
   String commandFromPC;
+  int replyClientId;               // TCP client that receives responses (-1 = all clients)
+
+  // Trace or capture dump streamed over several update() cycles, as output room frees up
+  enum DumpSource { DUMP_TRACE, DUMP_CAPTURE };
+  int dumpClient;                  // TCP client receiving a dump (-1 = none)
+  DumpSource dumpSource;
+  uint32_t dumpNext;               // Next trace record / capture byte to send
+  uint32_t dumpEnd;                // One past the last one of the dump
+  bool traceResumeAfterDump;       // Trace recording was on before the dump paused it
 
   // Command handlers - existing commands
   void cmdIncrementSetpoint(const String& params);
@@ -52,6 +61,7 @@ private:
   void cmdGetEEPROMValue(const String& params);
   void cmdSetEEPROMValue(const String& params);
   void cmdListEEPROMValues(const String& params);
+  void cmdCommit(const String& params);
 
   // Server configuration command handlers
   void cmdConfigureSoundTCPServer(const String& params);
@@ -67,12 +77,33 @@ private:
   void cmdDisableStaticIP(const String& params);
   void cmdShowStaticIP(const String& params);
 
+  // State subscription command handlers
+  void cmdSubscribe(const String& params);
+  void cmdUnsubscribe(const String& params);
+
+  // UDP setpoint channel command handlers
+  void cmdUDPRegister(const String& params);
+  void cmdUDPUnregister(const String& params);
+
+  // Diagnostics command handlers
+  void cmdBootTime(const String& params);
+  void cmdPower(const String& params);
+  void cmdSys(const String& params);
+  void cmdLog(const String& params);
+  void cmdLatency(const String& params);
+  void cmdTrace(const String& params);
+  void cmdCapture(const String& params);
+  bool startDump(DumpSource source); // Claim the dump stream for the replying TCP client
+  void pumpDump();                 // Send the next lines of a trace or capture dump
+  void finishDump();               // Release the dump stream
+
   // Process command from various sources
-  void processKnobCommand(const String& command);
+  void processKnobCommand(const char* command, LatencyStamp inputStamp);
   void processTCPCommand(const String& command);
 
   // Helper method for TCP responses
   void sendTCPResponse(const String& response);
+  void sendMultilineResponse(const String& text); // sendTCPResponse for each line
   void cmdGetDeviceName(const String& params);
 public:
   CommandHandler(DisplayController* dc, EEPROMManager* em, WiFiTCPClient* tcp);
@@ -82,6 +113,8 @@ public:
   bool getHasNewMessage();
   // Method to register KnobController
   void registerKnobController(KnobController* kc);
+  // Method to set the TCP client once the network stack is up
+  void setTCPClient(WiFiTCPClient* client);
 };
 
 #endif  // COMMAND_HANDLER_H
\ No newline at end of file
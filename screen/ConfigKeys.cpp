@@ -0,0 +1,142 @@
+#include "ConfigKeys.h"
+#include "EEPROMManager.h"   // StoredConfig layout
+
+#define CONFIG_KEY_INDEX_SIZE 64          // Power of two, keep the table under half full
+#define CONFIG_KEY_EMPTY 0xFF
+
+static bool validatePort(const char* text, long number) {
+  return number > 0 && number <= 65535;
+}
+
+static bool validateNetworkIndex(const char* text, long number) {
+  return number >= -1 && number < NUM_WIFI_CREDENTIALS;
+}
+
+static bool validateIP(const char* text, long number) {
+  // Dotted quad, each part 0-255
+  int parts = 0;
+  long value = -1;
+  for (const char* p = text; ; p++) {
+    if (*p >= '0' && *p <= '9') {
+      value = (value < 0 ? 0 : value * 10) + (*p - '0');
+      if (value > 255) return false;
+    } else if (*p == '.' || *p == 0) {
+      if (value < 0) return false;
+      parts++;
+      value = -1;
+      if (*p == 0) break;
+    } else {
+      return false;
+    }
+  }
+  return parts == 4;
+}
+
+static bool validateOptionalIP(const char* text, long number) {
+  // Empty means "not set"
+  return text[0] == 0 || validateIP(text, number);
+}
+
+static bool validateNotEmpty(const char* text, long number) {
+  return text[0] != 0;
+}
+
+#define KEY_STRING(name, field, validator) \
+  { name, CONFIG_STRING, offsetof(StoredConfig, field), sizeof(StoredConfig::field), false, validator }
+#define KEY_SECRET(name, field) \
+  { name, CONFIG_STRING, offsetof(StoredConfig, field), sizeof(StoredConfig::field), true, nullptr }
+#define KEY_INT(name, field, type, validator) \
+  { name, type, offsetof(StoredConfig, field), 0, false, validator }
+
+#define KEY_WIFI(slot) \
+  { "wifi" #slot "_ssid", CONFIG_STRING, offsetof(StoredConfig, wifiCredentials[slot].ssid), MAX_SSID_LENGTH, false, nullptr }, \
+  { "wifi" #slot "_password", CONFIG_STRING, offsetof(StoredConfig, wifiCredentials[slot].password), MAX_PASS_LENGTH, true, nullptr }, \
+  KEY_INT("wifi" #slot "_remember", wifiCredentials[slot].remember, CONFIG_BOOL, nullptr)
+
+static constexpr ConfigKey keys[] = {
+  KEY_STRING("deviceName", deviceName, validateNotEmpty),
+
+  KEY_WIFI(0),
+  KEY_WIFI(1),
+  KEY_WIFI(2),
+  KEY_INT("lastConnectedNetwork", lastConnectedNetworkIndex, CONFIG_INT8, validateNetworkIndex),
+
+  KEY_STRING("soundTCPIP", soundTCPServerIP, validateOptionalIP),
+  KEY_INT("soundTCPPort", soundTCPServerPort, CONFIG_INT, validatePort),
+  KEY_STRING("lightTCPIP", lightTCPServerIP, validateOptionalIP),
+  KEY_INT("lightTCPPort", lightTCPServerPort, CONFIG_INT, validatePort),
+
+  KEY_STRING("soundMQTTURL", soundMQTTServerURL, nullptr),
+  KEY_INT("soundMQTTPort", soundMQTTServerPort, CONFIG_INT, validatePort),
+  KEY_STRING("soundMQTTUsername", soundMQTTUsername, nullptr),
+  KEY_SECRET("soundMQTTPassword", soundMQTTPassword),
+  KEY_STRING("lightMQTTURL", lightMQTTServerURL, nullptr),
+  KEY_INT("lightMQTTPort", lightMQTTServerPort, CONFIG_INT, validatePort),
+  KEY_STRING("lightMQTTUsername", lightMQTTUsername, nullptr),
+  KEY_SECRET("lightMQTTPassword", lightMQTTPassword),
+
+  KEY_INT("staticIPEnabled", staticIPEnabled, CONFIG_BOOL, nullptr),
+  KEY_STRING("staticIP", staticIP, validateIP),
+  KEY_STRING("staticGateway", staticGateway, validateIP),
+  KEY_STRING("staticSubnet", staticSubnet, validateIP),
+  KEY_STRING("staticDNS1", staticDNS1, validateIP),
+  KEY_STRING("staticDNS2", staticDNS2, validateIP),
+};
+
+static constexpr int keyCount = sizeof(keys) / sizeof(keys[0]);
+static_assert(keyCount * 2 <= CONFIG_KEY_INDEX_SIZE, "Config key index too full, increase CONFIG_KEY_INDEX_SIZE");
+static_assert(keyCount < CONFIG_KEY_EMPTY, "Config key index entries are uint8_t");
+
+static constexpr uint32_t keyHash(const char* name) {
+  // FNV-1a
+  uint32_t hash = 2166136261UL;
+  while (*name) {
+    hash = (hash ^ (uint8_t)*name++) * 16777619UL;
+  }
+  return hash;
+}
+
+struct ConfigKeyIndex {
+  uint32_t hashes[keyCount];                  // Hash per table entry
+  uint8_t slots[CONFIG_KEY_INDEX_SIZE];       // Table entry per bucket, CONFIG_KEY_EMPTY if free
+};
+
+static constexpr ConfigKeyIndex buildIndex() {
+  ConfigKeyIndex index = {};
+  for (int i = 0; i < CONFIG_KEY_INDEX_SIZE; i++) {
+    index.slots[i] = CONFIG_KEY_EMPTY;
+  }
+  for (int i = 0; i < keyCount; i++) {
+    index.hashes[i] = keyHash(keys[i].name);
+    uint32_t bucket = index.hashes[i] & (CONFIG_KEY_INDEX_SIZE - 1);
+    while (index.slots[bucket] != CONFIG_KEY_EMPTY) {
+      bucket = (bucket + 1) & (CONFIG_KEY_INDEX_SIZE - 1);   // Linear probing
+    }
+    index.slots[bucket] = i;
+  }
+  return index;
+}
+
+static constexpr ConfigKeyIndex keyIndex = buildIndex();
+
+const ConfigKey* ConfigKeys::find(const char* name) {
+  uint32_t hash = keyHash(name);
+  uint32_t bucket = hash & (CONFIG_KEY_INDEX_SIZE - 1);
+
+  while (keyIndex.slots[bucket] != CONFIG_KEY_EMPTY) {
+    uint8_t entry = keyIndex.slots[bucket];
+    if (keyIndex.hashes[entry] == hash && strcmp(keys[entry].name, name) == 0) {
+      return &keys[entry];
+    }
+    bucket = (bucket + 1) & (CONFIG_KEY_INDEX_SIZE - 1);
+  }
+  return nullptr;
+}
+
+int ConfigKeys::count() {
+  return keyCount;
+}
+
+const ConfigKey& ConfigKeys::at(int index) {
+  return keys[index];
+}
@@ -0,0 +1,48 @@
+#ifndef CONFIG_KEYS_H
+#define CONFIG_KEYS_H
+
+#include <Arduino.h>
+
+#define CONFIG_KEY_MAX_LENGTH 32          // Longest key name (including null terminator)
+#define CONFIG_LINE_LENGTH 128            // "key=value" line, fits the longest value
+
+// Storage type of a config field inside StoredConfig
+enum ConfigType : uint8_t {
+  CONFIG_STRING,        // char[maxLength], null terminated
+  CONFIG_INT,           // int32_t
+  CONFIG_INT8,          // int8_t
+  CONFIG_BOOL           // uint8_t, 0/1
+};
+
+// Checks a parsed value before it is stored (string for CONFIG_STRING, number otherwise)
+typedef bool (*ConfigValidator)(const char* text, long number);
+
+// One user-visible config key mapped onto a StoredConfig field
+struct ConfigKey {
+  const char* name;
+  ConfigType type;
+  uint16_t offset;              // Byte offset into StoredConfig
+  uint8_t maxLength;            // Field size for strings (including null terminator)
+  bool secret;                  // Never printed back (passwords)
+  ConfigValidator validator;    // nullptr accepts any value that fits
+};
+
+/**
+ * Compile-time table of the keys reachable through getEEPROMValue,
+ * setEEPROMValue and listEEPROMValues.
+ *
+ * Lookup goes through an open-addressing index of FNV-1a name hashes that is
+ * built by the compiler, so finding a key costs one hash and usually a single
+ * strcmp - no String comparison chains and no allocation.
+ */
+class ConfigKeys {
+public:
+  // Key by name, nullptr if unknown
+  static const ConfigKey* find(const char* name);
+
+  // Iteration in table order (for listing)
+  static int count();
+  static const ConfigKey& at(int index);
+};
+
+#endif // CONFIG_KEYS_H
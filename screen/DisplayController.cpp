@@ -1,4 +1,6 @@
 #include "DisplayController.h"
+#include "StateBroadcaster.h"
+#include "Logger.h"
 
 DisplayController::DisplayController(Arduino_GFX* graphics, int sda, int scl, int rst, int irq, WiFiTCPClient* tcpClient)
   : gfx(graphics), tcpClient(tcpClient), displayIsOn(true), soundController(nullptr),
@@ -28,8 +30,7 @@ void DisplayController::initScreen() {
   }
   gfx->invertDisplay(true);
   gfx->fillScreen(BLACK);
-  pinMode(DF_GFX_BL, OUTPUT);
-  digitalWrite(DF_GFX_BL, HIGH);
+  setBacklight(BACKLIGHT_FULL);
 
   // Start with initialization screen
   setMode(INITIALIZATION);
@@ -56,9 +57,40 @@ void DisplayController::setTCPClient(WiFiTCPClient* client) {
     MQTTHandler* mqttHandler = client->getMQTTHandler();
     if (soundController) soundController->setMQTTHandler(mqttHandler);
     if (lightController) lightController->setMQTTHandler(mqttHandler);
+    if (soundController) soundController->setUDPHandler(client->getUDPHandler());
   }
 }
 
+void DisplayController::captureResumeState(ResumeSnapshot& snapshot) {
+  // Sleep itself is not a screen to come back to
+  Mode mode = (currentMode == SLEEP || currentMode == INITIALIZATION ||
+               currentMode == CALIBRATE_ORIENTATION) ? INFO : currentMode;
+
+  snapshot.mode = mode;
+  snapshot.soundSetpoint = soundController ? soundController->getSetpoint() : 50;
+  snapshot.lightSetpoint = lightController ? lightController->getSetpoint() : 50;
+  snapshot.playing = (soundController && soundController->getIsPlaying()) ? 1 : 0;
+  snapshot.mqttLightConfig = (tcpClient && tcpClient->getMQTTHandler()->isUsingLightConfig()) ? 1 : 0;
+}
+
+void DisplayController::restoreResumeState(const ResumeSnapshot& snapshot) {
+  if (soundController) {
+    soundController->restoreState(snapshot.soundSetpoint, snapshot.playing != 0);
+  }
+  if (lightController) {
+    lightController->restoreSetpoint(snapshot.lightSetpoint);
+  }
+
+  // Only user-facing screens can be resumed
+  Mode mode = (Mode)snapshot.mode;
+  if (mode != SOUND && mode != LIGHT && mode != HOME && mode != INFO) {
+    mode = INFO;
+  }
+
+  // Leaving INITIALIZATION skips the transition animation, so the next update draws the screen
+  setMode(mode);
+}
+
 void DisplayController::updateInitProgress(int progress) {
   if (initializationScreen && currentMode == INITIALIZATION) {
     // Update network status indicators in init screen
@@ -180,7 +212,7 @@ void DisplayController::setDisplayOff() {
 void DisplayController::turnDisplayOff() {
   if (displayIsOn) {
     setMode(SLEEP);
-    digitalWrite(DF_GFX_BL, LOW);
+    setBacklight(0);
     displayIsOn = false;
     Serial.println("Display turned off");
   }
@@ -238,7 +270,9 @@ void DisplayController::update() {
         if (soundController->isPageBackRequested()) {
           setMode(HOME);
           Serial.println("Returning to HOME mode.");
-          tcpClient->disconnect();
+          if (tcpClient) {
+            tcpClient->disconnect();
+          }
           modeController->setActive(true);
         }
       }
@@ -250,7 +284,9 @@ void DisplayController::update() {
         if (lightController->isPageBackRequested()) {
           setMode(HOME);
           Serial.println("Returning to HOME mode.");
-          tcpClient->disconnect();
+          if (tcpClient) {
+            tcpClient->disconnect();
+          }
           modeController->setActive(true);
         }
       }
@@ -322,10 +358,45 @@ void DisplayController::update() {
       break;
   }
 }
+void DisplayController::setBacklight(uint8_t level) {
+  analogWrite(DF_GFX_BL, level);
+}
+
+bool DisplayController::needsFullSpeed() const {
+  // INFO only redraws the clock once a second and SLEEP draws nothing
+  return displayIsOn && currentMode != INFO && currentMode != SLEEP;
+}
+
+void DisplayController::applyPowerState(PowerState state) {
+  switch (state) {
+    case POWER_ACTIVE:
+      if (displayIsOn) {
+        setBacklight(BACKLIGHT_FULL);
+      } else {
+        turnDisplayOn();
+      }
+      break;
+
+    case POWER_DIMMED:
+      if (displayIsOn) {
+        setBacklight(BACKLIGHT_DIMMED);
+      }
+      break;
+
+    case POWER_IDLE:
+    case POWER_DEEP:
+      turnDisplayOff();
+      break;
+
+    default:
+      break;
+  }
+}
+
 // Replace the turnDisplayOn method
 void DisplayController::turnDisplayOn() {
   if (!displayIsOn) {
-    digitalWrite(DF_GFX_BL, HIGH);
+    setBacklight(BACKLIGHT_FULL);
     displayIsOn = true;
     Serial.println("Display turned on");
 
@@ -352,43 +423,43 @@ void DisplayController::setSoundLevel(int level) {
   }
 }
 
-void DisplayController::incrementSetpoint() {
+void DisplayController::incrementSetpoint(LatencyStamp inputStamp) {
   resetActivityTime();
 
   if (currentMode == SOUND && soundController) {
-    soundController->incrementSetpoint();
+    soundController->incrementSetpoint(inputStamp);
   } else if (currentMode == HOME && modeController) {
     // For home screen, use WIPE_RIGHT animation as requested
     AnimationHelper::performTransition(gfx, AnimationHelper::WIPE_RIGHT, 200);
     modeController->nextMode();
   } else if (currentMode == LIGHT && lightController) {
-    lightController->incrementSetpoint();
+    lightController->incrementSetpoint(inputStamp);
   }
 }
 
-void DisplayController::decrementSetpoint() {
+void DisplayController::decrementSetpoint(LatencyStamp inputStamp) {
   resetActivityTime();
 
   if (currentMode == SOUND && soundController) {
-    soundController->decrementSetpoint();
+    soundController->decrementSetpoint(inputStamp);
   } else if (currentMode == HOME && modeController) {
     // For home screen, use WIPE_LEFT animation as requested
     AnimationHelper::performTransition(gfx, AnimationHelper::WIPE_LEFT, 200);
     modeController->previousMode();
   } else if (currentMode == LIGHT && lightController) {
-    lightController->decrementSetpoint();
+    lightController->decrementSetpoint(inputStamp);
   }
 }
 
-void DisplayController::setSetpoint(int setpoint) {
+void DisplayController::setSetpoint(int setpoint, LatencyStamp inputStamp) {
   resetActivityTime();
 
   if (currentMode == SOUND && soundController) {
-    soundController->updateSetpoint(setpoint);
+    soundController->updateSetpoint(setpoint, inputStamp);
   } else if (currentMode == HOME && modeController) {
     // No action needed
   } else if (currentMode == LIGHT && lightController) {
-    lightController->setSetpoint(setpoint);
+    lightController->setSetpoint(setpoint, inputStamp);
   }
 }
 
@@ -481,8 +552,9 @@ void DisplayController::setMode(Mode mode) {
   transitionToMode(mode, transition);
 
   // Log the mode change
-  String modeNames[] = { "SOUND", "LIGHT", "TEMPERATURE", "HOME", "CALIBRATE_ORIENTATION", "INITIALIZATION", "INFO", "SLEEP" };
-  Serial.println("Switching to " + modeNames[mode] + " mode.");
+  static const char* const modeNames[] = { "SOUND", "LIGHT", "TEMPERATURE", "HOME", "CALIBRATE_ORIENTATION", "INITIALIZATION", "INFO", "SLEEP" };
+  LOG_INFO(LOG_DISPLAY, "Switching to %s mode.", modeNames[mode]);
+  StateBroadcaster::getInstance()->publish(STATE_MODE, modeNames[mode]);
 
   // Additional mode-specific actions
   if (mode == INITIALIZATION && initializationScreen) {
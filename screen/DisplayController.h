@@ -12,6 +12,8 @@
 #include "InitializationScreen.h"
 #include "InfoScreen.h"
 #include "AnimationHelper.h"
+#include "ResumeState.h"
+#include "PowerManager.h"
 
 
 class DisplayController {
@@ -51,9 +53,9 @@ public:
   void update();
   void drawCalibrationMark();
   void setSoundLevel(int level);
-  void incrementSetpoint();
-  void decrementSetpoint();
-  void setSetpoint(int setpoint);
+  void incrementSetpoint(LatencyStamp inputStamp = 0);   // Stamp from the knob, 0 when untraced
+  void decrementSetpoint(LatencyStamp inputStamp = 0);
+  void setSetpoint(int setpoint, LatencyStamp inputStamp = 0);
   void setMode(Mode mode);
   void turnDisplayOff();
   void turnDisplayOn();
@@ -65,11 +67,18 @@ public:
   bool getHasNewEvent();
   void registerKnobController(KnobController* knob);
   void setDisplayOff();
+  void setBacklight(uint8_t level);          // PWM backlight level (0 = off)
+  void applyPowerState(PowerState state);    // Backlight/screen for a power state - call from the display task
+  bool needsFullSpeed() const;               // Current screen animates/reacts to input every frame
   
   // Methods for initialization and info screens
   void updateInitProgress(int progress);
   void setTCPClient(WiFiTCPClient* client);
   
+  // Warm resume from deep sleep
+  void captureResumeState(ResumeSnapshot& snapshot); // Save UI state before sleeping
+  void restoreResumeState(const ResumeSnapshot& snapshot); // Restore it and show the last screen
+  
   ~DisplayController();
 };
 
@@ -3,8 +3,7 @@
 #include <Arduino.h>
 #include <EEPROM.h>
 
-// EEPROM Size and Configuration
-#define EEPROM_SIZE 1024                  // Increased EEPROM size
+// Configuration
 #define NUM_WIFI_CREDENTIALS 3            // Number of stored WiFi credentials
 #define MAX_SSID_LENGTH 32                // Max length for SSID (including null terminator)
 #define MAX_PASS_LENGTH 64                // Max length for password (including null terminator)
@@ -13,7 +12,20 @@
 #define MAX_USERNAME_LENGTH 32            // Max length for username
 #define MAX_DEVICE_NAME_LENGTH 32         // Max length for device name
 
-// EEPROM Address Definitions
+// EEPROM layout: the legacy address map followed by two config slots (A/B).
+// Each save writes the whole config to the slot not holding the newest copy,
+// so an interrupted write always leaves the previous config intact.
+#define LEGACY_CONFIG_SIZE 1024           // Old per-field address map, only read for migration
+#define CONFIG_SLOT_SIZE 1024             // Room for StoredConfig to grow
+#define CONFIG_SLOT_A_ADDRESS LEGACY_CONFIG_SIZE
+#define CONFIG_SLOT_B_ADDRESS (CONFIG_SLOT_A_ADDRESS + CONFIG_SLOT_SIZE)
+#define EEPROM_SIZE (CONFIG_SLOT_B_ADDRESS + CONFIG_SLOT_SIZE)
+
+#define CONFIG_MAGIC 0x51434647           // "QCFG"
+#define CONFIG_VERSION 1                  // Bump when StoredConfig changes, migrate in loadAllConfigurations
+#define CONFIG_COMMIT_DELAY 2000          // Quiet period before pending changes are written (ms)
+
+// Legacy (pre-version 1) address map
 // Each credential occupies: MAX_SSID_LENGTH + MAX_PASS_LENGTH + 1 (for the remember flag)
 #define CREDENTIAL_BLOCK_SIZE (MAX_SSID_LENGTH + MAX_PASS_LENGTH + 1)
 // The WiFi credentials start at address 0
@@ -38,14 +50,76 @@
 #define LIGHT_MQTT_SERVER_PASSWORD_ADDRESS (LIGHT_MQTT_SERVER_USERNAME_ADDRESS + MAX_USERNAME_LENGTH)
 // Device name
 #define DEVICE_NAME_ADDRESS (LIGHT_MQTT_SERVER_PASSWORD_ADDRESS + MAX_PASS_LENGTH)
-
-// Static IP Configuration addresses (new)
+// Static IP configuration
 #define STATIC_IP_ENABLED_ADDRESS (DEVICE_NAME_ADDRESS + MAX_DEVICE_NAME_LENGTH)
 #define STATIC_IP_ADDRESS (STATIC_IP_ENABLED_ADDRESS + 1)
 #define STATIC_GATEWAY_ADDRESS (STATIC_IP_ADDRESS + MAX_IP_LENGTH)
 #define STATIC_SUBNET_ADDRESS (STATIC_GATEWAY_ADDRESS + MAX_IP_LENGTH)
 #define STATIC_DNS1_ADDRESS (STATIC_SUBNET_ADDRESS + MAX_IP_LENGTH)
 #define STATIC_DNS2_ADDRESS (STATIC_DNS1_ADDRESS + MAX_IP_LENGTH)
+// Fast reconnect cache
+#define WIFI_CACHE_ADDRESS (STATIC_DNS2_ADDRESS + MAX_IP_LENGTH)
+
+#define WIFI_CACHE_MAGIC 0x51574331       // "QWC1" - marks a valid cache entry
+
+// Last successful connection, kept in RTC memory and mirrored to EEPROM
+struct WiFiConnectCache {
+  uint32_t magic;        // WIFI_CACHE_MAGIC when valid
+  int8_t slot;           // Credential slot that connected
+  uint8_t channel;       // AP channel
+  uint8_t bssid[6];      // AP MAC address
+  uint32_t ip;           // DHCP lease (0 if not captured)
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns;
+  uint32_t checksum;     // Checksum of the fields above
+};
+
+// On-flash image of the whole configuration (one per slot)
+struct __attribute__((packed)) StoredConfig {
+  uint32_t magic;                          // CONFIG_MAGIC
+  uint16_t version;                        // CONFIG_VERSION
+  uint16_t length;                         // sizeof(StoredConfig) when written
+  uint32_t sequence;                       // Incremented per save, newest valid slot wins
+
+  struct __attribute__((packed)) {
+    char ssid[MAX_SSID_LENGTH];
+    char password[MAX_PASS_LENGTH];
+    uint8_t remember;
+  } wifiCredentials[NUM_WIFI_CREDENTIALS];
+  int8_t lastConnectedNetworkIndex;
+
+  char soundTCPServerIP[MAX_IP_LENGTH];
+  int32_t soundTCPServerPort;
+  char lightTCPServerIP[MAX_IP_LENGTH];
+  int32_t lightTCPServerPort;
+
+  char soundMQTTServerURL[MAX_URL_LENGTH];
+  int32_t soundMQTTServerPort;
+  char soundMQTTUsername[MAX_USERNAME_LENGTH];
+  char soundMQTTPassword[MAX_PASS_LENGTH];
+  char lightMQTTServerURL[MAX_URL_LENGTH];
+  int32_t lightMQTTServerPort;
+  char lightMQTTUsername[MAX_USERNAME_LENGTH];
+  char lightMQTTPassword[MAX_PASS_LENGTH];
+
+  char deviceName[MAX_DEVICE_NAME_LENGTH];
+
+  uint8_t staticIPEnabled;
+  char staticIP[MAX_IP_LENGTH];
+  char staticGateway[MAX_IP_LENGTH];
+  char staticSubnet[MAX_IP_LENGTH];
+  char staticDNS1[MAX_IP_LENGTH];
+  char staticDNS2[MAX_IP_LENGTH];
+
+  WiFiConnectCache wifiCache;
+
+  uint32_t crc;                            // CRC32 of everything above
+};
+
+static_assert(sizeof(StoredConfig) <= CONFIG_SLOT_SIZE, "StoredConfig does not fit a config slot");
+
+struct ConfigKey;
 
 struct WifiCredential {
   String ssid;
@@ -85,6 +159,9 @@ public:
   String staticDNS1;
   String staticDNS2;
 
+  // Fast reconnect cache
+  WiFiConnectCache wifiCache;
+
   EEPROMManager();
   void begin();
   void saveWiFiCredentials();
@@ -103,7 +180,21 @@ public:
                          const String& subnet, const String& dns1, const String& dns2);
   void loadStaticIPConfig();
   
-  // Load configurations
+  // Fast reconnect cache methods
+  void saveWiFiCache(const WiFiConnectCache& cache); // Only writes flash when the entry changed
+  void clearWiFiCache();
+  
+  // Saves only update RAM - changes reach flash in one commit once no save
+  // happened for CONFIG_COMMIT_DELAY, on commit(), or before restart/deep sleep
+  bool commit();                       // Write pending changes now, false if there were none
+  void update();                       // Commit after the quiet period - call periodically
+  bool hasPendingChanges() const { return dirty; }
+  
+  // Typed access through the key table (ConfigKeys.h), straight on the stored config
+  void getValue(const ConfigKey& key, char* buffer, size_t size);  // Secrets come back masked
+  bool setValue(const ConfigKey& key, const char* value);          // Validates and commits, false if rejected
+  
+  // Load configurations (newest valid slot, migrating the legacy layout if needed)
   void loadAllConfigurations();
   
   // Get configuration as string for display
@@ -111,9 +202,23 @@ public:
   String getStaticIPInfo(); // New method to get static IP info
 
 private:
-  void writeStringToEEPROM(int address, const String &str, int maxLength);
+  int activeSlot;             // Slot address holding the newest config, -1 if none
+  uint32_t configSequence;    // Sequence number of the newest config
+  bool dirty;                 // RAM holds changes not yet committed
+  unsigned long lastChangeMs; // Time of the last uncommitted change
+
+  void setDefaults();
+  void markDirty();           // Record a change for the next commit
+  void commitConfig();        // Write the whole config to the other slot with one commit
+  bool readNewestSlot(StoredConfig& config);
+  bool readSlot(int address, StoredConfig& config);
+  void packConfig(StoredConfig& config);
+  void unpackConfig(const StoredConfig& config);
+
+  // Legacy layout migration
+  bool hasLegacyConfiguration();
+  void loadLegacyConfiguration();
   String readStringFromEEPROM(int address, int maxLength);
-  void writeIntToEEPROM(int address, int value);
   int readIntFromEEPROM(int address, int defaultValue);
 };
 
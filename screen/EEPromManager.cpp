@@ -1,8 +1,72 @@
 #include "EEPROMManager.h"
+#include "ConfigKeys.h"
+#include "EventTrace.h"
+#include <esp_system.h>
+
+// Image of the newest stored config (the last one loaded or committed), also
+// the buffer for slot reads - too large for the calling task's stack
+static StoredConfig storedConfig;
+
+static uint32_t configCrc(const StoredConfig& config) {
+  // CRC-32 (IEEE, reflected) over everything but the crc field
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&config);
+  uint32_t crc = 0xFFFFFFFFUL;
+  for (size_t i = 0; i < offsetof(StoredConfig, crc); i++) {
+    crc ^= bytes[i];
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+// Flushes pending changes when esp_restart() is called from anywhere
+static EEPROMManager* shutdownInstance = nullptr;
+
+static void commitOnShutdown() {
+  if (shutdownInstance) {
+    shutdownInstance->commit();
+  }
+}
+
+static void copyField(char* dest, const String& value, size_t size) {
+  // Fields are zeroed beforehand, so truncating leaves the terminator in place
+  strncpy(dest, value.c_str(), size - 1);
+}
+
+static void assignField(String& dest, const char* field, size_t size) {
+  // Tolerate a missing terminator. Assigning a char* reuses the String's buffer
+  // when it's large enough, so reloading unchanged values doesn't allocate.
+  char buffer[MAX_URL_LENGTH + 1];
+  size_t len = strnlen(field, size);
+  memcpy(buffer, field, len);
+  buffer[len] = 0;
+  dest = buffer;
+}
+
+static bool parseBool(const char* text, long& value) {
+  if (strcmp(text, "1") == 0 || strcasecmp(text, "true") == 0 ||
+      strcasecmp(text, "yes") == 0 || strcasecmp(text, "on") == 0) {
+    value = 1;
+    return true;
+  }
+  if (strcmp(text, "0") == 0 || strcasecmp(text, "false") == 0 ||
+      strcasecmp(text, "no") == 0 || strcasecmp(text, "off") == 0) {
+    value = 0;
+    return true;
+  }
+  return false;
+}
+
+#define PACK_STRING(field) copyField(config.field, field, sizeof(config.field))
+#define UNPACK_STRING(field) assignField(field, config.field, sizeof(config.field))
 
 EEPROMManager::EEPROMManager() 
-  : lastConnectedNetworkIndex(-1) {
-  // Initialize default values
+  : lastConnectedNetworkIndex(-1), activeSlot(-1), configSequence(0), dirty(false), lastChangeMs(0) {
+  setDefaults();
+}
+
+void EEPROMManager::setDefaults() {
   soundTCPServerIP = "";
   soundTCPServerPort = 12345;
   lightTCPServerIP = "";
@@ -17,7 +81,7 @@ EEPROMManager::EEPROMManager()
   lightMQTTPassword = "";
   deviceName = "ESP32Device"; // Set a default device name
   
-  // Initialize static IP configuration with defaults
+  // Static IP configuration defaults
   staticIPEnabled = false;
   staticIP = "192.168.4.1";
   staticGateway = "192.168.4.1";
@@ -30,193 +94,321 @@ EEPROMManager::EEPROMManager()
     wifiCredentials[i].password = "";
     wifiCredentials[i].remember = false;
   }
+  lastConnectedNetworkIndex = -1;
+  
+  memset(&wifiCache, 0, sizeof(wifiCache));
 }
 
 void EEPROMManager::begin() {
   // Initialize the EEPROM with the specified size.
   EEPROM.begin(EEPROM_SIZE);
   loadAllConfigurations();
+  
+  if (shutdownInstance == nullptr) {
+    shutdownInstance = this;
+    esp_register_shutdown_handler(commitOnShutdown);
+  }
+}
+
+void EEPROMManager::packConfig(StoredConfig& config) {
+  memset(&config, 0, sizeof(config));
+  config.magic = CONFIG_MAGIC;
+  config.version = CONFIG_VERSION;
+  config.length = sizeof(StoredConfig);
+
+  for (int i = 0; i < NUM_WIFI_CREDENTIALS; i++) {
+    copyField(config.wifiCredentials[i].ssid, wifiCredentials[i].ssid, MAX_SSID_LENGTH);
+    copyField(config.wifiCredentials[i].password, wifiCredentials[i].password, MAX_PASS_LENGTH);
+    config.wifiCredentials[i].remember = wifiCredentials[i].remember ? 1 : 0;
+  }
+  config.lastConnectedNetworkIndex = lastConnectedNetworkIndex;
+
+  PACK_STRING(soundTCPServerIP);
+  config.soundTCPServerPort = soundTCPServerPort;
+  PACK_STRING(lightTCPServerIP);
+  config.lightTCPServerPort = lightTCPServerPort;
+
+  PACK_STRING(soundMQTTServerURL);
+  config.soundMQTTServerPort = soundMQTTServerPort;
+  PACK_STRING(soundMQTTUsername);
+  PACK_STRING(soundMQTTPassword);
+  PACK_STRING(lightMQTTServerURL);
+  config.lightMQTTServerPort = lightMQTTServerPort;
+  PACK_STRING(lightMQTTUsername);
+  PACK_STRING(lightMQTTPassword);
+
+  PACK_STRING(deviceName);
+
+  config.staticIPEnabled = staticIPEnabled ? 1 : 0;
+  PACK_STRING(staticIP);
+  PACK_STRING(staticGateway);
+  PACK_STRING(staticSubnet);
+  PACK_STRING(staticDNS1);
+  PACK_STRING(staticDNS2);
+
+  memcpy(&config.wifiCache, &wifiCache, sizeof(wifiCache));
 }
 
-void EEPROMManager::writeStringToEEPROM(int address, const String &str, int maxLength) {
-  int len = str.length();
-  if (len > maxLength - 1) {
-    len = maxLength - 1;  // Reserve space for null terminator.
+void EEPROMManager::unpackConfig(const StoredConfig& config) {
+  for (int i = 0; i < NUM_WIFI_CREDENTIALS; i++) {
+    assignField(wifiCredentials[i].ssid, config.wifiCredentials[i].ssid, MAX_SSID_LENGTH);
+    assignField(wifiCredentials[i].password, config.wifiCredentials[i].password, MAX_PASS_LENGTH);
+    wifiCredentials[i].remember = config.wifiCredentials[i].remember == 1;
   }
-  for (int i = 0; i < len; i++) {
-    EEPROM.write(address + i, str[i]);
+  lastConnectedNetworkIndex = config.lastConnectedNetworkIndex;
+
+  UNPACK_STRING(soundTCPServerIP);
+  soundTCPServerPort = config.soundTCPServerPort;
+  UNPACK_STRING(lightTCPServerIP);
+  lightTCPServerPort = config.lightTCPServerPort;
+
+  UNPACK_STRING(soundMQTTServerURL);
+  soundMQTTServerPort = config.soundMQTTServerPort;
+  UNPACK_STRING(soundMQTTUsername);
+  UNPACK_STRING(soundMQTTPassword);
+  UNPACK_STRING(lightMQTTServerURL);
+  lightMQTTServerPort = config.lightMQTTServerPort;
+  UNPACK_STRING(lightMQTTUsername);
+  UNPACK_STRING(lightMQTTPassword);
+
+  UNPACK_STRING(deviceName);
+
+  staticIPEnabled = config.staticIPEnabled == 1;
+  UNPACK_STRING(staticIP);
+  UNPACK_STRING(staticGateway);
+  UNPACK_STRING(staticSubnet);
+  UNPACK_STRING(staticDNS1);
+  UNPACK_STRING(staticDNS2);
+
+  memcpy(&wifiCache, &config.wifiCache, sizeof(wifiCache));
+}
+
+bool EEPROMManager::readSlot(int address, StoredConfig& config) {
+  EEPROM.get(address, config);
+  return config.magic == CONFIG_MAGIC &&
+         config.version == CONFIG_VERSION &&
+         config.length == sizeof(StoredConfig) &&
+         config.crc == configCrc(config);
+}
+
+bool EEPROMManager::readNewestSlot(StoredConfig& config) {
+  bool validA = readSlot(CONFIG_SLOT_A_ADDRESS, config);
+  uint32_t sequenceA = config.sequence;
+  bool validB = readSlot(CONFIG_SLOT_B_ADDRESS, config);
+  uint32_t sequenceB = config.sequence;
+
+  if (!validA && !validB) {
+    activeSlot = -1;
+    return false;
   }
-  EEPROM.write(address + len, 0);  // Write null terminator.
-  // Fill the remaining bytes with 0.
-  for (int i = len + 1; i < maxLength; i++) {
-    EEPROM.write(address + i, 0);
+
+  // Wrap-safe comparison - the slots are always one save apart
+  if (validA && (!validB || (int32_t)(sequenceA - sequenceB) > 0)) {
+    activeSlot = CONFIG_SLOT_A_ADDRESS;
+    readSlot(CONFIG_SLOT_A_ADDRESS, config);
+  } else {
+    activeSlot = CONFIG_SLOT_B_ADDRESS;   // Already in config
   }
+  configSequence = config.sequence;
+  return true;
 }
 
-String EEPROMManager::readStringFromEEPROM(int address, int maxLength) {
-  String s = "";
-  for (int i = 0; i < maxLength; i++) {
-    char c = EEPROM.read(address + i);
-    if (c == 0) break;  // End of string.
-    s += c;
+void EEPROMManager::commitConfig() {
+  TRACE_SPAN(TRACE_CONFIG_COMMIT);
+  packConfig(storedConfig);
+  storedConfig.sequence = configSequence + 1;
+  storedConfig.crc = configCrc(storedConfig);
+
+  // Alternate slots: the newest copy is never the one being overwritten
+  int slot = (activeSlot == CONFIG_SLOT_A_ADDRESS) ? CONFIG_SLOT_B_ADDRESS : CONFIG_SLOT_A_ADDRESS;
+  EEPROM.put(slot, storedConfig);
+  if (!EEPROM.commit()) {
+    Serial.println("❌ Failed to commit configuration");
+    return;
   }
-  return s;
+
+  activeSlot = slot;
+  configSequence = storedConfig.sequence;
+  dirty = false;
 }
 
-void EEPROMManager::writeIntToEEPROM(int address, int value) {
-  // Using EEPROM.put is more convenient, as it writes the int as multiple bytes.
-  EEPROM.put(address, value);
+void EEPROMManager::markDirty() {
+  // Keep the image current so reads see the change right away
+  packConfig(storedConfig);
+  dirty = true;
+  lastChangeMs = millis();
 }
 
-int EEPROMManager::readIntFromEEPROM(int address, int defaultValue) {
-  int value = defaultValue;
-  EEPROM.get(address, value);
-  return value;
+bool EEPROMManager::commit() {
+  if (!dirty) {
+    return false;
+  }
+  commitConfig();
+  Serial.println("Configuration committed.");
+  return true;
 }
 
-void EEPROMManager::saveWiFiCredentials() {
-  // Save each of the WiFi credentials into a fixed block.
-  for (int i = 0; i < NUM_WIFI_CREDENTIALS; i++) {
-    int baseAddress = WIFI_CREDENTIALS_START + i * CREDENTIAL_BLOCK_SIZE;
-    int ssidAddr = baseAddress;                       // First MAX_SSID_LENGTH bytes for SSID.
-    int passAddr = baseAddress + MAX_SSID_LENGTH;       // Next MAX_PASS_LENGTH bytes for password.
-    int rememberAddr = baseAddress + MAX_SSID_LENGTH + MAX_PASS_LENGTH; // 1 byte for remember flag.
-
-    writeStringToEEPROM(ssidAddr, wifiCredentials[i].ssid, MAX_SSID_LENGTH);
-    yield();
-    writeStringToEEPROM(passAddr, wifiCredentials[i].password, MAX_PASS_LENGTH);
-    yield();
-    EEPROM.write(rememberAddr, wifiCredentials[i].remember ? 1 : 0);
-    yield();
+void EEPROMManager::update() {
+  if (dirty && millis() - lastChangeMs >= CONFIG_COMMIT_DELAY) {
+    commit();
   }
-  // Write the last connected network index.
-  writeIntToEEPROM(LAST_CONNECTED_ADDRESS, lastConnectedNetworkIndex);
-  EEPROM.commit();
+}
+
+void EEPROMManager::saveWiFiCredentials() {
+  markDirty();
 }
 
 void EEPROMManager::loadWiFiCredentials() {
-  // Load each WiFi credential from its fixed block.
+  // Uncommitted changes are newer than anything in flash
+  if (dirty || !readNewestSlot(storedConfig)) {
+    return;
+  }
+
   for (int i = 0; i < NUM_WIFI_CREDENTIALS; i++) {
-    int baseAddress = WIFI_CREDENTIALS_START + i * CREDENTIAL_BLOCK_SIZE;
-    int ssidAddr = baseAddress;
-    int passAddr = baseAddress + MAX_SSID_LENGTH;
-    int rememberAddr = baseAddress + MAX_SSID_LENGTH + MAX_PASS_LENGTH;
-
-    wifiCredentials[i].ssid = readStringFromEEPROM(ssidAddr, MAX_SSID_LENGTH);
-    yield();
-    wifiCredentials[i].password = readStringFromEEPROM(passAddr, MAX_PASS_LENGTH);
-    yield();
-    wifiCredentials[i].remember = (EEPROM.read(rememberAddr) == 1);
-    yield();
+    assignField(wifiCredentials[i].ssid, storedConfig.wifiCredentials[i].ssid, MAX_SSID_LENGTH);
+    assignField(wifiCredentials[i].password, storedConfig.wifiCredentials[i].password, MAX_PASS_LENGTH);
+    wifiCredentials[i].remember = storedConfig.wifiCredentials[i].remember == 1;
   }
-  lastConnectedNetworkIndex = readIntFromEEPROM(LAST_CONNECTED_ADDRESS, -1);
+  lastConnectedNetworkIndex = storedConfig.lastConnectedNetworkIndex;
 }
 
 void EEPROMManager::clearEntireEEPROM() {
-  // Overwrite every byte in the EEPROM with 0.
-  for (int addr = 0; addr < EEPROM_SIZE; addr++) {
-    EEPROM.write(addr, 0);
-  }
+  // Legacy area and both slots in one commit
+  memset(EEPROM.getDataPtr(), 0, EEPROM_SIZE);
   EEPROM.commit();
   Serial.println("✅ Entire EEPROM cleared.");
   
-  // Reset default values
-  soundTCPServerIP = "";
-  soundTCPServerPort = 12345;
-  lightTCPServerIP = "";
-  lightTCPServerPort = 12345;
-  soundMQTTServerURL = "";
-  soundMQTTServerPort = 8883;
-  soundMQTTUsername = "";
-  soundMQTTPassword = "";
-  lightMQTTServerURL = "";
-  lightMQTTServerPort = 8883;
-  lightMQTTUsername = "";
-  lightMQTTPassword = "";
-  deviceName = "ESP32Device";
-  
-  // Reset static IP configuration
-  staticIPEnabled = false;
-  staticIP = "192.168.4.1";
-  staticGateway = "192.168.4.1";
-  staticSubnet = "255.255.255.0";
-  staticDNS1 = "8.8.8.8";
-  staticDNS2 = "8.8.4.4";
-  
-  for (int i = 0; i < NUM_WIFI_CREDENTIALS; i++) {
-    wifiCredentials[i].ssid = "";
-    wifiCredentials[i].password = "";
-    wifiCredentials[i].remember = false;
+  activeSlot = -1;
+  configSequence = 0;
+  dirty = false;
+  setDefaults();
+}
+
+void EEPROMManager::getValue(const ConfigKey& key, char* buffer, size_t size) {
+  const uint8_t* field = reinterpret_cast<const uint8_t*>(&storedConfig) + key.offset;
+
+  switch (key.type) {
+    case CONFIG_STRING: {
+      if (key.secret) {
+        snprintf(buffer, size, "********");
+        break;
+      }
+      size_t len = strnlen(reinterpret_cast<const char*>(field), key.maxLength);
+      if (len > size - 1) len = size - 1;
+      memcpy(buffer, field, len);
+      buffer[len] = 0;
+      break;
+    }
+    case CONFIG_INT: {
+      int32_t value;
+      memcpy(&value, field, sizeof(value));
+      snprintf(buffer, size, "%ld", (long)value);
+      break;
+    }
+    case CONFIG_INT8:
+      snprintf(buffer, size, "%d", (int)(int8_t)*field);
+      break;
+    case CONFIG_BOOL:
+      snprintf(buffer, size, "%s", *field ? "Yes" : "No");
+      break;
   }
-  lastConnectedNetworkIndex = -1;
+}
+
+bool EEPROMManager::setValue(const ConfigKey& key, const char* value) {
+  // Parse and validate before touching anything
+  long number = 0;
+  if (key.type == CONFIG_STRING) {
+    if (strlen(value) >= key.maxLength) {
+      return false;
+    }
+  } else if (key.type == CONFIG_BOOL) {
+    if (!parseBool(value, number)) {
+      return false;
+    }
+  } else {
+    char* end;
+    number = strtol(value, &end, 10);
+    if (end == value || *end != 0) {
+      return false;
+    }
+    if (key.type == CONFIG_INT8 && (number < INT8_MIN || number > INT8_MAX)) {
+      return false;
+    }
+  }
+  if (key.validator && !key.validator(value, number)) {
+    return false;
+  }
+
+  // Write the field into the current config, then reload the members from it
+  packConfig(storedConfig);
+  uint8_t* field = reinterpret_cast<uint8_t*>(&storedConfig) + key.offset;
+  switch (key.type) {
+    case CONFIG_STRING:
+      memset(field, 0, key.maxLength);
+      memcpy(field, value, strlen(value));
+      break;
+    case CONFIG_INT: {
+      int32_t stored = number;
+      memcpy(field, &stored, sizeof(stored));
+      break;
+    }
+    case CONFIG_INT8:
+      *field = (uint8_t)(int8_t)number;
+      break;
+    case CONFIG_BOOL:
+      *field = number ? 1 : 0;
+      break;
+  }
+  unpackConfig(storedConfig);
+
+  markDirty();
+  return true;
 }
 
 // New configuration methods
 void EEPROMManager::saveSoundTCPServer(const String& ip, int port) {
-  writeStringToEEPROM(SOUND_TCP_SERVER_IP_ADDRESS, ip, MAX_IP_LENGTH);
-  writeIntToEEPROM(SOUND_TCP_SERVER_PORT_ADDRESS, port);
   soundTCPServerIP = ip;
   soundTCPServerPort = port;
-  EEPROM.commit();
+  markDirty();
   Serial.println("Sound TCP Server configuration saved.");
 }
 
 void EEPROMManager::saveLightTCPServer(const String& ip, int port) {
-  writeStringToEEPROM(LIGHT_TCP_SERVER_IP_ADDRESS, ip, MAX_IP_LENGTH);
-  writeIntToEEPROM(LIGHT_TCP_SERVER_PORT_ADDRESS, port);
   lightTCPServerIP = ip;
   lightTCPServerPort = port;
-  EEPROM.commit();
+  markDirty();
   Serial.println("Light TCP Server configuration saved.");
 }
 
 void EEPROMManager::saveSoundMQTTServer(const String& url, int port, const String& username, const String& password) {
-  writeStringToEEPROM(SOUND_MQTT_SERVER_URL_ADDRESS, url, MAX_URL_LENGTH);
-  writeIntToEEPROM(SOUND_MQTT_SERVER_PORT_ADDRESS, port);
-  writeStringToEEPROM(SOUND_MQTT_SERVER_USERNAME_ADDRESS, username, MAX_USERNAME_LENGTH);
-  writeStringToEEPROM(SOUND_MQTT_SERVER_PASSWORD_ADDRESS, password, MAX_PASS_LENGTH);
-  
   soundMQTTServerURL = url;
   soundMQTTServerPort = port;
   soundMQTTUsername = username;
   soundMQTTPassword = password;
   
-  EEPROM.commit();
+  markDirty();
   Serial.println("Sound MQTT Server configuration saved.");
 }
 
 void EEPROMManager::saveLightMQTTServer(const String& url, int port, const String& username, const String& password) {
-  writeStringToEEPROM(LIGHT_MQTT_SERVER_URL_ADDRESS, url, MAX_URL_LENGTH);
-  writeIntToEEPROM(LIGHT_MQTT_SERVER_PORT_ADDRESS, port);
-  writeStringToEEPROM(LIGHT_MQTT_SERVER_USERNAME_ADDRESS, username, MAX_USERNAME_LENGTH);
-  writeStringToEEPROM(LIGHT_MQTT_SERVER_PASSWORD_ADDRESS, password, MAX_PASS_LENGTH);
-  
   lightMQTTServerURL = url;
   lightMQTTServerPort = port;
   lightMQTTUsername = username;
   lightMQTTPassword = password;
   
-  EEPROM.commit();
+  markDirty();
   Serial.println("Light MQTT Server configuration saved.");
 }
 
 void EEPROMManager::saveDeviceName(const String& name) {
-  writeStringToEEPROM(DEVICE_NAME_ADDRESS, name, MAX_DEVICE_NAME_LENGTH);
   deviceName = name;
-  EEPROM.commit();
+  markDirty();
   Serial.println("Device name saved: " + name);
 }
 
 // Save static IP configuration (new)
 void EEPROMManager::saveStaticIPConfig(bool enabled, const String& ip, const String& gateway, 
                                       const String& subnet, const String& dns1, const String& dns2) {
-  EEPROM.write(STATIC_IP_ENABLED_ADDRESS, enabled ? 1 : 0);
-  writeStringToEEPROM(STATIC_IP_ADDRESS, ip, MAX_IP_LENGTH);
-  writeStringToEEPROM(STATIC_GATEWAY_ADDRESS, gateway, MAX_IP_LENGTH);
-  writeStringToEEPROM(STATIC_SUBNET_ADDRESS, subnet, MAX_IP_LENGTH);
-  writeStringToEEPROM(STATIC_DNS1_ADDRESS, dns1, MAX_IP_LENGTH);
-  writeStringToEEPROM(STATIC_DNS2_ADDRESS, dns2, MAX_IP_LENGTH);
-  
   staticIPEnabled = enabled;
   staticIP = ip;
   staticGateway = gateway;
@@ -224,7 +416,7 @@ void EEPROMManager::saveStaticIPConfig(bool enabled, const String& ip, const Str
   staticDNS1 = dns1;
   staticDNS2 = dns2;
   
-  EEPROM.commit();
+  markDirty();
   Serial.println("Static IP configuration saved:");
   Serial.println("  Enabled: " + String(enabled ? "Yes" : "No"));
   Serial.println("  IP: " + ip);
@@ -234,15 +426,28 @@ void EEPROMManager::saveStaticIPConfig(bool enabled, const String& ip, const Str
   Serial.println("  DNS2: " + dns2);
 }
 
-// Load static IP configuration (new)
-void EEPROMManager::loadStaticIPConfig() {
-  staticIPEnabled = (EEPROM.read(STATIC_IP_ENABLED_ADDRESS) == 1);
-  staticIP = readStringFromEEPROM(STATIC_IP_ADDRESS, MAX_IP_LENGTH);
-  staticGateway = readStringFromEEPROM(STATIC_GATEWAY_ADDRESS, MAX_IP_LENGTH);
-  staticSubnet = readStringFromEEPROM(STATIC_SUBNET_ADDRESS, MAX_IP_LENGTH);
-  staticDNS1 = readStringFromEEPROM(STATIC_DNS1_ADDRESS, MAX_IP_LENGTH);
-  staticDNS2 = readStringFromEEPROM(STATIC_DNS2_ADDRESS, MAX_IP_LENGTH);
+void EEPROMManager::saveWiFiCache(const WiFiConnectCache& cache) {
+  // Reconnects to the same AP are common - skip the flash write when nothing changed
+  if (memcmp(&cache, &wifiCache, sizeof(cache)) == 0) {
+    return;
+  }
+  
+  wifiCache = cache;
+  markDirty();
+  Serial.println("WiFi fast reconnect cache saved.");
+}
+
+void EEPROMManager::clearWiFiCache() {
+  if (wifiCache.magic == 0) {
+    return;
+  }
   
+  memset(&wifiCache, 0, sizeof(wifiCache));
+  markDirty();
+}
+
+// Check the loaded static IP configuration (new)
+void EEPROMManager::loadStaticIPConfig() {
   // If any values are empty, set defaults
   if (staticIP.isEmpty()) staticIP = "192.168.4.1";
   if (staticGateway.isEmpty()) staticGateway = "192.168.4.1";
@@ -259,17 +464,27 @@ void EEPROMManager::loadStaticIPConfig() {
   Serial.println("  DNS2: " + staticDNS2);
 }
 
-void EEPROMManager::loadAllConfigurations() {
-  // Load WiFi credentials
-  loadWiFiCredentials();
+bool EEPROMManager::hasLegacyConfiguration() {
+  // Old firmware always stored a device name, so a printable first byte means
+  // the legacy map is in use. Fresh (zeroed or erased) EEPROM fails this.
+  uint8_t first = EEPROM.read(DEVICE_NAME_ADDRESS);
+  return first >= 0x20 && first < 0x7F;
+}
+
+void EEPROMManager::loadLegacyConfiguration() {
+  for (int i = 0; i < NUM_WIFI_CREDENTIALS; i++) {
+    int baseAddress = WIFI_CREDENTIALS_START + i * CREDENTIAL_BLOCK_SIZE;
+    wifiCredentials[i].ssid = readStringFromEEPROM(baseAddress, MAX_SSID_LENGTH);
+    wifiCredentials[i].password = readStringFromEEPROM(baseAddress + MAX_SSID_LENGTH, MAX_PASS_LENGTH);
+    wifiCredentials[i].remember = (EEPROM.read(baseAddress + MAX_SSID_LENGTH + MAX_PASS_LENGTH) == 1);
+  }
+  lastConnectedNetworkIndex = readIntFromEEPROM(LAST_CONNECTED_ADDRESS, -1);
   
-  // Load TCP Server configurations
   soundTCPServerIP = readStringFromEEPROM(SOUND_TCP_SERVER_IP_ADDRESS, MAX_IP_LENGTH);
   soundTCPServerPort = readIntFromEEPROM(SOUND_TCP_SERVER_PORT_ADDRESS, 12345);
   lightTCPServerIP = readStringFromEEPROM(LIGHT_TCP_SERVER_IP_ADDRESS, MAX_IP_LENGTH);
   lightTCPServerPort = readIntFromEEPROM(LIGHT_TCP_SERVER_PORT_ADDRESS, 12345);
   
-  // Load MQTT Server configurations
   soundMQTTServerURL = readStringFromEEPROM(SOUND_MQTT_SERVER_URL_ADDRESS, MAX_URL_LENGTH);
   soundMQTTServerPort = readIntFromEEPROM(SOUND_MQTT_SERVER_PORT_ADDRESS, 8883);
   soundMQTTUsername = readStringFromEEPROM(SOUND_MQTT_SERVER_USERNAME_ADDRESS, MAX_USERNAME_LENGTH);
@@ -280,17 +495,59 @@ void EEPROMManager::loadAllConfigurations() {
   lightMQTTUsername = readStringFromEEPROM(LIGHT_MQTT_SERVER_USERNAME_ADDRESS, MAX_USERNAME_LENGTH);
   lightMQTTPassword = readStringFromEEPROM(LIGHT_MQTT_SERVER_PASSWORD_ADDRESS, MAX_PASS_LENGTH);
   
-  // Load device name
   deviceName = readStringFromEEPROM(DEVICE_NAME_ADDRESS, MAX_DEVICE_NAME_LENGTH);
+  
+  staticIPEnabled = (EEPROM.read(STATIC_IP_ENABLED_ADDRESS) == 1);
+  staticIP = readStringFromEEPROM(STATIC_IP_ADDRESS, MAX_IP_LENGTH);
+  staticGateway = readStringFromEEPROM(STATIC_GATEWAY_ADDRESS, MAX_IP_LENGTH);
+  staticSubnet = readStringFromEEPROM(STATIC_SUBNET_ADDRESS, MAX_IP_LENGTH);
+  staticDNS1 = readStringFromEEPROM(STATIC_DNS1_ADDRESS, MAX_IP_LENGTH);
+  staticDNS2 = readStringFromEEPROM(STATIC_DNS2_ADDRESS, MAX_IP_LENGTH);
+  
+  EEPROM.get(WIFI_CACHE_ADDRESS, wifiCache);
+}
+
+String EEPROMManager::readStringFromEEPROM(int address, int maxLength) {
+  String s = "";
+  for (int i = 0; i < maxLength; i++) {
+    char c = EEPROM.read(address + i);
+    if (c == 0) break;  // End of string.
+    s += c;
+  }
+  return s;
+}
+
+int EEPROMManager::readIntFromEEPROM(int address, int defaultValue) {
+  int value = defaultValue;
+  EEPROM.get(address, value);
+  return value;
+}
+
+void EEPROMManager::loadAllConfigurations() {
+  if (readNewestSlot(storedConfig)) {
+    unpackConfig(storedConfig);
+    Serial.printf("Configuration loaded from slot %c (revision %lu).\n",
+                  activeSlot == CONFIG_SLOT_A_ADDRESS ? 'A' : 'B', (unsigned long)configSequence);
+  } else if (hasLegacyConfiguration()) {
+    loadLegacyConfiguration();
+    
+    // Retire the old map in the same commit, so a later loss of both slots
+    // can't bring back stale settings
+    memset(EEPROM.getDataPtr(), 0, LEGACY_CONFIG_SIZE);
+    commitConfig();
+    Serial.println("✅ Configuration migrated from the legacy EEPROM layout.");
+  } else {
+    setDefaults();
+    commitConfig();
+    Serial.println("No stored configuration, defaults saved.");
+  }
+  
   if (deviceName.isEmpty()) {
     deviceName = "ESP32Device"; // Default name if not set
-    
-    // Save the default name to EEPROM for next time
-    writeStringToEEPROM(DEVICE_NAME_ADDRESS, deviceName, MAX_DEVICE_NAME_LENGTH);
-    EEPROM.commit();
+    commitConfig();
   }
   
-  // Load static IP configuration
+  // Fill in defaults for unset static IP fields
   loadStaticIPConfig();
   
   Serial.println("All configurations loaded.");
@@ -0,0 +1,94 @@
+#include "EventTrace.h"
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+
+static_assert((TRACE_PSRAM_RECORDS & (TRACE_PSRAM_RECORDS - 1)) == 0, "TRACE_PSRAM_RECORDS must be a power of two");
+static_assert((TRACE_INTERNAL_RECORDS & (TRACE_INTERNAL_RECORDS - 1)) == 0, "TRACE_INTERNAL_RECORDS must be a power of two");
+
+TraceRecord* EventTrace::ring = nullptr;
+uint32_t EventTrace::capacity = 0;
+std::atomic<uint32_t> EventTrace::head(0);
+std::atomic<bool> EventTrace::enabled(false);
+bool EventTrace::inPSRAM = false;
+
+static const char base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+bool EventTrace::begin() {
+  if (ring) return true;
+
+  // PSRAM is slower than internal RAM but the writes are sparse, and it
+  // leaves the internal heap to the network stack
+  if (psramFound()) {
+    ring = (TraceRecord*)heap_caps_malloc(TRACE_PSRAM_RECORDS * sizeof(TraceRecord), MALLOC_CAP_SPIRAM);
+    if (ring) {
+      capacity = TRACE_PSRAM_RECORDS;
+      inPSRAM = true;
+    }
+  }
+  if (!ring) {
+    ring = (TraceRecord*)malloc(TRACE_INTERNAL_RECORDS * sizeof(TraceRecord));
+    capacity = ring ? TRACE_INTERNAL_RECORDS : 0;
+  }
+  if (!ring) {
+    Serial.println("[Trace] Could not allocate the trace ring, tracing disabled");
+    return false;
+  }
+
+  head.store(0, std::memory_order_relaxed);
+  enabled.store(true, std::memory_order_release);
+  return true;
+}
+
+void EventTrace::write(TraceRecordType type, TraceEvent event, uint32_t arg) {
+  // Claim a slot - overwriting the oldest record once the ring has wrapped
+  uint32_t position = head.fetch_add(1, std::memory_order_relaxed);
+  TraceRecord& record = ring[position & (capacity - 1)];
+  record.timestamp = (uint32_t)esp_timer_get_time();
+  record.task = (uint32_t)(uintptr_t)xTaskGetCurrentTaskHandle();
+  record.arg = arg;
+  record.event = event;
+  record.type = type;
+  record.core = (uint8_t)xPortGetCoreID();
+}
+
+void EventTrace::setEnabled(bool enable) {
+  enabled.store(enable && ring != nullptr, std::memory_order_release);
+}
+
+void EventTrace::clear() {
+  head.store(0, std::memory_order_relaxed);
+}
+
+void EventTrace::getRange(uint32_t& first, uint32_t& end) {
+  end = head.load(std::memory_order_acquire);
+  first = end > capacity ? end - capacity : 0;
+}
+
+size_t EventTrace::encodeRecords(uint32_t first, uint32_t count, char* out, size_t outSize) {
+  if (!ring || count == 0) return 0;
+
+  // Copy out first - the records may wrap around the end of the ring
+  uint8_t bytes[TRACE_DUMP_RECORDS_PER_LINE * sizeof(TraceRecord)];
+  if (count > TRACE_DUMP_RECORDS_PER_LINE) count = TRACE_DUMP_RECORDS_PER_LINE;
+  for (uint32_t i = 0; i < count; i++) {
+    memcpy(bytes + i * sizeof(TraceRecord), &ring[(first + i) & (capacity - 1)], sizeof(TraceRecord));
+  }
+
+  return encodeBase64(bytes, count * sizeof(TraceRecord), out, outSize);
+}
+
+size_t EventTrace::encodeBase64(const uint8_t* bytes, size_t byteCount, char* out, size_t outSize) {
+  size_t length = 0;
+  for (size_t i = 0; i < byteCount && length + 4 < outSize; i += 3) {
+    uint32_t chunk = (uint32_t)bytes[i] << 16;
+    if (i + 1 < byteCount) chunk |= (uint32_t)bytes[i + 1] << 8;
+    if (i + 2 < byteCount) chunk |= bytes[i + 2];
+
+    out[length++] = base64Alphabet[(chunk >> 18) & 0x3F];
+    out[length++] = base64Alphabet[(chunk >> 12) & 0x3F];
+    out[length++] = i + 1 < byteCount ? base64Alphabet[(chunk >> 6) & 0x3F] : '=';
+    out[length++] = i + 2 < byteCount ? base64Alphabet[chunk & 0x3F] : '=';
+  }
+  out[length] = 0;
+  return length;
+}
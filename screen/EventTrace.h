@@ -0,0 +1,82 @@
+#ifndef EVENT_TRACE_H
+#define EVENT_TRACE_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "TraceFormat.h"
+
+// Ring size - must be powers of two
+#define TRACE_PSRAM_RECORDS 16384         // 256 KB ring when PSRAM is present
+#define TRACE_INTERNAL_RECORDS 512        // 8 KB fallback in internal RAM
+#define TRACE_DUMP_RECORDS_PER_LINE 32    // Records per base64 line of a dump
+
+/**
+ * Always-on binary event tracer, the flight recorder for UI freezes.
+ *
+ * Each event is one fixed 16-byte TraceRecord (see TraceFormat.h) written
+ * into a ring in PSRAM: a producer claims a slot with one atomic increment
+ * and fills it in place, so tracing never blocks and can be called from any
+ * task. The oldest records are overwritten once the ring is full. Records
+ * carry the recording task and core, so spans nest per task.
+ *
+ * The trace command pauses recording and streams the ring over TCP as
+ * base64 lines; host/tools/trace2chrome turns a captured dump into Chrome
+ * trace JSON (chrome://tracing, Perfetto).
+ *
+ * Use TRACE_SPAN(event) for a scope, TRACE_INSTANT/TRACE_COUNTER for points.
+ */
+class EventTrace {
+public:
+  static bool begin();                                  // Allocate the ring and start recording
+
+  static void record(TraceRecordType type, TraceEvent event, uint32_t arg = 0) {
+    if (enabled.load(std::memory_order_relaxed)) {
+      write(type, event, arg);
+    }
+  }
+
+  static void setEnabled(bool enable);
+  static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+  static void clear();                                  // Drop all records (call while paused)
+
+  static uint32_t getCapacity() { return capacity; }
+  static uint32_t getRecordCount() { return head.load(std::memory_order_relaxed); } // Since clear, may exceed capacity
+  static bool isInPSRAM() { return inPSRAM; }
+
+  // Dump support - pause recording first. Positions are absolute; the
+  // records still in the ring are [first, end).
+  static void getRange(uint32_t& first, uint32_t& end);
+  static size_t encodeRecords(uint32_t first, uint32_t count, char* out, size_t outSize); // base64, returns length
+  static size_t encodeBase64(const uint8_t* bytes, size_t byteCount, char* out, size_t outSize); // Also used by the capture dump
+
+private:
+  static TraceRecord* ring;
+  static uint32_t capacity;
+  static std::atomic<uint32_t> head;                    // Next position to claim
+  static std::atomic<bool> enabled;
+  static bool inPSRAM;
+
+  static void write(TraceRecordType type, TraceEvent event, uint32_t arg);
+};
+
+// Records BEGIN on construction and END when the scope closes
+class TraceSpan {
+public:
+  explicit TraceSpan(TraceEvent event) : event(event), result(0) { EventTrace::record(TRACE_BEGIN, event); }
+  ~TraceSpan() { EventTrace::record(TRACE_END, event, result); }
+  void setResult(uint32_t value) { result = value; }    // arg of the END record
+
+private:
+  TraceEvent event;
+  uint32_t result;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SPAN(event) TraceSpan TRACE_CONCAT(traceSpan, __LINE__)(event)
+#define TRACE_BEGIN_EVENT(event) EventTrace::record(TRACE_BEGIN, event)
+#define TRACE_END_EVENT(event, arg) EventTrace::record(TRACE_END, event, arg)
+#define TRACE_INSTANT(event, arg) EventTrace::record(TRACE_INSTANT, event, arg)
+#define TRACE_COUNTER(event, value) EventTrace::record(TRACE_COUNTER, event, value)
+
+#endif // EVENT_TRACE_H
@@ -1,11 +1,32 @@
 #include "InfoScreen.h"
+#include "AntiAlias.h"
+#include "StateBroadcaster.h"
 #include <math.h>
 
 InfoScreen::InfoScreen(Arduino_GFX* graphics, TouchPanel* touch, WiFiTCPClient* client)
   : gfx(graphics), touchPanel(touch), tcpClient(client),
     screenInitialized(false), pageBackRequested(false),
-    currentDate("--/--"), currentTime("--:--"), lastDisplayedTime(""),
-    lastUpdateTime(0), lastActivityTime(0), inactivityTimeoutReached(false) {
+    clock(ClockSnapshot::unknown()),
+    lastUpdateTime(0), lastActivityTime(0), inactivityTimeoutReached(false),
+    temperatureArcs(graphics, drawTemperatureIcon, this), hoursLabel(graphics), colonLabel(graphics),
+    minutesLabel(graphics), dayLabel(graphics), dateLabel(graphics),
+    wifiStatus(graphics, drawWiFiStatus, this), widgets(graphics) {
+
+  formatDate();
+
+  hoursLabel.setTextSize(3);
+  colonLabel.setTextSize(3);
+  colonLabel.setText(":");
+  minutesLabel.setTextSize(3);
+  dayLabel.setTextSize(2);
+  dateLabel.setTextSize(2);
+  widgets.add(&temperatureArcs);
+  widgets.add(&hoursLabel);
+  widgets.add(&colonLabel);
+  widgets.add(&minutesLabel);
+  widgets.add(&dayLabel);
+  widgets.add(&dateLabel);
+  widgets.add(&wifiStatus);
 
   // Initialize animation state.
   // We use the final target angles immediately at startup.
@@ -21,8 +42,6 @@ InfoScreen::InfoScreen(Arduino_GFX* graphics, TouchPanel* touch, WiFiTCPClient*
   // Initialize colon blinking
   lastColonToggleTime = millis();
   colonVisible = true;
-  colonX = 0;  // Will be set when time is first drawn
-  colonY = 0;  // Will be set when time is first drawn
 }
 
 void InfoScreen::setTCPClient(WiFiTCPClient* client) {
@@ -31,45 +50,26 @@ void InfoScreen::setTCPClient(WiFiTCPClient* client) {
 
 void InfoScreen::update() {
   unsigned long currentMillis = millis();
-  // Fetch and update time
-  String newDate = tcpClient->getCurrentDate();
-  String newTime = tcpClient->getCurrentTime();
-  String newDayOfWeek = tcpClient->getDayOfWeek();  // Get day of week from client
-
-  // Check if time, date, or day of week has changed
-  if (newDate != currentDate || newTime != currentTime || newDayOfWeek != currentDayOfWeek) {
-    currentDate = newDate;
-    currentTime = newTime;
-    currentDayOfWeek = newDayOfWeek;
-    formatDate();
+  // Fetch and update time (no client yet while networking resumes after deep sleep)
+  ClockSnapshot newClock = clock;
+  if (tcpClient) {
+    tcpClient->getClock(newClock);
+  }
 
-    if (formattedDate != lastFormattedDate || currentTime != lastFormattedTime) {
-      lastFormattedDate = formattedDate;
-      lastFormattedTime = currentTime;
-      dateTimeChanged = true;
-    }
+  // Labels only repaint the parts of the date and time that changed
+  if (newClock != clock) {
+    clock = newClock;
+    formatDate();
+    showDateTime();
   }
 
-  // Check if we need to update just the colon
+  // Blink the colon - only its own cell is repainted
   if (currentMillis - lastColonToggleTime >= COLON_BLINK_INTERVAL) {
     colonVisible = !colonVisible;
     lastColonToggleTime = currentMillis;
-
-    // Only update the colon, not the entire time display
-    if (colonX > 0) {  // Make sure we have valid coordinates
-      drawColonOnly();
-    } else {
-      // If we don't have colon coordinates yet, we need to redraw the whole time
-      dateTimeChanged = true;
-    }
+    colonLabel.setVisible(colonVisible);
   }
 
-  // Reset change flags
-  indoorTempChanged = false;
-  outdoorTempChanged = false;
-  networkStatusChanged = false;
-  // Note: We don't reset dateTimeChanged here as it might have been set previously
-
   // Update network status
   updateNetworkStatus();
 
@@ -83,44 +83,42 @@ void InfoScreen::update() {
   // Update time and temperature data if internet is available and it's time to update
   if (tcpClient && tcpClient->isInternetAvailable() && (currentMillis - lastUpdateTime >= UPDATE_INTERVAL)) {
     // Fetch outdoor temperature
-    String newWeatherTemp = tcpClient->getWeatherTemperature();
-    // Parse temperature value
     float newOutdoorTemp = 0.0f;
-    int tempEnd = newWeatherTemp.indexOf('°');
-    if (tempEnd > 0) {
-      newOutdoorTemp = newWeatherTemp.substring(0, tempEnd).toFloat();
+    if (!tcpClient->getOutdoorTemperature(newOutdoorTemp)) {
+      newOutdoorTemp = 0.0f;
     }
 
     // Check if outdoor temperature has changed
     if (abs(newOutdoorTemp - outdoorTemp) > 0.5f) {
       outdoorTemp = newOutdoorTemp;
-      outdoorTempChanged = true;
+      setTemperatureTargets(true);
+      StateBroadcaster::getInstance()->publishTemperature(STATE_OUTDOOR_TEMP, outdoorTemp);
     }
 
     lastUpdateTime = currentMillis;
   }
 
+  // The arcs are redrawn every frame while they grow
+  if (arcAnimating) {
+    temperatureArcs.invalidate();
+    arcAnimating = currentMillis - arcAnimationStartTime < ANIMATION_DURATION;
+  }
+
   // Full screen redraw on initialization
   if (!screenInitialized) {
-    gfx->fillScreen(BLACK);
+    int width = gfx->width();
+    int height = gfx->height();
+    temperatureArcs.setBounds(0, 0, width, height);
+    temperatureArcs.setHole(width / 2, height / 2, min(width, height) / 2 - 2 * ARC_THICKNESS - 5);
+    wifiStatus.setBounds(width / 2 - 20, height - 40, 40, 40);
+    colonLabel.setVisible(colonVisible);
+    showDateTime();
     // On first startup, bypass animation (draw final arc lengths)
-    drawDateTime();
-    drawWiFiStatus();
-    drawTemperatureArcs();
+    setTemperatureTargets(false);
+    widgets.begin();
     screenInitialized = true;
-  } else {
-    // Update only those elements that changed
-    if (indoorTempChanged || outdoorTempChanged) {
-      drawTemperatureArcs();
-    }
-    if (dateTimeChanged) {
-      drawDateTime();
-      dateTimeChanged = false;  // Reset flag after drawing
-    }
-    if (networkStatusChanged) {
-      drawWiFiStatus();
-    }
   }
+  widgets.render();
 
   // Check for touch events
   if (touchPanel && touchPanel->getHasNewPress()) {
@@ -133,31 +131,19 @@ void InfoScreen::update() {
 
 void InfoScreen::formatDate() {
   // Parse YYYY/MM/DD format
-  int firstSlash = currentDate.indexOf('/');
-  int secondSlash = currentDate.indexOf('/', firstSlash + 1);
-
-  if (firstSlash > 0 && secondSlash > 0) {
-    String yearStr = currentDate.substring(0, firstSlash);
-    String monthStr = currentDate.substring(firstSlash + 1, secondSlash);
-    String dayStr = currentDate.substring(secondSlash + 1);
-
-    // Remove leading zeros from day
-    while (dayStr.length() > 1 && dayStr[0] == '0') {
-      dayStr = dayStr.substring(1);
-    }
-
-    // Get month name
-    int monthNum = monthStr.toInt();
-    String monthName = getMonthName(monthNum);
-
+  int year, month, day;
+  if (sscanf(clock.date, "%d/%d/%d", &year, &month, &day) == 3) {
     // Format as "17 MONTH" - e.g., "17 MAR" (day of week will be displayed separately)
-    formattedDate = dayStr + " " + monthName;
+    snprintf(formattedDate, sizeof(formattedDate), "%d %s", day, getMonthName(month));
+  } else if (clock.date[4] == '/' && clock.date[7] == '/') {
+    // Placeholder date - keep the "DD MMM" layout
+    snprintf(formattedDate, sizeof(formattedDate), "%.2s ---", clock.date + 8);
   } else {
-    formattedDate = currentDate;  // Fallback if date format is unexpected
+    strcpy(formattedDate, clock.date);  // Fallback if date format is unexpected
   }
 }
 
-String InfoScreen::getMonthName(int month) {
+const char* InfoScreen::getMonthName(int month) {
   const char* months[] = { "JAN", "FEB", "MAR", "APR", "MAY", "JUN",
                            "JUL", "AUG", "SEP", "OCT", "NOV", "DEC" };
 
@@ -167,89 +153,73 @@ String InfoScreen::getMonthName(int month) {
   return "---";
 }
 
-// New method to only draw the colon part of the time
-void InfoScreen::drawColonOnly() {
-  // We only need to draw a small area where the colon is
-  int colonWidth = 10;   // Width of the colon area
-  int colonHeight = 18;  // Height of the colon area (for text size 3)
-
-  // Black out the colon area
-  gfx->fillRect(colonX, colonY, colonWidth, colonHeight, BLACK);
-
-  // If colon should be visible, redraw it
-  if (colonVisible) {
-    gfx->setTextColor(WHITE);
-    gfx->setTextSize(3);
-    gfx->setCursor(colonX, colonY);
-    gfx->print(":");
-  }
-}
-
-// Updated to implement blinking colon and track colon position
-void InfoScreen::drawDateTime() {
+// Time, day and date in the middle of the arcs; the colon blinks in a label of its own
+void InfoScreen::showDateTime() {
   int centerX = gfx->width() / 2;
   int centerY = gfx->height() / 2;
 
-  // Calculate required radius for our text content
-  // This should be enough to contain all three lines of text without overlapping the arcs
-  int clearRadius = 55;  // Adjust based on your testing
-
-  // Clear a circular area in the center instead of a rectangle
-  // This avoids drawing over the temperature arcs
-  gfx->fillCircle(centerX, centerY, clearRadius, BLACK);
-
-  // Draw time at the top, large size
-  gfx->setTextColor(WHITE);
-  gfx->setTextSize(3);
-
   // Find the colon position in the time string
-  int colonPos = currentTime.indexOf(':');
-  String hours = "";
-  String minutes = "";
-
-  if (colonPos > 0) {
-    hours = currentTime.substring(0, colonPos);
-    minutes = currentTime.substring(colonPos + 1);
+  char hours[sizeof(clock.time)];
+  const char* minutes = "";
+  const char* colon = strchr(clock.time, ':');
+
+  if (colon && colon > clock.time) {
+    memcpy(hours, clock.time, colon - clock.time);
+    hours[colon - clock.time] = 0;
+    minutes = colon + 1;
   } else {
     // Fallback if no colon is found
-    hours = currentTime;
-    minutes = "";
+    strcpy(hours, clock.time);
   }
 
   // Calculate the total width to center it
-  int timeWidth = (hours.length() + minutes.length() + 1) * 18;  // +1 for colon, 18 pixels per character at size 3
-  int timeX = centerX - timeWidth / 2;
+  int timeWidth = (strlen(hours) + strlen(minutes) + 1) * 18;  // +1 for colon, 18 pixels per character at size 3
   int timeY = centerY - 30;
+  int colonX = centerX - timeWidth / 2 + strlen(hours) * 18;
+
+  // Hours end at the colon, minutes start after its 18 pixel cell
+  hoursLabel.setText(hours);
+  hoursLabel.setAnchor(colonX, timeY, LABEL_RIGHT);
+  colonLabel.setAnchor(colonX, timeY, LABEL_LEFT);
+  minutesLabel.setText(minutes);
+  minutesLabel.setAnchor(colonX + 18, timeY, LABEL_LEFT);
+
+  // Day of week in the middle, date at the bottom
+  dayLabel.setText(clock.dayOfWeek);
+  dayLabel.setAnchor(centerX, centerY);
+  dateLabel.setText(formattedDate);
+  dateLabel.setAnchor(centerX, centerY + 25);
+}
 
-  // Draw hours
-  gfx->setCursor(timeX, timeY);
-  gfx->print(hours);
-
-  // Save the position right after hours for the colon
-  colonX = timeX + hours.length() * 18;
-  colonY = timeY;
+// Start the arcs towards the current temperatures, growing from the start or at once
+void InfoScreen::setTemperatureTargets(bool animate) {
+  float effectiveStart = fmod(ARC_START_ANGLE + 180.0f, 360.0f);
+  float effectiveEnd = fmod(ARC_END_ANGLE + 180.0f, 360.0f);
+  if (effectiveEnd < effectiveStart) {
+    effectiveEnd += 360.0f;
+  }
+  float arcSpan = effectiveEnd - effectiveStart;
 
-  // Draw colon if visible
-  if (colonVisible) {
-    gfx->setCursor(colonX, colonY);
-    gfx->print(":");
+  float normalizedIndoor = constrain((indoorTemp - 0.0f) / 40.0f, 0.0f, 1.0f);
+  targetIndoorAngle = effectiveStart + normalizedIndoor * arcSpan;
+  float normalizedOutdoor = constrain((outdoorTemp - (-20.0f)) / 70.0f, 0.0f, 1.0f);
+  targetOutdoorAngle = effectiveStart + normalizedOutdoor * arcSpan;
+
+  if (animate) {
+    // Both animations start from minimum and grow together
+    startIndoorAngle = effectiveStart;
+    startOutdoorAngle = effectiveStart;
+    arcAnimationStartTime = millis();
+    arcAnimating = true;
+  } else {
+    startIndoorAngle = targetIndoorAngle;
+    startOutdoorAngle = targetOutdoorAngle;
   }
+  temperatureArcs.invalidate();
+}
 
-  // Draw minutes
-  gfx->setCursor(colonX + 18, timeY);  // 18 pixels for the colon space
-  gfx->print(minutes);
-
-  // Draw day of week in the middle
-  gfx->setTextSize(2);
-  int dayWidth = currentDayOfWeek.length() * 12;  // Approximate width for size 2 text
-  gfx->setCursor(centerX - dayWidth / 2, centerY);
-  gfx->print(currentDayOfWeek);
-
-  // Draw date at the bottom
-  gfx->setTextSize(2);
-  int dateWidth = formattedDate.length() * 12;  // Approximate width for size 2 text
-  gfx->setCursor(centerX - dateWidth / 2, centerY + 25);
-  gfx->print(formattedDate);
+void InfoScreen::drawTemperatureIcon(Arduino_GFX* gfx, const WidgetRect& bounds, void* context) {
+  static_cast<InfoScreen*>(context)->drawTemperatureArcs();
 }
 
 void InfoScreen::drawTemperatureArcs() {
@@ -269,36 +239,10 @@ void InfoScreen::drawTemperatureArcs() {
   if (effectiveEnd < effectiveStart) {
     effectiveEnd += 360.0f;
   }
-  float arcSpan = effectiveEnd - effectiveStart;
-
-  // Compute target fill angles based on temperature values
-  float normalizedIndoor = constrain((indoorTemp - 0.0f) / 40.0f, 0.0f, 1.0f);
-  float newTargetIndoor = effectiveStart + normalizedIndoor * arcSpan;
-  float normalizedOutdoor = constrain((outdoorTemp - (-20.0f)) / 70.0f, 0.0f, 1.0f);
-  float newTargetOutdoor = effectiveStart + normalizedOutdoor * arcSpan;
 
+  // Targets are set by setTemperatureTargets()
   unsigned long currentMillis = millis();
 
-  // On first startup or if any temperature changes, reset animation
-  if (!screenInitialized || indoorTempChanged || outdoorTempChanged) {
-    // For initial display, we can bypass animation
-    if (!screenInitialized) {
-      animatedIndoorAngle = newTargetIndoor;
-      animatedOutdoorAngle = newTargetOutdoor;
-    } else {
-      // Not initial display, so we need to animate
-      // Both animations start from minimum and grow together
-      startIndoorAngle = effectiveStart;
-      startOutdoorAngle = effectiveStart;
-      // Reset animation time
-      arcAnimationStartTime = currentMillis;
-    }
-
-    // Update target angles regardless
-    targetIndoorAngle = newTargetIndoor;
-    targetOutdoorAngle = newTargetOutdoor;
-  }
-
   // Calculate animation progress
   float progress = constrain((float)(currentMillis - arcAnimationStartTime) / (float)ANIMATION_DURATION, 0.0f, 1.0f);
 
@@ -311,77 +255,51 @@ void InfoScreen::drawTemperatureArcs() {
   uint16_t outdoorColor = getTemperatureColor(outdoorTemp, false);
   uint16_t bgColor = gfx->color565(30, 30, 30);
 
-  // Calculate the cap radius as half the arc thickness
+  // Points here are centre - r·(cos, sin): Arduino_GFX angles are 180° on
+  float trackStart = effectiveStart + 180.0f;
+  float trackEnd = effectiveEnd + 180.0f;
+  float indoorEnd = constrain(animatedIndoorAngle, effectiveStart, effectiveEnd) + 180.0f;
+  float outdoorEnd = constrain(animatedOutdoorAngle, effectiveStart, effectiveEnd) + 180.0f;
+
+  // Each ring: the filled part, then the rest of the track, with smoothed edges
+  // (outer radius - 1 keeps the ring ARC_THICKNESS wide, as the triangles drew it)
+  if (indoorEnd > trackStart) {
+    AntiAlias::fillArc(gfx, centerX, centerY, indoorOuterRadius - 1, indoorInnerRadius, trackStart, indoorEnd, indoorColor, BLACK);
+  }
+  if (indoorEnd < trackEnd) {
+    AntiAlias::fillArc(gfx, centerX, centerY, indoorOuterRadius - 1, indoorInnerRadius, indoorEnd, trackEnd, bgColor, BLACK);
+  }
+  if (outdoorEnd > trackStart) {
+    AntiAlias::fillArc(gfx, centerX, centerY, outdoorOuterRadius - 1, outdoorInnerRadius, trackStart, outdoorEnd, outdoorColor, BLACK);
+  }
+  if (outdoorEnd < trackEnd) {
+    AntiAlias::fillArc(gfx, centerX, centerY, outdoorOuterRadius - 1, outdoorInnerRadius, outdoorEnd, trackEnd, bgColor, BLACK);
+  }
+
+  // Rounded caps - half discs facing away from the ring's filled part, so their
+  // edge only ever lies over what they are blended against
   int capRadius = ARC_THICKNESS / 2;
-  
-  // Calculate start cap positions (static)
   float startRad = effectiveStart * PI / 180.0f;
   int indoorStartX = centerX - indoorOuterRadius * cos(startRad) + capRadius * cos(startRad);
   int indoorStartY = centerY - indoorOuterRadius * sin(startRad) + capRadius * sin(startRad);
   int outdoorStartX = centerX - outdoorOuterRadius * cos(startRad) + capRadius * cos(startRad);
   int outdoorStartY = centerY - outdoorOuterRadius * sin(startRad) + capRadius * sin(startRad);
-  
-  // Draw static start caps first
-  gfx->fillCircle(indoorStartX, indoorStartY, capRadius, indoorColor);
-  gfx->fillCircle(outdoorStartX, outdoorStartY, capRadius, outdoorColor);
+  AntiAlias::fillArc(gfx, indoorStartX, indoorStartY, capRadius, 0, trackStart + 180.0f, trackStart + 360.0f, indoorColor, BLACK);
+  AntiAlias::fillArc(gfx, outdoorStartX, outdoorStartY, capRadius, 0, trackStart + 180.0f, trackStart + 360.0f, outdoorColor, BLACK);
 
-  // Use a smaller angle step for smoother arcs
-  const float angleStep = 0.5f;
-
-  // Draw both arcs using filled triangles
-  for (float angle = effectiveStart; angle < effectiveEnd; angle += angleStep) {
-    float nextAngle = constrain(angle + angleStep, angle, effectiveEnd);
-
-    // Convert angles to radians
-    float rad1 = angle * PI / 180.0f;
-    float rad2 = nextAngle * PI / 180.0f;
-
-    // Calculate points for indoor arc segment
-    int x1Inner = centerX - indoorInnerRadius * cos(rad1);
-    int y1Inner = centerY - indoorInnerRadius * sin(rad1);
-    int x2Inner = centerX - indoorInnerRadius * cos(rad2);
-    int y2Inner = centerY - indoorInnerRadius * sin(rad2);
-
-    int x1Outer = centerX - indoorOuterRadius * cos(rad1);
-    int y1Outer = centerY - indoorOuterRadius * sin(rad1);
-    int x2Outer = centerX - indoorOuterRadius * cos(rad2);
-    int y2Outer = centerY - indoorOuterRadius * sin(rad2);
-
-    // Draw indoor arc segment (filled quadrilateral) if within the animated range
-    uint16_t indoorPixelColor = (angle < animatedIndoorAngle) ? indoorColor : bgColor;
-    gfx->fillTriangle(x1Inner, y1Inner, x1Outer, y1Outer, x2Outer, y2Outer, indoorPixelColor);
-    gfx->fillTriangle(x1Inner, y1Inner, x2Inner, y2Inner, x2Outer, y2Outer, indoorPixelColor);
-
-    // Calculate points for outdoor arc segment
-    x1Inner = centerX - outdoorInnerRadius * cos(rad1);
-    y1Inner = centerY - outdoorInnerRadius * sin(rad1);
-    x2Inner = centerX - outdoorInnerRadius * cos(rad2);
-    y2Inner = centerY - outdoorInnerRadius * sin(rad2);
-
-    x1Outer = centerX - outdoorOuterRadius * cos(rad1);
-    y1Outer = centerY - outdoorOuterRadius * sin(rad1);
-    x2Outer = centerX - outdoorOuterRadius * cos(rad2);
-    y2Outer = centerY - outdoorOuterRadius * sin(rad2);
-
-    // Draw outdoor arc segment (filled quadrilateral) if within the animated range
-    uint16_t outdoorPixelColor = (angle < animatedOutdoorAngle) ? outdoorColor : bgColor;
-    gfx->fillTriangle(x1Inner, y1Inner, x1Outer, y1Outer, x2Outer, y2Outer, outdoorPixelColor);
-    gfx->fillTriangle(x1Inner, y1Inner, x2Inner, y2Inner, x2Outer, y2Outer, outdoorPixelColor);
-  }
-  
-  // Calculate and draw dynamic end caps (moving with animation)
+  // End caps sit at the middle of the ring, over the track until it runs out;
+  // a few degrees more than a half disc cover the ring's end line and the
+  // rounding of their centre
   float indoorEndRad = animatedIndoorAngle * PI / 180.0f;
   float outdoorEndRad = animatedOutdoorAngle * PI / 180.0f;
-  
-  // Position the end caps at the middle of the arc thickness
   int indoorEndX = centerX - (indoorInnerRadius + indoorOuterRadius)/2 * cos(indoorEndRad);
   int indoorEndY = centerY - (indoorInnerRadius + indoorOuterRadius)/2 * sin(indoorEndRad);
   int outdoorEndX = centerX - (outdoorInnerRadius + outdoorOuterRadius)/2 * cos(outdoorEndRad);
   int outdoorEndY = centerY - (outdoorInnerRadius + outdoorOuterRadius)/2 * sin(outdoorEndRad);
-  
-  // Draw the dynamic end caps
-  gfx->fillCircle(indoorEndX, indoorEndY, capRadius, indoorColor);
-  gfx->fillCircle(outdoorEndX, outdoorEndY, capRadius, outdoorColor);
+  AntiAlias::fillArc(gfx, indoorEndX, indoorEndY, capRadius, 0, indoorEnd - 4.0f, indoorEnd + 184.0f,
+                     indoorColor, indoorEnd < trackEnd ? bgColor : BLACK);
+  AntiAlias::fillArc(gfx, outdoorEndX, outdoorEndY, capRadius, 0, outdoorEnd - 4.0f, outdoorEnd + 184.0f,
+                     outdoorColor, outdoorEnd < trackEnd ? bgColor : BLACK);
 
   // Display temperature labels with DOUBLED text size
   gfx->setTextColor(WHITE);
@@ -393,15 +311,15 @@ void InfoScreen::drawTemperatureArcs() {
   int textX = centerX;
   // Adjust Y position to account for larger text
   int textY = centerY - (indoorInnerRadius + ARC_THICKNESS / 2) * sin(midRad);
-  String indoorText = String(int(round(indoorTemp)));
-  int textWidth = indoorText.length() * 12;           // Width for text
+  char indoorText[8];
+  int textWidth = snprintf(indoorText, sizeof(indoorText), "%d", int(round(indoorTemp))) * 12;  // Width for text
   gfx->setCursor(textX - textWidth / 2, textY - 12);  // Adjusted Y offset for larger text
   gfx->print(indoorText);
 
   // Outdoor temperature label
   textY = centerY - (outdoorInnerRadius + ARC_THICKNESS / 2) * sin(midRad);
-  String outdoorText = String(int(round(outdoorTemp)));
-  textWidth = outdoorText.length() * 12;              // Width for text
+  char outdoorText[8];
+  textWidth = snprintf(outdoorText, sizeof(outdoorText), "%d", int(round(outdoorTemp))) * 12;  // Width for text
   gfx->setCursor(textX - textWidth / 2, textY - 12);  // Adjusted Y offset for larger text
   gfx->print(outdoorText);
 }
@@ -424,36 +342,10 @@ void InfoScreen::drawTemperatureArcs() {
   if (effectiveEnd < effectiveStart) {
     effectiveEnd += 360.0f;
   }
-  float arcSpan = effectiveEnd - effectiveStart;
-
-  // Compute target fill angles based on temperature values
-  float normalizedIndoor = constrain((indoorTemp - 0.0f) / 40.0f, 0.0f, 1.0f);
-  float newTargetIndoor = effectiveStart + normalizedIndoor * arcSpan;
-  float normalizedOutdoor = constrain((outdoorTemp - (-20.0f)) / 70.0f, 0.0f, 1.0f);
-  float newTargetOutdoor = effectiveStart + normalizedOutdoor * arcSpan;
 
+  // Targets are set by setTemperatureTargets()
   unsigned long currentMillis = millis();
 
-  // On first startup or if any temperature changes, reset animation
-  if (!screenInitialized || indoorTempChanged || outdoorTempChanged) {
-    // For initial display, we can bypass animation
-    if (!screenInitialized) {
-      animatedIndoorAngle = newTargetIndoor;
-      animatedOutdoorAngle = newTargetOutdoor;
-    } else {
-      // Not initial display, so we need to animate
-      // Both animations start from minimum and grow together
-      startIndoorAngle = effectiveStart;
-      startOutdoorAngle = effectiveStart;
-      // Reset animation time
-      arcAnimationStartTime = currentMillis;
-    }
-
-    // Update target angles regardless
-    targetIndoorAngle = newTargetIndoor;
-    targetOutdoorAngle = newTargetOutdoor;
-  }
-
   // Calculate animation progress
   float progress = constrain((float)(currentMillis - arcAnimationStartTime) / (float)ANIMATION_DURATION, 0.0f, 1.0f);
 
@@ -608,15 +500,10 @@ uint16_t InfoScreen::getTemperatureColor(float temperature, bool isIndoor) {
   return gfx->color565(r, g, b);
 }
 
-void InfoScreen::drawWiFiStatus() {
-  int iconSize = 15;
-  int iconX = gfx->width() / 2;
-  int iconY = gfx->height() - 20;
-
+void InfoScreen::drawWiFiStatus(Arduino_GFX* gfx, const WidgetRect& bounds, void* context) {
   // Clear the area to avoid artifacts.
-  gfx->fillRect(iconX - iconSize - 5, iconY - iconSize - 5,
-                (iconSize + 5) * 2, (iconSize + 5) * 2, BLACK);
-  drawWiFiIcon(iconX, iconY, iconSize);
+  gfx->fillRect(bounds.x, bounds.y, bounds.w, bounds.h, BLACK);
+  static_cast<InfoScreen*>(context)->drawWiFiIcon(bounds.x + bounds.w / 2, bounds.y + bounds.h / 2, 15);
 }
 
 void InfoScreen::drawWiFiIcon(int x, int y, int size) {
@@ -667,50 +554,32 @@ void InfoScreen::updateNetworkStatus() {
       mqttConnected = newMqttConnected;
       wifiStrength = newWifiStrength;
 
-      networkStatusChanged = true;
+      wifiStatus.invalidate();
     }
   }
 }
 
-void InfoScreen::updateDateTime(const String& date, const String& time) {
-  if (date != currentDate || time != currentTime) {
-    currentDate = date;
-    currentTime = time;
-
-    // Update day of week whenever date changes
-    if (tcpClient) {
-      currentDayOfWeek = tcpClient->getDayOfWeek();
-    }
-
+void InfoScreen::updateDateTime(const ClockSnapshot& newClock) {
+  if (newClock != clock) {
+    clock = newClock;
     formatDate();
-
-    if (formattedDate != lastFormattedDate || currentTime != lastFormattedTime) {
-      lastFormattedDate = formattedDate;
-      lastFormattedTime = currentTime;
-      dateTimeChanged = true;
-      drawDateTime();
-    }
+    showDateTime();
   }
 }
 
 void InfoScreen::updateIndoorTemperature(float temperature) {
   if (abs(temperature - indoorTemp) > 0.5f) {
     indoorTemp = temperature;
-    indoorTempChanged = true;
-    drawTemperatureArcs();
+    setTemperatureTargets(true);
+    StateBroadcaster::getInstance()->publishTemperature(STATE_INDOOR_TEMP, indoorTemp);
   }
 }
 
-void InfoScreen::updateOutdoorTemperature(const String& temperature) {
-  float newTemp = 0.0f;
-  int tempEnd = temperature.indexOf('°');
-  if (tempEnd > 0) {
-    newTemp = temperature.substring(0, tempEnd).toFloat();
-  }
-  if (abs(newTemp - outdoorTemp) > 0.5f) {
-    outdoorTemp = newTemp;
-    outdoorTempChanged = true;
-    drawTemperatureArcs();
+void InfoScreen::updateOutdoorTemperature(float temperature) {
+  if (abs(temperature - outdoorTemp) > 0.5f) {
+    outdoorTemp = temperature;
+    setTemperatureTargets(true);
+    StateBroadcaster::getInstance()->publishTemperature(STATE_OUTDOOR_TEMP, outdoorTemp);
   }
 }
 
@@ -744,9 +613,7 @@ void InfoScreen::resetScreen() {
     wifiStrength = tcpClient->getWiFiSignalStrength();
 
     // Fetch current time from RTC (regardless of internet)
-    currentDate = tcpClient->getCurrentDate();
-    currentTime = tcpClient->getCurrentTime();
-    currentDayOfWeek = tcpClient->getDayOfWeek();
+    tcpClient->getClock(clock);
     formatDate();
   }
 }
@@ -4,6 +4,8 @@
 #include <Arduino_GFX_Library.h>
 #include "TouchPanel.h"
 #include "WiFiTCPClient.h"
+#include "TimeHandler.h"
+#include "Widget.h"
 
 class InfoScreen {
 private:
@@ -14,36 +16,19 @@ private:
   bool screenInitialized;
   bool pageBackRequested;
 
-  // Date and time
-  String currentDate;
-  String currentTime;
-  String lastDisplayedTime;
-  String formattedDate;     // Stores formatted date like "MON 17 MAR"
-  String currentDayOfWeek = "---"; // Current day of week (MON, TUE, etc.)
+  // Date and time - fixed buffers, compared every frame without allocating
+  ClockSnapshot clock;      // Date, time and day of week as last fetched
+  char formattedDate[12];   // Stores formatted date like "17 MAR"
 
   // For blinking colon
   bool colonVisible = true;
   unsigned long lastColonToggleTime = 0;
   const unsigned long COLON_BLINK_INTERVAL = 1000; // 1 second interval
-  int colonX = 0;  // X position of the colon
-  int colonY = 0;  // Y position of the colon
 
   // Temperature data
   float indoorTemp = 18.0;  // Default indoor temperature
   float outdoorTemp = 0.0;  // Default outdoor temperature
 
-  // Previous values to detect changes
-  float lastIndoorTemp = 0.0;
-  float lastOutdoorTemp = 0.0;
-  String lastFormattedDate;
-  String lastFormattedTime;
-
-  // Flags for redrawing specific elements
-  bool indoorTempChanged = false;
-  bool outdoorTempChanged = false;
-  bool dateTimeChanged = false;
-  bool networkStatusChanged = false;
-
   // Network status
   bool wifiConnected = false;
   bool internetConnected = false;
@@ -72,13 +57,25 @@ private:
   float startIndoorAngle;
   float startOutdoorAngle;
   unsigned long arcAnimationStartTime;
+  bool arcAnimating = false;
   const unsigned long ANIMATION_DURATION = 1000; // Animation duration in ms
 
-  // Screen rendering - called internally from update()
-  void drawDateTime();
-  void drawColonOnly();  // New method to only update the colon
+  // UI elements - the arcs first, the date and time sit in their hole
+  Icon temperatureArcs;
+  Label hoursLabel;
+  Label colonLabel;
+  Label minutesLabel;
+  Label dayLabel;
+  Label dateLabel;
+  Icon wifiStatus;
+  WidgetScreen widgets;
+
+  // Screen rendering - properties are set here, widgets.render() draws them
+  void showDateTime();
+  void setTemperatureTargets(bool animate);
   void drawTemperatureArcs();
-  void drawWiFiStatus();
+  static void drawTemperatureIcon(Arduino_GFX* gfx, const WidgetRect& bounds, void* context);
+  static void drawWiFiStatus(Arduino_GFX* gfx, const WidgetRect& bounds, void* context);
 
   // Drawing helpers
   void drawWiFiIcon(int x, int y, int size);
@@ -86,7 +83,7 @@ private:
                float value, float minValue, float maxValue, uint16_t startColor, uint16_t endColor, 
                bool showTemp, const String& label, float fillAngle);
   uint16_t getTemperatureColor(float temperature, bool isIndoor);
-  String getMonthName(int month);
+  const char* getMonthName(int month);
 
   // Network status update - called internally
   void updateNetworkStatus();
@@ -101,9 +98,9 @@ public:
   void update();
 
   void setTCPClient(WiFiTCPClient* client);
-  void updateDateTime(const String& date, const String& time);
+  void updateDateTime(const ClockSnapshot& newClock);
   void updateIndoorTemperature(float temperature);
-  void updateOutdoorTemperature(const String& temperature);
+  void updateOutdoorTemperature(float temperature);
 
   void resetLastActivityTime();
   bool isInactivityTimeoutReached();
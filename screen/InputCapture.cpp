@@ -0,0 +1,98 @@
+#include "InputCapture.h"
+#include <esp_heap_caps.h>
+
+uint8_t* InputCapture::buffer = nullptr;
+size_t InputCapture::capacity = 0;
+size_t InputCapture::used = 0;
+uint32_t InputCapture::recordCount = 0;
+unsigned long InputCapture::startTime = 0;
+unsigned long InputCapture::stopTime = 0;
+bool InputCapture::capturing = false;
+bool InputCapture::truncated = false;
+ResumeSnapshot InputCapture::initialState = {};
+portMUX_TYPE InputCapture::captureMux = portMUX_INITIALIZER_UNLOCKED;
+
+bool InputCapture::start(const ResumeSnapshot& state) {
+  if (!buffer) {
+    if (psramFound()) {
+      buffer = (uint8_t*)heap_caps_malloc(CAPTURE_PSRAM_BYTES, MALLOC_CAP_SPIRAM);
+      capacity = buffer ? CAPTURE_PSRAM_BYTES : 0;
+    }
+    if (!buffer) {
+      buffer = (uint8_t*)malloc(CAPTURE_INTERNAL_BYTES);
+      capacity = buffer ? CAPTURE_INTERNAL_BYTES : 0;
+    }
+    if (!buffer) {
+      return false;
+    }
+  }
+
+  portENTER_CRITICAL(&captureMux);
+  used = 0;
+  recordCount = 0;
+  truncated = false;
+  initialState = state;
+  startTime = millis();
+  capturing = true;
+  portEXIT_CRITICAL(&captureMux);
+  return true;
+}
+
+void InputCapture::stop() {
+  portENTER_CRITICAL(&captureMux);
+  if (capturing) {
+    capturing = false;
+    stopTime = millis();
+  }
+  portEXIT_CRITICAL(&captureMux);
+}
+
+uint32_t InputCapture::getDuration() {
+  return (capturing ? millis() : stopTime) - startTime;
+}
+
+void InputCapture::recordKnobLine(const char* line, size_t length) {
+  if (!capturing) return;
+  append(CAPTURE_KNOB_LINE, line, length);
+}
+
+void InputCapture::recordTouch(int x, int y, uint8_t gestureID, uint8_t points, uint8_t event) {
+  if (!capturing) return;
+  CaptureTouch touch = { (int16_t)x, (int16_t)y, gestureID, points, event, 0 };
+  append(CAPTURE_TOUCH, &touch, sizeof(touch));
+}
+
+void InputCapture::recordMQTT(const char* topic, const uint8_t* payload, unsigned int length) {
+  if (!capturing) return;
+  // Topic and its terminator, then the payload
+  append(CAPTURE_MQTT, topic, strlen(topic) + 1, payload, length);
+}
+
+void InputCapture::append(CaptureRecordType type, const void* first, size_t firstLength,
+                          const void* second, size_t secondLength) {
+  CaptureRecordHeader header;
+  header.type = type;
+  header.reserved = 0;
+  header.length = (uint16_t)(firstLength + secondLength);
+
+  portENTER_CRITICAL(&captureMux);
+  if (capturing) {
+    size_t recordSize = sizeof(header) + header.length;
+    if (firstLength + secondLength > UINT16_MAX || used + recordSize > capacity) {
+      // Keep what fits - a replay of the start is still useful
+      capturing = false;
+      truncated = true;
+      stopTime = millis();
+    } else {
+      header.time = millis() - startTime;
+      memcpy(buffer + used, &header, sizeof(header));
+      memcpy(buffer + used + sizeof(header), first, firstLength);
+      if (secondLength > 0) {
+        memcpy(buffer + used + sizeof(header) + firstLength, second, secondLength);
+      }
+      used += recordSize;
+      recordCount++;
+    }
+  }
+  portEXIT_CRITICAL(&captureMux);
+}
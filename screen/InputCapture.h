@@ -0,0 +1,59 @@
+#ifndef INPUT_CAPTURE_H
+#define INPUT_CAPTURE_H
+
+#include <Arduino.h>
+#include "CaptureFormat.h"
+#include "ResumeState.h"
+
+#define CAPTURE_PSRAM_BYTES (64 * 1024)     // Capture buffer when PSRAM is present
+#define CAPTURE_INTERNAL_BYTES (8 * 1024)   // Fallback in internal RAM
+#define CAPTURE_DUMP_BYTES_PER_LINE 512     // Raw bytes per base64 line of a dump
+
+/**
+ * Records the device's inputs for deterministic replay on the host.
+ *
+ * While a capture runs, every knob line, touch sample and incoming MQTT
+ * message is appended to a buffer with its time since the start (see
+ * CaptureFormat.h). The UI state at the start is kept with it, so the replay
+ * harness (host/tools/replay.cpp) can put the real controller code in the same
+ * place and feed it the same inputs on a simulated clock.
+ *
+ * The buffer is allocated on the first start and kept for the dump. A full
+ * buffer stops the capture and marks it truncated.
+ */
+class InputCapture {
+public:
+  static bool start(const ResumeSnapshot& initialState); // Drop the last capture and start a new one
+  static void stop();
+  static bool isCapturing() { return capturing; }
+
+  static void recordKnobLine(const char* line, size_t length);
+  static void recordTouch(int x, int y, uint8_t gestureID, uint8_t points, uint8_t event);
+  static void recordMQTT(const char* topic, const uint8_t* payload, unsigned int length);
+
+  // Finished capture, for the dump
+  static const uint8_t* getData() { return buffer; }
+  static size_t getSize() { return used; }
+  static size_t getCapacity() { return capacity; }
+  static uint32_t getRecordCount() { return recordCount; }
+  static uint32_t getDuration();                        // ms, up to now while capturing
+  static bool isTruncated() { return truncated; }
+  static const ResumeSnapshot& getInitialState() { return initialState; }
+
+private:
+  static uint8_t* buffer;
+  static size_t capacity;
+  static size_t used;
+  static uint32_t recordCount;
+  static unsigned long startTime;
+  static unsigned long stopTime;
+  static bool capturing;
+  static bool truncated;
+  static ResumeSnapshot initialState;
+  static portMUX_TYPE captureMux;
+
+  static void append(CaptureRecordType type, const void* first, size_t firstLength,
+                     const void* second = nullptr, size_t secondLength = 0);
+};
+
+#endif // INPUT_CAPTURE_H
@@ -126,18 +126,14 @@ void InternetHandler::update() {
   }
 }
 
-String InternetHandler::getCurrentDate() const {
-  return timeHandler ? timeHandler->getCurrentDate() : "----/--/--";
-}
-
-String InternetHandler::getCurrentTime() const {
-  return timeHandler ? timeHandler->getCurrentTime() : "--:--";
-}
-
-String InternetHandler::getDayOfWeek() const {
-  return timeHandler ? timeHandler->getDayOfWeek() : "---";
+void InternetHandler::getClock(ClockSnapshot& clock) const {
+  if (timeHandler) {
+    timeHandler->getClock(clock);
+  } else {
+    clock = ClockSnapshot::unknown();
+  }
 }
 
-String InternetHandler::getWeatherTemperature() const {
-  return weatherHandler ? weatherHandler->getWeatherTemperature() : "--°C";
+bool InternetHandler::getOutdoorTemperature(float& temperature) const {
+  return weatherHandler ? weatherHandler->getTemperature(temperature) : false;
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 class WiFiHandler;
 class TimeHandler;
 class WeatherHandler;
+struct ClockSnapshot;
 
 class InternetHandler {
 private:
@@ -87,32 +88,19 @@ public:
   bool updateWeather();
 
   /**
-   * Gets the current date string (YYYY/MM/DD)
+   * Gets the current date (YYYY/MM/DD), time (HH:MM) and day of week (MON, TUE, etc.)
    * 
-   * @return Current date string or placeholder if not available
+   * @param clock Receives the values, or placeholders if not available
    */
-  String getCurrentDate() const;
-  
-  /**
-   * Gets the current time string (HH:MM)
-   * 
-   * @return Current time string or placeholder if not available
-   */
-  String getCurrentTime() const;
-  
-  /**
-   * Gets the current day of week (MON, TUE, etc.)
-   * 
-   * @return Current day of week or placeholder if not available
-   */
-  String getDayOfWeek() const;
+  void getClock(ClockSnapshot& clock) const;
   
   /**
    * Gets the current temperature from weather service
    * 
-   * @return Current temperature string or placeholder if not available
+   * @param temperature Receives the temperature in °C
+   * @return True if a weather update has provided a temperature
    */
-  String getWeatherTemperature() const;
+  bool getOutdoorTemperature(float& temperature) const;
 
   /**
    * Main update method - call this regularly from loop()
@@ -1,7 +1,10 @@
 #include "KnobController.h"
+#include "InputCapture.h"
 
 KnobController::KnobController(int rxPin, int txPin)
-  : softSerial(rxPin, txPin), commandFromKnob(""), hasNewMessage(false) {}
+  : softSerial(rxPin, txPin), receivedStamp(0), hasNewMessage(false) {
+  commandFromKnob[0] = 0;
+}
 
 void KnobController::begin(int baudRate) {
   softSerial.begin(baudRate);
@@ -19,26 +22,31 @@ void KnobController::update() {
   hasNewMessage = false;  
   while (softSerial.available()) {
     hasNewMessage = true;
-    commandFromKnob = "";
+    size_t length = 0;
     lastActionTime = millis();
+    receivedStamp = LatencyTracer::now();  // Start of the input-to-effect latency
 
     while (softSerial.available()) {
       char c = softSerial.read();
       if (c == '\n') break;  // End of command
-      commandFromKnob += c;
+      if (length < sizeof(commandFromKnob) - 1) {
+        commandFromKnob[length++] = c;
+      }
       delay(3);  // Prevents serial buffer overflow
     }
+    commandFromKnob[length] = 0;
+    InputCapture::recordKnobLine(commandFromKnob, length);
     
     // No longer process commands directly
     // Commands will be processed by CommandHandler
   }
 }
 
-String KnobController::getReceivedCommand() {
+const char* KnobController::getReceivedCommand() {
   return commandFromKnob;
 }
 
-void KnobController::sendCommand(String command) {
+void KnobController::sendCommand(const char* command) {
   softSerial.print(command);
   //Serial.println("Sent command to knob:" + command);
 }
\ No newline at end of file
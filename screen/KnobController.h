@@ -2,6 +2,9 @@
 #define KNOB_CONTROLLER_H
 
 #include <SoftwareSerial.h>
+#include "LatencyTracer.h"
+
+#define KNOB_COMMAND_LENGTH 32  // Longest command line from the knob
 
 class KnobController {
 public:
@@ -9,13 +12,15 @@ public:
   void begin(int baudRate);
   void update();
   void askSetpoint();
-  String getReceivedCommand();
+  const char* getReceivedCommand();
+  LatencyStamp getReceivedStamp() const { return receivedStamp; }  // When the command started arriving
   bool getHasNewMessage();
-  void sendCommand(String command);
+  void sendCommand(const char* command);
 
 private:
   SoftwareSerial softSerial;
-  String commandFromKnob;
+  char commandFromKnob[KNOB_COMMAND_LENGTH];  // Last received line, longer lines are truncated
+  LatencyStamp receivedStamp;
   unsigned long lastActionTime;
   bool hasNewMessage;
 };
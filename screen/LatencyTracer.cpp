@@ -0,0 +1,134 @@
+#include "LatencyTracer.h"
+
+static const char* const pathNames[] = { "knob->pixel", "knob->publish", "mqtt echo" };
+static const char* const pathKeys[] = { "knob_pixel", "knob_publish", "mqtt_echo" };
+
+static_assert(sizeof(pathNames) / sizeof(pathNames[0]) == LATENCY_PATH_COUNT, "Name every latency path");
+static_assert(LATENCY_SUB_BUCKETS == 8, "bucketFor() assumes 3 sub-bucket bits");
+
+LatencyTracer* LatencyTracer::getInstance() {
+  // First reached from both cores - a function-local static is created exactly once
+  static LatencyTracer* instance = new LatencyTracer();
+  return instance;
+}
+
+LatencyTracer::LatencyTracer() {
+  histogramMux = portMUX_INITIALIZER_UNLOCKED;
+  memset(histograms, 0, sizeof(histograms));
+}
+
+int LatencyTracer::bucketFor(uint32_t value) {
+  // Values below 8 us get a bucket each, above that 8 buckets per power of two
+  if (value < LATENCY_SUB_BUCKETS) return value;
+  int exponent = 31 - __builtin_clz(value);
+  int subBucket = (value >> (exponent - 3)) - LATENCY_SUB_BUCKETS;
+  int bucket = (exponent - 2) * LATENCY_SUB_BUCKETS + subBucket;
+  return bucket < LATENCY_BUCKETS ? bucket : LATENCY_BUCKETS - 1;
+}
+
+uint32_t LatencyTracer::bucketUpperBound(int bucket) {
+  if (bucket < LATENCY_SUB_BUCKETS) return bucket;
+  int exponent = bucket / LATENCY_SUB_BUCKETS + 2;
+  int subBucket = bucket % LATENCY_SUB_BUCKETS;
+  uint32_t lower = (uint32_t)(LATENCY_SUB_BUCKETS + subBucket) << (exponent - 3);
+  return lower + (1u << (exponent - 3)) - 1;
+}
+
+uint32_t LatencyTracer::percentile(const Histogram& histogram, int percent) {
+  if (histogram.count == 0) return 0;
+
+  // Smallest bucket holding at least percent% of the samples
+  uint32_t target = ((uint64_t)histogram.count * percent + 99) / 100;
+  uint32_t seen = 0;
+  for (int i = 0; i < LATENCY_BUCKETS; i++) {
+    seen += histogram.buckets[i];
+    if (seen >= target) {
+      uint32_t bound = bucketUpperBound(i);
+      return bound < histogram.maxValue ? bound : histogram.maxValue;
+    }
+  }
+  return histogram.maxValue;
+}
+
+void LatencyTracer::record(LatencyPath path, LatencyStamp start) {
+  if (start == 0) return;
+  recordValue(path, now() - start);
+}
+
+void LatencyTracer::recordValue(LatencyPath path, uint32_t micros) {
+  if (path >= LATENCY_PATH_COUNT) return;
+
+  portENTER_CRITICAL(&histogramMux);
+  Histogram& histogram = histograms[path];
+  histogram.buckets[bucketFor(micros)]++;
+  histogram.count++;
+  if (micros > histogram.maxValue) {
+    histogram.maxValue = micros;
+  }
+  portEXIT_CRITICAL(&histogramMux);
+}
+
+void LatencyTracer::recordLost(LatencyPath path) {
+  if (path >= LATENCY_PATH_COUNT) return;
+
+  portENTER_CRITICAL(&histogramMux);
+  histograms[path].lost++;
+  portEXIT_CRITICAL(&histogramMux);
+}
+
+void LatencyTracer::reset() {
+  portENTER_CRITICAL(&histogramMux);
+  memset(histograms, 0, sizeof(histograms));
+  portEXIT_CRITICAL(&histogramMux);
+}
+
+uint32_t LatencyTracer::getPercentile(LatencyPath path, int percent) {
+  if (path >= LATENCY_PATH_COUNT) return 0;
+
+  portENTER_CRITICAL(&histogramMux);
+  uint32_t value = percentile(histograms[path], percent);
+  portEXIT_CRITICAL(&histogramMux);
+  return value;
+}
+
+uint32_t LatencyTracer::getCount(LatencyPath path) {
+  return path < LATENCY_PATH_COUNT ? histograms[path].count : 0;
+}
+
+String LatencyTracer::getReport() {
+  // Only the network task runs commands, so the snapshot can live in static storage
+  static Histogram snapshot[LATENCY_PATH_COUNT];
+  portENTER_CRITICAL(&histogramMux);
+  memcpy(snapshot, histograms, sizeof(snapshot));
+  portEXIT_CRITICAL(&histogramMux);
+
+  char line[112];
+  String report = "[Latency] path              n      p50      p95      p99      max (ms)\n";
+  String structured = "latency:";
+
+  for (int i = 0; i < LATENCY_PATH_COUNT; i++) {
+    const Histogram& histogram = snapshot[i];
+    uint32_t p50 = percentile(histogram, 50);
+    uint32_t p95 = percentile(histogram, 95);
+    uint32_t p99 = percentile(histogram, 99);
+
+    snprintf(line, sizeof(line), "[Latency] %-13s %7lu %8.1f %8.1f %8.1f %8.1f", pathNames[i],
+             (unsigned long)histogram.count, p50 / 1000.0f, p95 / 1000.0f, p99 / 1000.0f,
+             histogram.maxValue / 1000.0f);
+    report += line;
+    if (histogram.lost > 0) {
+      snprintf(line, sizeof(line), ", %lu lost", (unsigned long)histogram.lost);
+      report += line;
+    }
+    report += "\n";
+
+    snprintf(line, sizeof(line), "%spath=%s,n=%lu,p50_us=%lu,p95_us=%lu,p99_us=%lu,max_us=%lu,lost=%lu",
+             i > 0 ? ";" : "", pathKeys[i], (unsigned long)histogram.count, (unsigned long)p50,
+             (unsigned long)p95, (unsigned long)p99, (unsigned long)histogram.maxValue,
+             (unsigned long)histogram.lost);
+    structured += line;
+  }
+
+  report += structured;
+  return report;
+}
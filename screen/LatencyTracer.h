@@ -0,0 +1,80 @@
+#ifndef LATENCY_TRACER_H
+#define LATENCY_TRACER_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+
+// Monotonic microsecond timestamp of an input event, 0 when not traced
+typedef uint32_t LatencyStamp;
+
+// Measured input-to-effect paths
+enum LatencyPath {
+  LATENCY_KNOB_TO_PIXEL,      // Knob line received -> first pixels of the new setpoint drawn
+  LATENCY_KNOB_TO_PUBLISH,    // Knob line received -> setpoint handed to the MQTT/UDP client
+  LATENCY_MQTT_ECHO,          // Echo probe published -> echo from the PC app received
+  LATENCY_PATH_COUNT
+};
+
+// Log-linear histogram: LATENCY_SUB_BUCKETS buckets per power of two, so a
+// percentile is never more than 1/LATENCY_SUB_BUCKETS above the true value
+#define LATENCY_SUB_BUCKETS 8
+#define LATENCY_OCTAVES 24                // Up to 2^26 us (~67 s), slower samples land in the last bucket
+#define LATENCY_BUCKETS (LATENCY_SUB_BUCKETS * LATENCY_OCTAVES)
+
+/**
+ * End-to-end input latency histograms for the latency command.
+ *
+ * KnobController stamps each line as it arrives; the stamp rides along with
+ * the setpoint change through CommandHandler, DisplayController and the
+ * Sound/Light controller. It is recorded once when the change first reaches
+ * the panel (Arc::draw, LightController::drawSetPoint) and once when it is
+ * published (MQTTHandler::sendMQTTMessage, or the UDP channel). Detents that
+ * arrive before the previous one was drawn keep the oldest stamp, so
+ * coalesced input is charged for its full wait.
+ *
+ * MQTT echo probes measure the broker round trip to the PC app, which
+ * echoes esp32/latency/probe back on esp32/latency/echo.
+ */
+class LatencyTracer {
+private:
+  struct Histogram {
+    uint32_t buckets[LATENCY_BUCKETS];
+    uint32_t count;
+    uint32_t maxValue;                // us
+    uint32_t lost;                    // Samples that never completed (unanswered probes, rate-limited publishes)
+  };
+
+  portMUX_TYPE histogramMux;          // record() runs on the display and network tasks
+  Histogram histograms[LATENCY_PATH_COUNT];
+
+  LatencyTracer();
+
+  static int bucketFor(uint32_t value);
+  static uint32_t bucketUpperBound(int bucket);
+  static uint32_t percentile(const Histogram& histogram, int percent);
+
+public:
+  static LatencyTracer* getInstance();
+
+  // Stamp an input event - never returns 0
+  static LatencyStamp now() {
+    LatencyStamp stamp = (LatencyStamp)esp_timer_get_time();
+    return stamp != 0 ? stamp : 1;
+  }
+
+  // Add the time from start to now; a 0 stamp (untraced input) is ignored
+  void record(LatencyPath path, LatencyStamp start);
+  void recordValue(LatencyPath path, uint32_t micros);
+  void recordLost(LatencyPath path);
+  void reset();
+
+  // Percentile in us, rounded up to its bucket edge (0 without samples)
+  uint32_t getPercentile(LatencyPath path, int percent);
+  uint32_t getCount(LatencyPath path);
+
+  // Human-readable table ending with the structured line
+  String getReport();
+};
+
+#endif // LATENCY_TRACER_H
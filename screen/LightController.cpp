@@ -1,22 +1,37 @@
 #include "LightController.h"
+#include "StateBroadcaster.h"
 
 // Constructor
 LightController::LightController(Arduino_GFX* graphics, TouchPanel* touch, MQTTHandler* mqttHandler)
   : gfx(graphics), touchPanel(touch), mqttHandler(mqttHandler), setpoint(50), lastSetpoint(-1),
     lastSentSetpoint(-1), lastSentColor(0), initialized(false), pageBackRequested(false), waterLevel(50), colorHue(0.5f),
     lastWaterLevel(-1), lastColorHue(-1), lastColorChangeTime(0), lastWaterLevelSentTime(0), lastSetPointDrawnTime(0),
-    lastScreenUpdateTime(0), firstTouchX(-1), firstTouchY(-1), currentMode(STATIC), modeChangeRequested(false) {
+    lastScreenUpdateTime(0), firstTouchX(-1), firstTouchY(-1), currentMode(STATIC), modeChangeRequested(false),
+    inputStamp(0), waterFill(graphics), modeText(graphics),
+    backArrow(graphics, drawBackArrow, nullptr, false), forwardArrow(graphics, drawForwardArrow, nullptr, false),
+    widgets(graphics) {
     
     // Initialize state variables
-    colorChange = false;
-    waterLevelChange = false;
     lastSetpointChangeTime = 0;
     lastSetpointQueryTime = 0;
+
+    // A swipe changes the hue on every sample - keep the float math out of it
+    for (int i = 0; i < LIGHT_HUE_STEPS; i++) {
+      hueColors[i] = hsvToRgb565((float)i / LIGHT_HUE_STEPS, 1.0f, 1.0f);
+    }
+
+    // Mode text and arrows are drawn over the water
+    modeText.setTextSize(2);
+    modeText.setTransparent();
+    widgets.add(&waterFill);
+    widgets.add(&modeText);
+    widgets.add(&backArrow);
+    widgets.add(&forwardArrow);
 }
 
 // Helper function to convert HSV to RGB565
 uint16_t LightController::hsvToRgb565(float hue, float saturation, float value) {
-  float r, g, b;
+  float r = 0, g = 0, b = 0;
   int i = int(hue * 6);
   float f = hue * 6 - i;
   float p = value * (1 - saturation);
@@ -39,50 +54,67 @@ uint16_t LightController::hsvToRgb565(float hue, float saturation, float value)
   return gfx->color565(red, green, blue);
 }
 
-void LightController::drawSetPoint() {
+uint16_t LightController::hueToRgb565(float hue) const {
+  int index = constrain((int)(hue * LIGHT_HUE_STEPS), 0, LIGHT_HUE_STEPS - 1);
+  return hueColors[index];
+}
+
+void LightController::showSetPoint() {
   int height = gfx->height();
-  int width = gfx->width();
   int waterLevelHeight = (waterLevel * height) / 100;
 
-  // Determine the color based on the hue
-  uint16_t color = hsvToRgb565(colorHue, 1.0f, 1.0f);
-
-  // Clear only the water level region
-  int lastWaterLevelHeight = (lastWaterLevel * height) / 100;
-  gfx->fillRect(0, height - max(waterLevelHeight, lastWaterLevelHeight), width, abs(waterLevelHeight - lastWaterLevelHeight), BLACK);
-  // Fill the water level region with the current color
-  gfx->fillRect(0, height - waterLevelHeight, width, waterLevelHeight, color);
+  // A level change paints only the rows the water gained or left, a new
+  // color repaints it once - a hue within the same table entry changes nothing
+  waterFill.setBounds(0, height - waterLevelHeight, gfx->width(), waterLevelHeight);
+  waterFill.setColor(hueToRgb565(colorHue));
 
   lastWaterLevel = waterLevel;
   lastColorHue = colorHue;
   lastSetpoint = setpoint;  // Update the last drawn setpoint
 }
 
-void LightController::incrementSetpoint() {
+void LightController::incrementSetpoint(LatencyStamp stamp) {
   if (waterLevel < 100) {
     waterLevel ++;
-    waterLevelChange = true;
     lastSetpointChangeTime = millis();
+    traceInput(stamp);
   }
 }
 
-void LightController::decrementSetpoint() {
+void LightController::decrementSetpoint(LatencyStamp stamp) {
   if (waterLevel > 0) {
     waterLevel --;
-    waterLevelChange = true;
     lastSetpointChangeTime = millis();
+    traceInput(stamp);
   }
 }
 
-void LightController::setSetpoint(int setpoint) {
+void LightController::setSetpoint(int setpoint, LatencyStamp stamp) {
   if (setpoint >= 0 && setpoint <= 100) {
     waterLevel = setpoint;
-    waterLevelChange = true;
     lastSetpointChangeTime = millis();
+    traceInput(stamp);
+  }
+}
+
+void LightController::traceInput(LatencyStamp stamp) {
+  // Detents between two redraws are drawn and sent together - keep the oldest
+  if (stamp != 0 && inputStamp == 0) {
+    inputStamp = stamp;
+  }
+}
+
+void LightController::restoreSetpoint(int level) {
+  if (level >= 0 && level <= 100) {
+    waterLevel = level;
+    setpoint = level;
+    lastSentSetpoint = level;
   }
 }
 
 void LightController::updateScreen() {
+  LatencyStamp drawnStamp = 0;
+
   if (!initialized) {
     drawStaticElements();
     initialized = true;
@@ -92,17 +124,20 @@ void LightController::updateScreen() {
     unsigned long currentMillis = millis();
 
     checkTouchInput();
-    // Redraw the water level only if it or the color has changed
-    if ((waterLevelChange || colorChange) && (currentMillis - lastSetPointDrawnTime >= 10)) {
-      drawSetPoint();
+    // Show and send the water level at most every 10 ms - a swipe moves it on every sample
+    if (hasPendingChange() && (currentMillis - lastSetPointDrawnTime >= 10)) {
+      showSetPoint();
       sendSetpointToServer();
+      drawnStamp = inputStamp;
+      inputStamp = 0;
+      StateBroadcaster::getInstance()->publish(STATE_LIGHT, waterLevel);
       lastSetPointDrawnTime = currentMillis;
-      colorChange = false;
-      waterLevelChange = false;
     }
-    // Draw mode text and buttons
-    drawModeText();
   }
+
+  // Repaint whatever changed
+  widgets.render();
+  LatencyTracer::getInstance()->record(LATENCY_KNOB_TO_PIXEL, drawnStamp);
   
   // Ask the knob for updated setpoint information
   /*
@@ -134,7 +169,6 @@ void LightController::checkTouchInput() {
       // Update the hue based on X-axis swipe
       if (abs(deltaX) > 10) {
         colorHue = (float)touchX / screenWidth;
-        colorChange = true;
       }
 
       // Update the water level based on Y-axis swipe
@@ -142,7 +176,6 @@ void LightController::checkTouchInput() {
         waterLevel = (1.0f - ((float)touchY / screenHeight)) * 100;
         // Make sure waterLevel stays in valid range
         waterLevel = constrain(waterLevel, 0, 100);
-        waterLevelChange = true;
       }
     }
   } else {
@@ -151,7 +184,7 @@ void LightController::checkTouchInput() {
 
     if (touchPanel->getHasNewHoldRelease()) {
       if (!pageBackRequested) {
-        if (!colorChange && !waterLevelChange) {
+        if (!hasPendingChange()) {
           pageBackRequested = true;
           Serial.println("Back requested from Light Controller.");
         }
@@ -168,7 +201,7 @@ void LightController::sendSetpointToServer() {
   }
   
   // Use MQTT to send LED ring commands
-  uint16_t color = hsvToRgb565(colorHue, 1.0f, 1.0f);
+  uint16_t color = hueToRgb565(colorHue);
   uint8_t r = (color >> 11) & 0x1F;
   uint8_t g = (color >> 5) & 0x3F;
   uint8_t b = color & 0x1F;
@@ -177,9 +210,11 @@ void LightController::sendSetpointToServer() {
   g = (g * 255 / 63) * (waterLevel / 100.0f);
   b = (b * 255 / 31) * (waterLevel / 100.0f);
 
-  String colorMessage = String(r) + "," + String(g) + "," + String(b);
-  String brightnessMessage = String((waterLevel * 255) / 100);
-  String modeMessage;
+  char colorMessage[16];
+  char brightnessMessage[12];
+  snprintf(colorMessage, sizeof(colorMessage), "%u,%u,%u", r, g, b);
+  snprintf(brightnessMessage, sizeof(brightnessMessage), "%d", (waterLevel * 255) / 100);
+  const char* modeMessage = "";
   
   switch (currentMode) {
     case STATIC: modeMessage = "static"; break;
@@ -189,7 +224,7 @@ void LightController::sendSetpointToServer() {
 
   // Send messages only if handler exists
   if (mqttHandler) {
-    mqttHandler->sendMQTTMessage("ledRing/colorControl", colorMessage);
+    mqttHandler->sendMQTTMessage("ledRing/colorControl", colorMessage, inputStamp);
     mqttHandler->sendMQTTMessage("ledRing/brightnessControl", brightnessMessage);
     mqttHandler->sendMQTTMessage("ledRing/modeControl", modeMessage);
   }
@@ -200,8 +235,16 @@ void LightController::drawStaticElements() {
     Serial.println("⚠️ Error: gfx is NULL, cannot draw UI.");
     return;
   }
-  gfx->fillScreen(BLACK);
-  drawSetPoint();
+  int screenWidth = gfx->width();
+  int screenHeight = gfx->height();
+  modeText.setAnchor(screenWidth / 2, screenHeight - 30);
+  backArrow.setBounds(10, screenHeight - 40, 21, 31);
+  forwardArrow.setBounds(screenWidth - 30, screenHeight - 40, 21, 31);
+  showModeText();
+  showSetPoint();
+
+  // Clear the screen - everything is drawn on this frame's render
+  widgets.begin();
 }
 
 void LightController::requestCurrentBrightnessFromServer() {
@@ -216,7 +259,8 @@ void LightController::requestCurrentBrightnessFromServer() {
   
   // Default to current value until we receive a response via MQTT callback
   /*
-  String setpointString = "setpoint=" + String(waterLevel);
+  char setpointString[16];
+  snprintf(setpointString, sizeof(setpointString), "setpoint=%d", waterLevel);
   if (knob) {
     knob->sendCommand(setpointString);
   }
@@ -230,30 +274,24 @@ bool LightController::isPageBackRequested() const {
 void LightController::resetPageBackRequest() {
   pageBackRequested = false;
   initialized = false;
+  inputStamp = 0;
 }
 
-void LightController::drawModeText() {
-  int screenWidth = gfx->width();
-  int screenHeight = gfx->height();
-  gfx->setTextSize(2);
-  gfx->setTextColor(WHITE);
-
-  // Draw mode text
-  String modeText;
+void LightController::showModeText() {
   switch (currentMode) {
-    case STATIC: modeText = "Static"; break;
-    case GLOW: modeText = "Glow"; break;
-    case RAINBOW: modeText = "Rainbow"; break;
+    case STATIC: modeText.setText("Static"); break;
+    case GLOW: modeText.setText("Glow"); break;
+    case RAINBOW: modeText.setText("Rainbow"); break;
   }
-  int textSize = 2;   // Adjust this based on your text size
-  int charWidth = 6;  // Approximate width of a single character in default font
-  int textWidth = modeText.length() * charWidth * textSize;
-  gfx->setCursor((screenWidth - textWidth) / 2, screenHeight - 30);
-  gfx->print(modeText);
-
-  // Draw back and forward buttons
-  gfx->fillTriangle(10, screenHeight - 20, 30, screenHeight - 40, 30, screenHeight - 10, WHITE);                                            // Back button
-  gfx->fillTriangle(screenWidth - 10, screenHeight - 20, screenWidth - 30, screenHeight - 40, screenWidth - 30, screenHeight - 10, WHITE);  // Forward button
+}
+
+// Back and forward buttons beside the mode text
+void LightController::drawBackArrow(Arduino_GFX* gfx, const WidgetRect& bounds, void* context) {
+  gfx->fillTriangle(bounds.x, bounds.y + 20, bounds.x + 20, bounds.y, bounds.x + 20, bounds.y + 30, WHITE);
+}
+
+void LightController::drawForwardArrow(Arduino_GFX* gfx, const WidgetRect& bounds, void* context) {
+  gfx->fillTriangle(bounds.x + 20, bounds.y + 20, bounds.x, bounds.y, bounds.x, bounds.y + 30, WHITE);
 }
 
 // Update MQTT handler
@@ -265,7 +303,7 @@ void LightController::handleModeChange() {
   if (modeChangeRequested) {
     currentMode = static_cast<LedMode>((currentMode + 1) % 3);  // Cycle through modes
     modeChangeRequested = false;
-    drawModeText();
+    showModeText();
     
     // Send the new mode to the server
     sendSetpointToServer();
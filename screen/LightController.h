@@ -4,6 +4,10 @@
 #include <Arduino_GFX_Library.h>
 #include "TouchPanel.h"
 #include "MQTTHandler.h"
+#include "LatencyTracer.h"
+#include "Widget.h"
+
+#define LIGHT_HUE_STEPS 256  // Entries of the hue to RGB565 table
 
 class LightController {
 private:
@@ -25,29 +29,41 @@ private:
   int lastWaterLevel;      // Last water level (0-100)
   float colorHue;          // Current hue for the light color
   float lastColorHue;      // Last hue for the light color
-  bool colorChange;        // Indicates if the color has changed
   bool initialized;        // Indicates if static elements have been drawn
   bool pageBackRequested;  // Flag for page-back request
   int firstTouchX;         // Initial touch X-coordinate for swipe detection
   int firstTouchY;         // Initial touch Y-coordinate for swipe detection
-  bool waterLevelChange;   // Indicates if the water level has changed
   enum LedMode { STATIC,
                  GLOW,
                  RAINBOW };  // LED modes
   LedMode currentMode;       // Current LED mode
   bool modeChangeRequested;  // Indicates if mode change is requested
+  LatencyStamp inputStamp;   // Oldest knob input not yet drawn and sent (0 = none)
+  uint16_t hueColors[LIGHT_HUE_STEPS]; // Fully saturated color by hue, built once
+
+  // UI elements, back to front
+  Fill waterFill;            // Water level in the light color
+  Label modeText;            // LED mode name
+  Icon backArrow;            // Previous mode
+  Icon forwardArrow;         // Next mode
+  WidgetScreen widgets;
 
   // Private methods
   void drawStaticElements();                                       // Draw static light visualization
-  void drawSetPoint();                                             // Draw the current light setpoint and water level
+  void showSetPoint();                                             // Put the water level and color on the fill
   void drawWaterLevel(int level);                                  // Draw only the changed part of the water level
-  void drawModeText();                                             // Draw the current LED mode text
+  void showModeText();                                             // Put the current LED mode on its label
+  bool hasPendingChange() const { return waterLevel != lastWaterLevel || colorHue != lastColorHue; }
   void sendSetpointToServer();                                     // Send the setpoint and color to the server
   void requestCurrentBrightnessFromServer();                       // Request the current brightness from the server
   uint16_t hsvToRgb565(float hue, float saturation, float value);  // Convert HSV to RGB565
+  uint16_t hueToRgb565(float hue) const;                           // Light color for a hue, from the table
   void checkTouchInput();                                          // Check for touch input and handle interactions
   void updateColorSpectrum();                                      // Update the color to shift through the spectrum
   void handleModeChange();                                         // Handle mode change logic
+  void traceInput(LatencyStamp stamp);                             // Remember a knob input until it is drawn and sent
+  static void drawBackArrow(Arduino_GFX* gfx, const WidgetRect& bounds, void* context);
+  static void drawForwardArrow(Arduino_GFX* gfx, const WidgetRect& bounds, void* context);
 
 public:
   // Constructor
@@ -55,9 +71,11 @@ public:
 
   // Public methods
   void updateScreen();               // Update the screen with the current state
-  void setSetpoint(int setpoint);    // Increment the water level
-  void incrementSetpoint();          // Increment the water level
-  void decrementSetpoint();          // Decrement the water level
+  void setSetpoint(int setpoint, LatencyStamp inputStamp = 0);  // Set the water level
+  void incrementSetpoint(LatencyStamp inputStamp = 0);          // Increment the water level
+  void decrementSetpoint(LatencyStamp inputStamp = 0);          // Decrement the water level
+  int getSetpoint() const { return waterLevel; } // Current light level
+  void restoreSetpoint(int level);   // Set the level after deep sleep without sending it
   bool isPageBackRequested() const;  // Check if a page-back request has been made
   void resetPageBackRequest();       // Reset the page-back request flag
   void setMQTTHandler(MQTTHandler* handler); // Update MQTT handler
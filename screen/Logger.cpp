@@ -0,0 +1,170 @@
+#include "Logger.h"
+#include <esp_system.h>
+#include <strings.h>
+
+// Slot sequence numbers are kept relative to the slot index, so the
+// zero-initialized ring is already valid before begin():
+//   lap base            - free for the producer claiming this lap
+//   lap base + 1        - message ready for the drain
+//   lap base + DEPTH    - printed, free for the next lap
+#define LOG_QUEUE_MASK (LOG_QUEUE_DEPTH - 1)
+
+static_assert((LOG_QUEUE_DEPTH & LOG_QUEUE_MASK) == 0, "LOG_QUEUE_DEPTH must be a power of two");
+
+Logger::Slot Logger::slots[LOG_QUEUE_DEPTH];
+std::atomic<uint32_t> Logger::head(0);
+uint32_t Logger::tail = 0;
+std::atomic<uint32_t> Logger::dropped(0);
+static_assert(LOG_MODULE_COUNT == 7, "Give the new log module a default level");
+std::atomic<uint8_t> Logger::levels[LOG_MODULE_COUNT] = {
+  { LOG_LEVEL }, { LOG_LEVEL }, { LOG_LEVEL }, { LOG_LEVEL }, { LOG_LEVEL }, { LOG_LEVEL }, { LOG_LEVEL }
+};
+std::atomic<bool> Logger::draining(false);
+
+static TaskHandle_t drainTaskHandle = nullptr;
+
+static const char* const moduleNames[] = {
+  "system", "wifi", "tcp", "mqtt", "display", "config", "power"
+};
+
+static const char* const levelNames[] = { "none", "error", "warn", "info", "debug", "verbose" };
+static const char levelLetters[] = { '-', 'E', 'W', 'I', 'D', 'V' };
+
+static_assert(sizeof(moduleNames) / sizeof(moduleNames[0]) == LOG_MODULE_COUNT, "Name every log module");
+
+static void flushOnShutdown() {
+  Logger::flush();
+}
+
+void Logger::begin() {
+  if (drainTaskHandle) return;
+
+  xTaskCreatePinnedToCore(drainTask, "Log", LOG_TASK_STACK_SIZE, nullptr,
+                          LOG_TASK_PRIORITY, &drainTaskHandle, LOG_TASK_CORE);
+  esp_register_shutdown_handler(flushOnShutdown);
+}
+
+void Logger::log(LogModule module, uint8_t level, const char* format, ...) {
+  // Claim a slot - never waits for the drain
+  uint32_t position = head.load(std::memory_order_relaxed);
+  Slot* slot;
+  for (;;) {
+    slot = &slots[position & LOG_QUEUE_MASK];
+    uint32_t sequence = slot->sequence.load(std::memory_order_acquire);
+    int32_t difference = (int32_t)(sequence - (position & ~LOG_QUEUE_MASK));
+    if (difference == 0) {
+      if (head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (difference < 0) {
+      // Previous lap not printed yet - the ring is full
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    } else {
+      // Another producer took this position
+      position = head.load(std::memory_order_relaxed);
+    }
+  }
+
+  slot->timestamp = millis();
+  slot->module = module;
+  slot->level = level;
+
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(slot->text, sizeof(slot->text), format, args);
+  va_end(args);
+  if (length < 0) length = 0;
+  slot->length = length < (int)sizeof(slot->text) ? length : sizeof(slot->text) - 1;
+
+  slot->sequence.store((position & ~LOG_QUEUE_MASK) + 1, std::memory_order_release);
+
+  if (drainTaskHandle) {
+    xTaskNotifyGive(drainTaskHandle);
+  }
+}
+
+bool Logger::drainOne() {
+  Slot& slot = slots[tail & LOG_QUEUE_MASK];
+  uint32_t lapBase = tail & ~LOG_QUEUE_MASK;
+  if (slot.sequence.load(std::memory_order_acquire) != lapBase + 1) {
+    return false;
+  }
+
+  // Copy out and release the slot before touching the UART
+  char line[LOG_MESSAGE_LENGTH + 32];
+  int prefixLength = snprintf(line, sizeof(line), "[%7lu] %c %s: ", (unsigned long)slot.timestamp,
+                              levelLetters[slot.level], moduleNames[slot.module]);
+  memcpy(line + prefixLength, slot.text, slot.length);
+  size_t lineLength = prefixLength + slot.length;
+
+  slot.sequence.store(lapBase + LOG_QUEUE_DEPTH, std::memory_order_release);
+  tail++;
+
+  Serial.write(reinterpret_cast<const uint8_t*>(line), lineLength);
+  Serial.println();
+  return true;
+}
+
+void Logger::flush() {
+  // One drainer at a time - wait briefly for the drain task to finish its batch
+  unsigned long start = millis();
+  while (draining.exchange(true, std::memory_order_acquire)) {
+    if (millis() - start > 100) return;
+    delay(1);
+  }
+
+  while (drainOne()) {
+  }
+
+  static uint32_t reportedDrops = 0;
+  uint32_t drops = dropped.load(std::memory_order_relaxed);
+  if (drops != reportedDrops) {
+    Serial.printf("[Log] %u messages dropped\n", (unsigned)(drops - reportedDrops));
+    reportedDrops = drops;
+  }
+
+  draining.store(false, std::memory_order_release);
+}
+
+void Logger::drainTask(void* parameter) {
+  for (;;) {
+    // Sleep until a message arrives, then let the rest of a burst queue up
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    vTaskDelay(pdMS_TO_TICKS(LOG_DRAIN_INTERVAL));
+    flush();
+  }
+}
+
+void Logger::setLevel(LogModule module, uint8_t level) {
+  if (module >= LOG_MODULE_COUNT) return;
+  levels[module].store(level > LOG_LEVEL_VERBOSE ? LOG_LEVEL_VERBOSE : level, std::memory_order_relaxed);
+}
+
+void Logger::setAllLevels(uint8_t level) {
+  for (int i = 0; i < LOG_MODULE_COUNT; i++) {
+    setLevel((LogModule)i, level);
+  }
+}
+
+const char* Logger::getModuleName(LogModule module) {
+  return module < LOG_MODULE_COUNT ? moduleNames[module] : "?";
+}
+
+const char* Logger::getLevelName(uint8_t level) {
+  return level <= LOG_LEVEL_VERBOSE ? levelNames[level] : "?";
+}
+
+int Logger::findModule(const char* name) {
+  for (int i = 0; i < LOG_MODULE_COUNT; i++) {
+    if (strcasecmp(name, moduleNames[i]) == 0) return i;
+  }
+  return -1;
+}
+
+int Logger::findLevel(const char* name) {
+  for (int i = 0; i <= LOG_LEVEL_VERBOSE; i++) {
+    if (strcasecmp(name, levelNames[i]) == 0) return i;
+  }
+  return -1;
+}
@@ -0,0 +1,123 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <Arduino.h>
+#include <atomic>
+
+// Log levels - a message is kept when its level is <= the module's level
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+#define LOG_LEVEL_VERBOSE 5
+
+// Build-time level - calls above it compile to nothing
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+// Ring buffer limits
+#define LOG_QUEUE_DEPTH 32                // Pending messages, must be a power of two
+#define LOG_MESSAGE_LENGTH 120            // Longer messages are truncated
+#define LOG_DRAIN_INTERVAL 20             // Drain task period (ms)
+#define LOG_TASK_PRIORITY 1               // Below the display and network tasks
+#define LOG_TASK_STACK_SIZE 3072
+#define LOG_TASK_CORE 0
+
+// Modules with their own runtime level
+enum LogModule {
+  LOG_SYSTEM,
+  LOG_WIFI,
+  LOG_TCP,
+  LOG_MQTT,
+  LOG_DISPLAY,
+  LOG_CONFIG,
+  LOG_POWER,
+  LOG_MODULE_COUNT
+};
+
+/**
+ * Asynchronous levelled logger.
+ *
+ * Callers format straight into a slot of a fixed, lock-free multi-producer
+ * ring and return - the Serial write happens later on a low-priority drain
+ * task, so a full UART FIFO never stalls the display or network task. When
+ * the ring is full the message is dropped and counted instead of blocking.
+ *
+ * Use the LOG_ERROR/LOG_WARN/LOG_INFO/LOG_DEBUG/LOG_VERBOSE macros: they check
+ * the module's runtime level before evaluating any argument, and compile out
+ * entirely above LOG_LEVEL.
+ */
+class Logger {
+public:
+  static void begin();                                  // Start the drain task
+  static void flush();                                  // Drain synchronously (before restart/sleep)
+
+  static bool isEnabled(LogModule module, uint8_t level) {
+    return level <= levels[module].load(std::memory_order_relaxed);
+  }
+  static void log(LogModule module, uint8_t level, const char* format, ...) __attribute__((format(printf, 3, 4)));
+
+  // Runtime levels
+  static void setLevel(LogModule module, uint8_t level);
+  static void setAllLevels(uint8_t level);
+  static uint8_t getLevel(LogModule module) { return levels[module].load(std::memory_order_relaxed); }
+  static const char* getModuleName(LogModule module);
+  static const char* getLevelName(uint8_t level);
+  static int findModule(const char* name);              // -1 if unknown
+  static int findLevel(const char* name);               // -1 if unknown
+  static uint32_t getDroppedCount() { return dropped.load(std::memory_order_relaxed); }
+
+private:
+  struct Slot {
+    std::atomic<uint32_t> sequence;                     // Slot owner: producer when == position
+    uint32_t timestamp;
+    uint8_t module;
+    uint8_t level;
+    uint16_t length;
+    char text[LOG_MESSAGE_LENGTH];
+  };
+
+  static Slot slots[LOG_QUEUE_DEPTH];
+  static std::atomic<uint32_t> head;                    // Next position to claim (producers)
+  static uint32_t tail;                                 // Next position to print (drain only)
+  static std::atomic<uint32_t> dropped;
+  static std::atomic<uint8_t> levels[LOG_MODULE_COUNT];
+  static std::atomic<bool> draining;                    // Drain task or flush() owns the tail
+
+  static bool drainOne();
+  static void drainTask(void* parameter);
+};
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(module, ...) do { if (Logger::isEnabled(module, LOG_LEVEL_ERROR)) Logger::log(module, LOG_LEVEL_ERROR, __VA_ARGS__); } while (0)
+#else
+#define LOG_ERROR(module, ...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(module, ...) do { if (Logger::isEnabled(module, LOG_LEVEL_WARN)) Logger::log(module, LOG_LEVEL_WARN, __VA_ARGS__); } while (0)
+#else
+#define LOG_WARN(module, ...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(module, ...) do { if (Logger::isEnabled(module, LOG_LEVEL_INFO)) Logger::log(module, LOG_LEVEL_INFO, __VA_ARGS__); } while (0)
+#else
+#define LOG_INFO(module, ...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(module, ...) do { if (Logger::isEnabled(module, LOG_LEVEL_DEBUG)) Logger::log(module, LOG_LEVEL_DEBUG, __VA_ARGS__); } while (0)
+#else
+#define LOG_DEBUG(module, ...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_VERBOSE
+#define LOG_VERBOSE(module, ...) do { if (Logger::isEnabled(module, LOG_LEVEL_VERBOSE)) Logger::log(module, LOG_LEVEL_VERBOSE, __VA_ARGS__); } while (0)
+#else
+#define LOG_VERBOSE(module, ...) do {} while (0)
+#endif
+
+#endif // LOGGER_H
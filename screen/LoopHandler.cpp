@@ -1,5 +1,9 @@
 #include "LoopHandler.h"
 #include "SleepHandler.h" 
+#include "StateBroadcaster.h"
+#include "PowerManager.h"
+#include "SystemMonitor.h"
+#include "EventTrace.h"
 
 // Core definitions from SetupHandler.h
 #define NETWORK_CORE 1
@@ -9,113 +13,159 @@
 #define NETWORK_STACK_SIZE 8192
 #define DISPLAY_STACK_SIZE 8192
 
-// Update displayTask_func and networkTask_func to support power save mode
 void displayTask_func(void* parameter) {
   Serial.println("[Display Task] Starting on core " + String(xPortGetCoreID()));
 
-
-  // Track if we're in power save mode
-  bool localPowerSaveMode = false;
+  PowerManager* power = PowerManager::getInstance();
+#ifdef CONFIG_HEAP_USE_HOOKS
+  SystemMonitor* monitor = SystemMonitor::getInstance();
+#endif
+  PowerState appliedState = POWER_ACTIVE;
+  bool boosted = false;
 
   for (;;) {
-    // Get power save mode state via task priority
-    UBaseType_t currentPriority = uxTaskPriorityGet(NULL);
-    localPowerSaveMode = (currentPriority <= tskIDLE_PRIORITY + 1);
+    PowerState powerState = power->getState();
 
     // Check if display controller exists before using it
     if (displayController != nullptr) {
       // Take mutex when accessing shared resources
-      if (xSemaphoreTake(xMutex, 10 / portTICK_PERIOD_MS) == pdTRUE) {
+      TRACE_BEGIN_EVENT(TRACE_MUTEX_WAIT);
+      bool taken = xSemaphoreTake(xMutex, 10 / portTICK_PERIOD_MS) == pdTRUE;
+      TRACE_END_EVENT(TRACE_MUTEX_WAIT, taken);
+      if (taken) {
+        TRACE_BEGIN_EVENT(TRACE_MUTEX_HOLD);
         // Null check again inside critical section
         if (displayController != nullptr) {
-          displayController->update();
+          // The display task owns the panel, so it applies power state changes
+          if (powerState != appliedState) {
+            displayController->applyPowerState(powerState);
+            appliedState = powerState;
+          }
+
+          // Interactive screens render at max frequency, the static clock at the scaled one
+          bool wantBoost = powerState == POWER_ACTIVE && displayController->needsFullSpeed();
+          if (wantBoost != boosted) {
+            if (wantBoost) {
+              power->acquireCpuBoost();
+            } else {
+              power->releaseCpuBoost();
+            }
+            boosted = wantBoost;
+          }
+
+          // Steady-state frames should not allocate - count any that do (needs the heap hooks)
+#ifdef CONFIG_HEAP_USE_HOOKS
+          uint32_t allocationsBefore = monitor->getCurrentTaskAllocations();
+#endif
+          {
+            TRACE_SPAN(TRACE_DISPLAY_FRAME);
+            displayController->update();
+          }
+#ifdef CONFIG_HEAP_USE_HOOKS
+          monitor->recordFrame(monitor->getCurrentTaskAllocations() - allocationsBefore);
+#endif
         }
 
         // Only update knobController if it exists
         if (knobController != nullptr) {
+          TRACE_SPAN(TRACE_KNOB_UPDATE);
           knobController->update();
         }
 
+        TRACE_END_EVENT(TRACE_MUTEX_HOLD, 0);
         xSemaphoreGive(xMutex);
       }
     }
 
-    // Adjust delay based on power save mode
-    if (localPowerSaveMode) {
-      // Longer delay in power save mode - 100ms
-      vTaskDelay(300 / portTICK_PERIOD_MS);
+    TRACE_BEGIN_EVENT(TRACE_TASK_BLOCKED);
+    if (powerState == POWER_IDLE) {
+      // Slow polling lets the CPU light sleep; returns at once when woken
+      power->waitUntilAwake(POWER_IDLE_FRAME_INTERVAL);
     } else {
-      // Normal delay - 10ms
       vTaskDelay(5 / portTICK_PERIOD_MS);
     }
+    TRACE_END_EVENT(TRACE_TASK_BLOCKED, 0);
   }
 }
 
 void networkTask_func(void* parameter) {
   Serial.println("[Network Task] Starting on core " + String(xPortGetCoreID()));
 
-  // Small delay to ensure everything is initialized
-  //vTaskDelay(100 / portTICK_PERIOD_MS);
-
+  PowerManager* power = PowerManager::getInstance();
   unsigned long lastMemCheckTime = 0;
-  bool localPowerSaveMode = false;
+  unsigned long lastHeapTraceTime = 0;
 
   for (;;) {
-    // Get power save mode state via task priority
-    UBaseType_t currentPriority = uxTaskPriorityGet(NULL);
-    localPowerSaveMode = (currentPriority <= tskIDLE_PRIORITY + 1);
+    bool idle = power->getState() == POWER_IDLE;
+
+    // Knob, EEPROM and sleep handling must not wait for Wi-Fi - only the TCP client needs it
+    TRACE_BEGIN_EVENT(TRACE_MUTEX_WAIT);
+    bool taken = xSemaphoreTake(xMutex, 10 / portTICK_PERIOD_MS) == pdTRUE;
+    TRACE_END_EVENT(TRACE_MUTEX_WAIT, taken);
+    if (taken) {
+      TRACE_BEGIN_EVENT(TRACE_MUTEX_HOLD);
+      // Each component is published by its setup stage, possibly after the tasks start
+      if (tcpClient != nullptr) {
+        TRACE_SPAN(TRACE_NETWORK_UPDATE);
+        tcpClient->update();
+      }
+      if (commandHandler != nullptr) {
+        TRACE_SPAN(TRACE_COMMAND_UPDATE);
+        commandHandler->update();
+      }
 
-    // Check if critical components are initialized
-    if (tcpClient != nullptr && commandHandler != nullptr) {
-      // Take mutex when accessing shared resources
-      if (xSemaphoreTake(xMutex, 10 / portTICK_PERIOD_MS) == pdTRUE) {
-        // Null check again inside critical section
-        if (tcpClient != nullptr) {
-          tcpClient->update();
-        }
-        if (commandHandler != nullptr) {
-          commandHandler->update();
-        }
+      // Push coalesced state changes to subscribed TCP clients
+      StateBroadcaster::getInstance()->update();
 
-        // Print memory stats every 30 seconds (or 60 in power save mode)
-        unsigned long currentMillis = millis();
-        unsigned long memInterval = localPowerSaveMode ? 60000 : 30000;
-
-        if (currentMillis - lastMemCheckTime > memInterval) {
-          // Print memory stats
-          Serial.println("Memory Statistics:");
-          Serial.printf("Free heap: %u bytes\n", ESP.getFreeHeap());
-          if (psramFound()) {
-            Serial.printf("Total PSRAM: %u bytes\n", ESP.getPsramSize());
-            Serial.printf("Free PSRAM: %u bytes\n", ESP.getFreePsram());
-          }
-          Serial.printf("Minimum free heap: %u bytes\n", ESP.getMinFreeHeap());
+      // Write batched config changes once they've settled
+      eepromManager.update();
 
-          lastMemCheckTime = currentMillis;
-        }
+      // Print memory stats every 30 seconds (or 60 when idle)
+      unsigned long currentMillis = millis();
+      unsigned long memInterval = idle ? 60000 : 30000;
 
-        xSemaphoreGive(xMutex);
+      // Free heap once a second on the trace timeline
+      if (currentMillis - lastHeapTraceTime >= 1000) {
+        TRACE_COUNTER(TRACE_FREE_HEAP, ESP.getFreeHeap());
+        lastHeapTraceTime = currentMillis;
       }
 
-      // Check for sleep if sleep handler is initialized
-      if (sleepHandler != nullptr) {
-        sleepHandler->checkActivity();
+      if (currentMillis - lastMemCheckTime > memInterval) {
+        // Print memory stats
+        Serial.println("Memory Statistics:");
+        Serial.printf("Free heap: %u bytes\n", ESP.getFreeHeap());
+        Serial.printf("Largest free block: %u bytes\n", ESP.getMaxAllocHeap());
+        if (psramFound()) {
+          Serial.printf("Total PSRAM: %u bytes\n", ESP.getPsramSize());
+          Serial.printf("Free PSRAM: %u bytes\n", ESP.getFreePsram());
+        }
+        Serial.printf("Minimum free heap: %u bytes\n", ESP.getMinFreeHeap());
+
+        lastMemCheckTime = currentMillis;
       }
+
+      TRACE_END_EVENT(TRACE_MUTEX_HOLD, 0);
+      xSemaphoreGive(xMutex);
     }
 
-    // Adjust delay based on power save mode
-    if (localPowerSaveMode) {
-      // Longer delay in power save mode - 250ms
-      vTaskDelay(250 / portTICK_PERIOD_MS);
+    // Check for sleep if sleep handler is initialized - drives the power state
+    if (sleepHandler != nullptr) {
+      sleepHandler->checkActivity();
+    }
+
+    TRACE_BEGIN_EVENT(TRACE_TASK_BLOCKED);
+    if (idle) {
+      // Still often enough for MQTT keepalive and TCP; returns at once when woken
+      power->waitUntilAwake(POWER_IDLE_NETWORK_INTERVAL);
     } else {
-      // Normal delay - 10ms
       vTaskDelay(10 / portTICK_PERIOD_MS);
     }
+    TRACE_END_EVENT(TRACE_TASK_BLOCKED, 0);
   }
 }
 
 LoopHandler::LoopHandler()
-  : lastMemCheckTime(0), tasksStarted(false), powerSaveMode(false) {
+  : lastMemCheckTime(0), tasksStarted(false) {
   Serial.println("LoopHandler initialized");
 }
 
@@ -166,8 +216,8 @@ void LoopHandler::startTasks() {
     NETWORK_CORE            // Core
   );
 
-  // Small delay to let tasks start
-  delay(100);
+  SystemMonitor::getInstance()->trackTask(displayTask, DISPLAY_STACK_SIZE);
+  SystemMonitor::getInstance()->trackTask(networkTask, NETWORK_STACK_SIZE);
 
   // Enable sleep handler now that all components are initialized
   if (sleepHandler && displayController && commandHandler) {
@@ -187,42 +237,3 @@ void LoopHandler::checkMemory() {
   }
   Serial.printf("Minimum free heap: %u bytes\n", ESP.getMinFreeHeap());
 }
-
-void LoopHandler::setPowerSaveMode(bool enabled) {
-  if (powerSaveMode != enabled) {
-    powerSaveMode = enabled;
-
-    // Update task intervals based on power save mode
-    extern TaskHandle_t displayTask;
-    extern TaskHandle_t networkTask;
-
-    if (displayTask != nullptr) {
-
-      // Set lower priority and reduced frequency for display task in power save mode
-      if (powerSaveMode) {
-        displayController->turnDisplayOff();
-        Serial.println("Setting display task to power save mode");
-        vTaskPrioritySet(displayTask, tskIDLE_PRIORITY + 1);
-        // No need to adjust frequency as we'll do this in the task itself
-      } else {
-        Serial.println("Setting display task to normal mode");
-        vTaskPrioritySet(displayTask, DISPLAY_TASK_PRIORITY);
-        displayController->turnDisplayOn();
-      }
-    }
-
-    if (networkTask != nullptr) {
-      // Set lower priority and reduced frequency for network task in power save mode
-      if (powerSaveMode) {
-        Serial.println("Setting network task to power save mode");
-        vTaskPrioritySet(networkTask, tskIDLE_PRIORITY + 1);
-        // No need to adjust frequency as we'll do this in the task itself
-      } else {
-        Serial.println("Setting network task to normal mode");
-        vTaskPrioritySet(networkTask, NETWORK_TASK_PRIORITY);
-      }
-    }
-
-    Serial.println(powerSaveMode ? "Power save mode enabled" : "Power save mode disabled");
-  }
-}
\ No newline at end of file
@@ -32,12 +32,10 @@ public:
     ~LoopHandler();
     
     void handle(); // Main loop handler
-    void setPowerSaveMode(bool enabled); // Set power save mode
 
 private:
     unsigned long lastMemCheckTime;
     bool tasksStarted;
-    bool powerSaveMode;
     
     void checkMemory();
     void startTasks();
@@ -0,0 +1,253 @@
+#include "MQTTDispatcher.h"
+#include <string.h>
+
+// ---------------------------------------------------------------------------
+// PayloadView
+// ---------------------------------------------------------------------------
+
+bool PayloadView::equals(const char* text) const {
+  size_t textLength = strlen(text);
+  return textLength == len && memcmp(data, text, len) == 0;
+}
+
+bool PayloadView::startsWith(const char* prefix) const {
+  size_t prefixLength = strlen(prefix);
+  return prefixLength <= len && memcmp(data, prefix, prefixLength) == 0;
+}
+
+int PayloadView::indexOf(char c, size_t from) const {
+  for (size_t i = from; i < len; i++) {
+    if (data[i] == c) return (int)i;
+  }
+  return -1;
+}
+
+int PayloadView::indexOf(const char* text, size_t from) const {
+  size_t textLength = strlen(text);
+  if (textLength == 0) return from <= len ? (int)from : -1;
+  for (size_t i = from; i + textLength <= len; i++) {
+    if (memcmp(data + i, text, textLength) == 0) return (int)i;
+  }
+  return -1;
+}
+
+PayloadView PayloadView::substr(size_t from, size_t count) const {
+  if (from >= len) return PayloadView(data + len, 0);
+  size_t remaining = len - from;
+  return PayloadView(data + from, count < remaining ? count : remaining);
+}
+
+long PayloadView::toInt() const {
+  size_t i = 0;
+  while (i < len && (data[i] == ' ' || data[i] == '\t')) i++;
+
+  bool negative = false;
+  if (i < len && (data[i] == '-' || data[i] == '+')) {
+    negative = data[i] == '-';
+    i++;
+  }
+
+  long value = 0;
+  while (i < len && data[i] >= '0' && data[i] <= '9') {
+    value = value * 10 + (data[i] - '0');
+    i++;
+  }
+  return negative ? -value : value;
+}
+
+size_t PayloadView::copyTo(char* buffer, size_t bufferSize) const {
+  if (bufferSize == 0) return 0;
+  size_t copyLength = len < bufferSize - 1 ? len : bufferSize - 1;
+  memcpy(buffer, data, copyLength);
+  buffer[copyLength] = '\0';
+  return copyLength;
+}
+
+// ---------------------------------------------------------------------------
+// MQTTDispatcher
+// ---------------------------------------------------------------------------
+
+MQTTDispatcher::MQTTDispatcher() : nodeCount(1), subscriptionCount(0) {
+  // Node 0 is the root (empty level above the first topic segment)
+  nodes[0].segment[0] = '\0';
+  nodes[0].firstChild = -1;
+  nodes[0].nextSibling = -1;
+  nodes[0].subscriberMask = 0;
+  nodes[0].multiLevelMask = 0;
+}
+
+int MQTTDispatcher::findOrAddChild(int parent, const char* segment, size_t segmentLength) {
+  for (int child = nodes[parent].firstChild; child >= 0; child = nodes[child].nextSibling) {
+    if (strlen(nodes[child].segment) == segmentLength &&
+        memcmp(nodes[child].segment, segment, segmentLength) == 0) {
+      return child;
+    }
+  }
+
+  if (nodeCount >= MQTT_TRIE_MAX_NODES || segmentLength >= MQTT_TRIE_SEGMENT_LENGTH) {
+    return -1;
+  }
+
+  int index = nodeCount++;
+  memcpy(nodes[index].segment, segment, segmentLength);
+  nodes[index].segment[segmentLength] = '\0';
+  nodes[index].firstChild = -1;
+  nodes[index].nextSibling = nodes[parent].firstChild;
+  nodes[index].subscriberMask = 0;
+  nodes[index].multiLevelMask = 0;
+  nodes[parent].firstChild = index;
+  return index;
+}
+
+void MQTTDispatcher::removeNodesFrom(int firstNode) {
+  // Newest first: each new node was linked in front of its parent's children
+  for (int index = nodeCount - 1; index >= firstNode; index--) {
+    for (int parent = 0; parent < index; parent++) {
+      if (nodes[parent].firstChild == index) {
+        nodes[parent].firstChild = nodes[index].nextSibling;
+        break;
+      }
+    }
+  }
+  nodeCount = firstNode;
+}
+
+int MQTTDispatcher::subscribe(const char* filter, MQTTMessageHandler handler, void* context) {
+  if (!filter || !handler || filter[0] == '\0') return -1;
+  if (subscriptionCount >= MQTT_MAX_SUBSCRIPTIONS) return -1;
+  if (strlen(filter) >= MQTT_FILTER_MAX_LENGTH) return -1;
+
+  int id = subscriptionCount;
+  uint32_t bit = 1UL << id;
+  int node = 0;
+  int firstNewNode = nodeCount;
+  const char* level = filter;
+
+  while (true) {
+    const char* separator = strchr(level, '/');
+    size_t levelLength = separator ? (size_t)(separator - level) : strlen(level);
+
+    // '#' must be the last level and matches the parent level plus everything below it
+    if (levelLength == 1 && level[0] == '#') {
+      if (separator) {
+        removeNodesFrom(firstNewNode);
+        return -1;
+      }
+      nodes[node].multiLevelMask |= bit;
+      break;
+    }
+
+    node = findOrAddChild(node, level, levelLength);
+    if (node < 0) {
+      removeNodesFrom(firstNewNode);
+      return -1;
+    }
+
+    if (!separator) {
+      nodes[node].subscriberMask |= bit;
+      break;
+    }
+    level = separator + 1;
+  }
+
+  strcpy(subscriptions[id].filter, filter);
+  subscriptions[id].handler = handler;
+  subscriptions[id].context = context;
+  subscriptionCount++;
+  return id;
+}
+
+void MQTTDispatcher::matchLevel(int nodeIndex, const char* topicLevel, uint32_t& mask) const {
+  const TrieNode& node = nodes[nodeIndex];
+
+  // A '#' below this node matches whatever is left of the topic
+  mask |= node.multiLevelMask;
+
+  if (topicLevel == nullptr) {
+    mask |= node.subscriberMask;
+    return;
+  }
+
+  const char* separator = strchr(topicLevel, '/');
+  size_t levelLength = separator ? (size_t)(separator - topicLevel) : strlen(topicLevel);
+  const char* nextLevel = separator ? separator + 1 : nullptr;
+
+  for (int child = node.firstChild; child >= 0; child = nodes[child].nextSibling) {
+    const char* segment = nodes[child].segment;
+    bool isWildcard = segment[0] == '+' && segment[1] == '\0';
+    if (isWildcard ||
+        (strlen(segment) == levelLength && memcmp(segment, topicLevel, levelLength) == 0)) {
+      matchLevel(child, nextLevel, mask);
+    }
+  }
+}
+
+uint32_t MQTTDispatcher::match(const char* topic) const {
+  uint32_t mask = 0;
+  if (topic) matchLevel(0, topic, mask);
+  return mask;
+}
+
+int MQTTDispatcher::dispatch(const char* topic, const PayloadView& payload) const {
+  uint32_t mask = match(topic);
+  int delivered = 0;
+
+  for (int id = 0; mask != 0 && id < subscriptionCount; id++) {
+    if (mask & (1UL << id)) {
+      subscriptions[id].handler(topic, payload, subscriptions[id].context);
+      mask &= ~(1UL << id);
+      delivered++;
+    }
+  }
+  return delivered;
+}
+
+const char* MQTTDispatcher::getFilter(int id) const {
+  if (id < 0 || id >= subscriptionCount) return "";
+  return subscriptions[id].filter;
+}
+
+// ---------------------------------------------------------------------------
+// MQTTMessageQueue
+// ---------------------------------------------------------------------------
+
+MQTTMessageQueue::MQTTMessageQueue() : head(0), tail(0), dropped(0) {
+}
+
+bool MQTTMessageQueue::push(const char* topic, const PayloadView& payload) {
+  uint8_t currentHead = head.load(std::memory_order_relaxed);
+  uint8_t nextHead = (currentHead + 1) % MQTT_QUEUE_DEPTH;
+
+  if (nextHead == tail.load(std::memory_order_acquire)) {
+    dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  Message& slot = slots[currentHead];
+  strncpy(slot.topic, topic, sizeof(slot.topic) - 1);
+  slot.topic[sizeof(slot.topic) - 1] = '\0';
+  slot.length = (uint16_t)payload.copyTo(slot.payload, sizeof(slot.payload));
+
+  head.store(nextHead, std::memory_order_release);
+  return true;
+}
+
+const MQTTMessageQueue::Message* MQTTMessageQueue::front() const {
+  uint8_t currentTail = tail.load(std::memory_order_relaxed);
+  if (currentTail == head.load(std::memory_order_acquire)) {
+    return nullptr;
+  }
+  return &slots[currentTail];
+}
+
+void MQTTMessageQueue::pop() {
+  uint8_t currentTail = tail.load(std::memory_order_relaxed);
+  if (currentTail == head.load(std::memory_order_acquire)) {
+    return;
+  }
+  tail.store((currentTail + 1) % MQTT_QUEUE_DEPTH, std::memory_order_release);
+}
+
+void MQTTMessageQueue::enqueueHandler(const char* topic, const PayloadView& payload, void* queue) {
+  static_cast<MQTTMessageQueue*>(queue)->push(topic, payload);
+}
@@ -0,0 +1,138 @@
+#ifndef MQTT_DISPATCHER_H
+#define MQTT_DISPATCHER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+// Dispatcher limits - everything is statically sized so dispatch never allocates
+#define MQTT_MAX_SUBSCRIPTIONS 16        // Maximum number of registered topic filters
+#define MQTT_TRIE_MAX_NODES 48           // Maximum number of trie nodes across all filters
+#define MQTT_TRIE_SEGMENT_LENGTH 24      // Maximum length of a single topic level
+#define MQTT_FILTER_MAX_LENGTH 64        // Maximum length of a full topic filter
+
+// Queue limits
+#define MQTT_QUEUE_DEPTH 8               // Messages buffered per queue
+#define MQTT_QUEUE_TOPIC_LENGTH 48       // Maximum stored topic length
+#define MQTT_QUEUE_PAYLOAD_LENGTH 160    // Maximum stored payload length
+
+/**
+ * Non-owning view over an MQTT payload.
+ *
+ * The view points directly into the PubSubClient receive buffer (or a queue
+ * slot) and is only valid for the duration of the handler call that receives it.
+ */
+class PayloadView {
+private:
+  const char* data;
+  size_t len;
+
+public:
+  PayloadView() : data(nullptr), len(0) {}
+  PayloadView(const char* payloadData, size_t payloadLength) : data(payloadData), len(payloadLength) {}
+
+  const char* begin() const { return data; }
+  size_t length() const { return len; }
+  bool isEmpty() const { return len == 0; }
+  char operator[](size_t index) const { return data[index]; }
+
+  bool equals(const char* text) const;                 // Exact comparison with a C string
+  bool startsWith(const char* prefix) const;           // Prefix comparison with a C string
+  int indexOf(char c, size_t from = 0) const;          // Position of a character, -1 if missing
+  int indexOf(const char* text, size_t from = 0) const; // Position of a substring, -1 if missing
+  PayloadView substr(size_t from, size_t count = (size_t)-1) const; // Sub-view, clamped to bounds
+  long toInt() const;                                  // Parse a leading (optionally signed) integer
+  size_t copyTo(char* buffer, size_t bufferSize) const; // Copy into a buffer and null terminate
+};
+
+// Handler signature for topic subscriptions
+typedef void (*MQTTMessageHandler)(const char* topic, const PayloadView& payload, void* context);
+
+/**
+ * Topic filter trie.
+ *
+ * Filters are split on '/' and stored as a tree of levels at registration time,
+ * so dispatching a topic walks each level once instead of comparing strings
+ * against every subscription. Supports the MQTT '+' (single level) and '#'
+ * (remaining levels) wildcards.
+ */
+class MQTTDispatcher {
+private:
+  struct TrieNode {
+    char segment[MQTT_TRIE_SEGMENT_LENGTH]; // Topic level this node matches ("+" for wildcard)
+    int16_t firstChild;                     // Index of first child node, -1 if none
+    int16_t nextSibling;                    // Index of next sibling node, -1 if none
+    uint32_t subscriberMask;                // Subscriptions whose filter ends at this node
+    uint32_t multiLevelMask;                // Subscriptions with a '#' directly below this node
+  };
+
+  struct Subscription {
+    char filter[MQTT_FILTER_MAX_LENGTH];    // Original filter text (used for broker subscribe)
+    MQTTMessageHandler handler;             // Handler invoked on match
+    void* context;                          // Opaque pointer passed back to the handler
+  };
+
+  TrieNode nodes[MQTT_TRIE_MAX_NODES];
+  int nodeCount;
+  Subscription subscriptions[MQTT_MAX_SUBSCRIPTIONS];
+  int subscriptionCount;
+
+  int findOrAddChild(int parent, const char* segment, size_t segmentLength);
+  void removeNodesFrom(int firstNode);   // Unlink and free nodes added by a failed subscribe
+  void matchLevel(int nodeIndex, const char* topicLevel, uint32_t& mask) const;
+
+public:
+  MQTTDispatcher();
+
+  // Register a handler for a topic filter. Returns the subscription id or -1 if full/invalid.
+  int subscribe(const char* filter, MQTTMessageHandler handler, void* context);
+
+  // Collect the subscriptions matching a topic as a bitmask
+  uint32_t match(const char* topic) const;
+
+  // Invoke every handler whose filter matches the topic. Returns the number of handlers called.
+  int dispatch(const char* topic, const PayloadView& payload) const;
+
+  int getSubscriptionCount() const { return subscriptionCount; }
+  const char* getFilter(int id) const;
+};
+
+/**
+ * Bounded single-producer/single-consumer message queue.
+ *
+ * The MQTT callback runs on the network task while consumers run on the display
+ * task, so matched messages are copied once into a fixed slot and handed over.
+ * When the queue is full new messages are dropped (and counted) instead of
+ * overwriting messages the consumer has not seen yet.
+ */
+class MQTTMessageQueue {
+public:
+  struct Message {
+    char topic[MQTT_QUEUE_TOPIC_LENGTH];
+    char payload[MQTT_QUEUE_PAYLOAD_LENGTH];
+    uint16_t length;
+
+    PayloadView view() const { return PayloadView(payload, length); }
+  };
+
+private:
+  Message slots[MQTT_QUEUE_DEPTH];
+  std::atomic<uint8_t> head;     // Next slot to write (producer)
+  std::atomic<uint8_t> tail;     // Next slot to read (consumer)
+  std::atomic<uint32_t> dropped; // Messages rejected because the queue was full
+
+public:
+  MQTTMessageQueue();
+
+  bool push(const char* topic, const PayloadView& payload); // Producer side, false if full
+  const Message* front() const;                             // Consumer side, nullptr if empty
+  void pop();                                               // Release the slot returned by front()
+
+  bool isEmpty() const { return head.load() == tail.load(); }
+  uint32_t getDroppedCount() const { return dropped.load(); }
+
+  // Handler that can be subscribed directly to enqueue matching messages
+  static void enqueueHandler(const char* topic, const PayloadView& payload, void* queue);
+};
+
+#endif // MQTT_DISPATCHER_H
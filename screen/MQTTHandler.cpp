@@ -2,8 +2,7 @@
 
 MQTTHandler::MQTTHandler(WiFiHandler* wifiHdlr, EEPROMManager* eepromMgr)
   : wifiHandler(wifiHdlr), eepromManager(eepromMgr), mqttClient(wifiClient),
-    mqtt_port(8883), lastMQTTSentTime(0), lastMQTTConnectAttempt(0), useLightConfig(false),
-    soundMessage(""), hasSoundMessage(false) {
+    mqtt_port(8883), lastMQTTSentTime(0), lastMQTTConnectAttempt(0), useLightConfig(false) {
   
   mqtt_broker = "";
   mqtt_username = "";
@@ -19,6 +18,10 @@ MQTTHandler::MQTTHandler(WiFiHandler* wifiHdlr, EEPROMManager* eepromMgr)
   
   // Skip certificate validation for development
   wifiClient.setInsecure();
+
+  // Brightness messages are only logged for now
+  subscribe("esp32/light/brightness", brightnessHandler, this);
+  subscribe(LATENCY_ECHO_TOPIC, echoHandler, this);
 }
 
 MQTTHandler::~MQTTHandler() {
@@ -31,74 +34,99 @@ void MQTTHandler::callback(char* topic, byte* payload, unsigned int length) {
     return;
   }
 
-  Serial.print("📥 Received MQTT Message on topic: ");
-  Serial.println(topic);
+  TRACE_INSTANT(TRACE_MQTT_RECEIVE, length);
+  InputCapture::recordMQTT(topic, payload, length);
+  LOG_INFO(LOG_MQTT, "📥 Received MQTT Message on topic: %s", topic);
 
-  // Safely handle payload
-  char messageBuffer[256] = {0};
-  unsigned int copyLength = length < sizeof(messageBuffer) - 1 ? length : sizeof(messageBuffer) - 1;
-  
-  // Copy payload to buffer
-  memcpy(messageBuffer, payload, copyLength);
-  messageBuffer[copyLength] = '\0'; // Null terminate
-  
-  Serial.println("📩 Message Content: " + String(messageBuffer));
-
-  // Get the device name for sender ID comparison
-  String deviceName = (eepromManager && !eepromManager->deviceName.isEmpty()) 
-                     ? eepromManager->deviceName
-                     : "ESP32"; // Default name
+  // View straight into the PubSubClient buffer - no copies
+  PayloadView message(reinterpret_cast<const char*>(payload), length);
 
   // Check if this message is from myself (contains our sender ID)
-  String senderPrefix = "sender=" + deviceName + ",";
-  if (String(messageBuffer).startsWith(senderPrefix)) {
-    Serial.println("Ignoring message from self");
+  if (isOwnMessage(message)) {
+    LOG_DEBUG(LOG_MQTT, "Ignoring message from self");
     return;
   }
 
-  // Check for sound-related topics
-  if (String(topic) == "esp32/sound/control" || String(topic).startsWith("esp32/sound/")) {
-    // Parse and extract the actual message content (remove sender ID if present)
-    String receivedMessage = String(messageBuffer);
-    if (receivedMessage.indexOf("sender=") >= 0 && receivedMessage.indexOf(',') >= 0) {
-      // Extract the part after the first comma
-      receivedMessage = receivedMessage.substring(receivedMessage.indexOf(',') + 1);
+  // Strip the sender ID so handlers only see the actual command
+  if (message.startsWith("sender=")) {
+    int commaPos = message.indexOf(',');
+    if (commaPos >= 0) {
+      message = message.substr(commaPos + 1);
     }
-    
-    // Store the processed sound message
-    soundMessage = receivedMessage;
-    hasSoundMessage = true;
-    Serial.println("Sound message received: " + soundMessage);
   }
-  
-  // Handle specific topics
-  if (String(topic) == "esp32/light/brightness") {
-    int brightness = atoi(messageBuffer);
-    int waterLevel = (brightness * 100) / 255;
-    Serial.println("Received Brightness via MQTT: " + String(waterLevel));
+
+  if (dispatcher.dispatch(topic, message) == 0) {
+    LOG_WARN(LOG_MQTT, "⚠️ No handler registered for topic %s", topic);
   }
 }
 
+bool MQTTHandler::isOwnMessage(const PayloadView& payload) {
+  // Get the device name for sender ID comparison
+  const char* deviceName = (eepromManager && !eepromManager->deviceName.isEmpty())
+                           ? eepromManager->deviceName.c_str()
+                           : "ESP32"; // Default name
+
+  if (!payload.startsWith("sender=")) return false;
+
+  PayloadView sender = payload.substr(7);
+  size_t nameLength = strlen(deviceName);
+  return sender.length() > nameLength &&
+         sender[nameLength] == ',' &&
+         memcmp(sender.begin(), deviceName, nameLength) == 0;
+}
+
+void MQTTHandler::brightnessHandler(const char* topic, const PayloadView& payload, void* context) {
+  int brightness = payload.toInt();
+  int waterLevel = (brightness * 100) / 255;
+  LOG_INFO(LOG_MQTT, "Received Brightness via MQTT: %d", waterLevel);
+}
+
+void MQTTHandler::echoHandler(const char* topic, const PayloadView& payload, void* context) {
+  MQTTHandler* self = static_cast<MQTTHandler*>(context);
+  if (!payload.startsWith("probe:")) return;
+
+  uint16_t sequence = (uint16_t)payload.substr(6).toInt();
+  LatencyProbe& probe = self->probes[sequence % LATENCY_PROBE_SLOTS];
+  if (probe.sentAt != 0 && probe.sequence == sequence) {
+    LatencyTracer::getInstance()->record(LATENCY_MQTT_ECHO, probe.sentAt);
+    probe.sentAt = 0;
+  }
+}
+
+bool MQTTHandler::subscribe(const char* filter, MQTTMessageHandler handler, void* context) {
+  if (dispatcher.subscribe(filter, handler, context) < 0) {
+    LOG_ERROR(LOG_MQTT, "❌ Failed to register MQTT handler for: %s", filter);
+    return false;
+  }
+
+  // Subscribe on the broker right away if we're already connected,
+  // otherwise connectToMQTTServer() picks it up
+  if (mqttClient.connected()) {
+    mqttClient.subscribe(filter);
+  }
+  return true;
+}
+
 void MQTTHandler::logMQTTState(int state) {
   switch (state) {
-    case -4: Serial.println("⚠️ MQTT Connection failed: MQTT_CONNECTION_TIMEOUT"); break;
-    case -3: Serial.println("⚠️ MQTT Connection failed: MQTT_CONNECTION_LOST"); break;
-    case -2: Serial.println("⚠️ MQTT Connection failed: MQTT_CONNECT_FAILED"); break;
-    case -1: Serial.println("⚠️ MQTT Connection failed: MQTT_DISCONNECTED"); break;
-    case 0: Serial.println("⚠️ MQTT Connection failed: MQTT_CONNECTED"); break;
-    case 1: Serial.println("⚠️ MQTT Connection failed: MQTT_CONNECT_BAD_PROTOCOL"); break;
-    case 2: Serial.println("⚠️ MQTT Connection failed: MQTT_CONNECT_BAD_CLIENT_ID"); break;
-    case 3: Serial.println("⚠️ MQTT Connection failed: MQTT_CONNECT_UNAVAILABLE"); break;
-    case 4: Serial.println("⚠️ MQTT Connection failed: MQTT_CONNECT_BAD_CREDENTIALS"); break;
-    case 5: Serial.println("⚠️ MQTT Connection failed: MQTT_CONNECT_UNAUTHORIZED"); break;
-    default: Serial.println("⚠️ MQTT Connection failed: Unknown error"); break;
+    case -4: LOG_WARN(LOG_MQTT, "⚠️ MQTT Connection failed: MQTT_CONNECTION_TIMEOUT"); break;
+    case -3: LOG_WARN(LOG_MQTT, "⚠️ MQTT Connection failed: MQTT_CONNECTION_LOST"); break;
+    case -2: LOG_WARN(LOG_MQTT, "⚠️ MQTT Connection failed: MQTT_CONNECT_FAILED"); break;
+    case -1: LOG_WARN(LOG_MQTT, "⚠️ MQTT Connection failed: MQTT_DISCONNECTED"); break;
+    case 0: LOG_WARN(LOG_MQTT, "⚠️ MQTT Connection failed: MQTT_CONNECTED"); break;
+    case 1: LOG_WARN(LOG_MQTT, "⚠️ MQTT Connection failed: MQTT_CONNECT_BAD_PROTOCOL"); break;
+    case 2: LOG_WARN(LOG_MQTT, "⚠️ MQTT Connection failed: MQTT_CONNECT_BAD_CLIENT_ID"); break;
+    case 3: LOG_WARN(LOG_MQTT, "⚠️ MQTT Connection failed: MQTT_CONNECT_UNAVAILABLE"); break;
+    case 4: LOG_WARN(LOG_MQTT, "⚠️ MQTT Connection failed: MQTT_CONNECT_BAD_CREDENTIALS"); break;
+    case 5: LOG_WARN(LOG_MQTT, "⚠️ MQTT Connection failed: MQTT_CONNECT_UNAUTHORIZED"); break;
+    default: LOG_WARN(LOG_MQTT, "⚠️ MQTT Connection failed: Unknown error"); break;
   }
 }
 
 void MQTTHandler::initializeMQTT(bool useLightConfig) {
   // Safety check before trying to access EEPROM manager
   if (!eepromManager) {
-    Serial.println("Error: EEPROM manager is null in initializeMQTT");
+    LOG_ERROR(LOG_MQTT, "EEPROM manager is null in initializeMQTT");
     return;
   }
 
@@ -112,18 +140,18 @@ void MQTTHandler::initializeMQTT(bool useLightConfig) {
     mqtt_port = eepromManager->lightMQTTServerPort;
     mqtt_username = eepromManager->lightMQTTUsername;
     mqtt_password = eepromManager->lightMQTTPassword;
-    Serial.println("Using Light MQTT configuration");
+    LOG_INFO(LOG_MQTT, "Using Light MQTT configuration");
   } else {
     mqtt_broker = eepromManager->soundMQTTServerURL;
     mqtt_port = eepromManager->soundMQTTServerPort;
     mqtt_username = eepromManager->soundMQTTUsername;
     mqtt_password = eepromManager->soundMQTTPassword;
-    Serial.println("Using Sound MQTT configuration");
+    LOG_INFO(LOG_MQTT, "Using Sound MQTT configuration");
   }
 
   // Check for empty values to avoid crashes
   if (mqtt_broker.isEmpty()) {
-    Serial.println("Warning: MQTT broker URL is empty");
+    LOG_WARN(LOG_MQTT, "MQTT broker URL is empty");
     return;
   }
 
@@ -133,22 +161,18 @@ void MQTTHandler::initializeMQTT(bool useLightConfig) {
   }
 
   // Print configuration
-  Serial.println("=== MQTT Configuration ===");
-  Serial.println("Broker: " + mqtt_broker);
-  Serial.println("Port: " + String(mqtt_port));
-  Serial.println("Username: " + mqtt_username);
-  Serial.println("Password length: " + String(mqtt_password.length()));
-  Serial.println("==========================");
+  LOG_INFO(LOG_MQTT, "Broker: %s:%d, username: %s, password length: %u", mqtt_broker.c_str(), mqtt_port,
+           mqtt_username.c_str(), mqtt_password.length());
   
   // Set the server (don't connect yet)
   mqttClient.setServer(mqtt_broker.c_str(), mqtt_port);
   
-  Serial.println("MQTT client initialized successfully");
+  LOG_INFO(LOG_MQTT, "MQTT client initialized successfully");
 }
 
 bool MQTTHandler::connectToMQTTServer() {
   if(connecting){
-    Serial.println("Already trying to connect to MQTT server!");
+    LOG_DEBUG(LOG_MQTT, "Already trying to connect to MQTT server");
     return false;
   }
   connecting = true;
@@ -161,22 +185,21 @@ bool MQTTHandler::connectToMQTTServer() {
 
   // Check if MQTT client is already connected
   if (mqttClient.connected()) {
-    Serial.println("✅ Already connected to MQTT Broker.");
+    LOG_DEBUG(LOG_MQTT, "✅ Already connected to MQTT Broker.");
     return true;
   }
 
   // Validate MQTT configuration
   if (mqtt_broker.isEmpty()) {
-    Serial.println("⚠️ MQTT Broker URL is not configured. Skipping connection.");
+    LOG_WARN(LOG_MQTT, "⚠️ MQTT Broker URL is not configured. Skipping connection.");
     connecting = false;
     return false;
   }
 
-  Serial.print("🔄 Attempting MQTT connection to: ");
-  Serial.println(mqtt_broker + ":" + String(mqtt_port));
+  LOG_INFO(LOG_MQTT, "🔄 Attempting MQTT connection to: %s:%d", mqtt_broker.c_str(), mqtt_port);
 
   // Debug memory available before connection attempt
-  Serial.println("Free heap before MQTT connect: " + String(esp_get_free_heap_size()));
+  LOG_DEBUG(LOG_MQTT, "Free heap before MQTT connect: %u", (unsigned)esp_get_free_heap_size());
 
   // Make sure device name isn't empty
   String deviceNameStr = "ESP32";
@@ -190,8 +213,7 @@ bool MQTTHandler::connectToMQTTServer() {
            deviceNameStr.substring(0, 8).c_str(), 
            (uint16_t)random(0xFFFF));
 
-  Serial.print("Client ID: ");
-  Serial.println(clientId);
+  LOG_DEBUG(LOG_MQTT, "Client ID: %s", clientId);
 
   // Convert String values to char arrays to avoid potential memory issues
   char usernameBuf[MAX_USERNAME_LENGTH] = {0};
@@ -204,17 +226,20 @@ bool MQTTHandler::connectToMQTTServer() {
     mqtt_password.toCharArray(passwordBuf, sizeof(passwordBuf));
   }
 
-  Serial.print("MQTT username: ");
-  Serial.println(usernameBuf);
-  Serial.println("Setting timeout for connection attempt...");
+  LOG_DEBUG(LOG_MQTT, "MQTT username: %s", usernameBuf);
   
   // Only try once to avoid freezing if there are connectivity issues
   bool connectResult = false;
   
-  // Safely attempt the connection
-  connectResult = mqttClient.connect(clientId, 
-                                    mqtt_username.isEmpty() ? nullptr : usernameBuf,
-                                    mqtt_password.isEmpty() ? nullptr : passwordBuf);
+  // Safely attempt the connection - TLS handshake runs at max CPU frequency
+  {
+    CpuBoost boost;
+    TraceSpan connectSpan(TRACE_MQTT_CONNECT);
+    connectResult = mqttClient.connect(clientId, 
+                                      mqtt_username.isEmpty() ? nullptr : usernameBuf,
+                                      mqtt_password.isEmpty() ? nullptr : passwordBuf);
+    connectSpan.setResult(connectResult);
+  }
   
   // If connection fails, we'll just try again later
   if (!connectResult) {
@@ -224,71 +249,97 @@ bool MQTTHandler::connectToMQTTServer() {
     if (internetNowAvailable) {
       // If we still have internet, it was another type of connection failure
       int state = mqttClient.state();
-      Serial.print("\n⚠️ Failed to connect to MQTT Broker, state: ");
-      Serial.println(state);
+      LOG_WARN(LOG_MQTT, "⚠️ Failed to connect to MQTT Broker, state: %d", state);
       logMQTTState(state);
       connecting = false;
     } else {
-      Serial.println("\n⚠️ Internet connectivity lost during MQTT connection attempt.");
+      LOG_WARN(LOG_MQTT, "⚠️ Internet connectivity lost during MQTT connection attempt.");
       connecting = false;
     }
     return false;
   }
 
   // Connection succeeded
-  Serial.println("\n✅ Successfully connected to MQTT Broker!");
+  LOG_INFO(LOG_MQTT, "✅ Successfully connected to MQTT Broker!");
   connecting = false;
-  // Subscribe to topics
-  mqttClient.subscribe("esp32/sound/control");
-  mqttClient.subscribe("esp32/sound/setpoint");
-  mqttClient.subscribe("esp32/sound/response");
+  // Subscribe to every registered topic filter
+  for (int i = 0; i < dispatcher.getSubscriptionCount(); i++) {
+    mqttClient.subscribe(dispatcher.getFilter(i));
+  }
   
-  Serial.println("📩 Subscribed to MQTT topics");
+  LOG_INFO(LOG_MQTT, "📩 Subscribed to %d MQTT topics", dispatcher.getSubscriptionCount());
   initialized = true;
   return true;
 }
 
-void MQTTHandler::sendMQTTMessage(const char* topic, const String& message) {
+void MQTTHandler::sendMQTTMessage(const char* topic, const char* message, LatencyStamp inputStamp) {
   // Skip if no internet or MQTT not configured
   if (!wifiHandler->isInternetAvailable() || mqtt_broker.isEmpty()) {
     // Log that we would have sent a message, but didn't due to no internet
-    Serial.print("⚠️ Not sending MQTT message (no internet/broker) - Topic: ");
-    Serial.print(topic);
-    Serial.print(", Message: ");
-    Serial.println(message);
+    LOG_DEBUG(LOG_MQTT, "⚠️ Not sending MQTT message (no internet/broker) - Topic: %s, Message: %s", topic, message);
     return;
   }
 
   // Get device name for sender ID
-  String deviceNameStr = "QNOB";
-  if (eepromManager && !eepromManager->deviceName.isEmpty()) {
-    deviceNameStr = eepromManager->deviceName;
-  }
-
-  // Add sender ID to the message if not already there
-  String fullMessage;
-  if (!message.startsWith("sender=")) {
-    fullMessage = "sender=" + deviceNameStr + "," + message;
-  } else {
-    fullMessage = message;
-  }
+  const char* deviceName = (eepromManager && !eepromManager->deviceName.isEmpty())
+                           ? eepromManager->deviceName.c_str()
+                           : "QNOB";
 
   unsigned long currentMillis = millis();
   if (mqttClient.connected() && (currentMillis - lastMQTTSentTime >= 100)) {
-    // Convert message to char array
-    char messageBuffer[256] = {0};
-    if (fullMessage.length() < sizeof(messageBuffer) - 1) {
-      fullMessage.toCharArray(messageBuffer, sizeof(messageBuffer));
-      mqttClient.publish(topic, messageBuffer);
-      Serial.println("📤 Sent MQTT message on topic [" + String(topic) + "]: " + fullMessage);
+    // Add sender ID to the message if not already there - formatted in place, no String
+    char messageBuffer[256];
+    int length = strncmp(message, "sender=", 7) == 0
+                 ? snprintf(messageBuffer, sizeof(messageBuffer), "%s", message)
+                 : snprintf(messageBuffer, sizeof(messageBuffer), "sender=%s,%s", deviceName, message);
+    if (length >= 0 && length < (int)sizeof(messageBuffer)) {
+      {
+        TraceSpan publishSpan(TRACE_MQTT_PUBLISH);
+        publishSpan.setResult(length);
+        mqttClient.publish(topic, messageBuffer);
+      }
+      LatencyTracer::getInstance()->record(LATENCY_KNOB_TO_PUBLISH, inputStamp);
+      LOG_INFO(LOG_MQTT, "📤 Sent MQTT message on topic [%s]: %s", topic, messageBuffer);
       lastMQTTSentTime = currentMillis;
     } else {
-      Serial.println("⚠️ MQTT message too long (max 255 chars)");
+      LOG_WARN(LOG_MQTT, "⚠️ MQTT message too long (max 255 chars)");
     }
   } else if (!mqttClient.connected()) {
     // Let the user know we couldn't send due to not being connected
-    Serial.println("⚠️ MQTT client not connected, queuing reconnection");
+    LOG_WARN(LOG_MQTT, "⚠️ MQTT client not connected, queuing reconnection");
+  } else if (inputStamp != 0) {
+    // Dropped by the rate limit - the traced input never left the device
+    LatencyTracer::getInstance()->recordLost(LATENCY_KNOB_TO_PUBLISH);
+  }
+}
+
+void MQTTHandler::startLatencyProbes(int count) {
+  probesRemaining = count;
+  lastProbeTime = 0;
+}
+
+void MQTTHandler::sendLatencyProbe() {
+  const char* deviceName = (eepromManager && !eepromManager->deviceName.isEmpty())
+                           ? eepromManager->deviceName.c_str()
+                           : "QNOB";
+
+  // A probe still waiting in this slot has waited through a whole run of newer ones
+  uint16_t sequence = ++probeSequence;
+  LatencyProbe& probe = probes[sequence % LATENCY_PROBE_SLOTS];
+  if (probe.sentAt != 0) {
+    LatencyTracer::getInstance()->recordLost(LATENCY_MQTT_ECHO);
+  }
+
+  // Published directly - probes must not eat into the setpoint rate limit
+  char probeBuffer[64];
+  snprintf(probeBuffer, sizeof(probeBuffer), "sender=%s,probe:%u", deviceName, (unsigned)sequence);
+  probe.sequence = sequence;
+  probe.sentAt = LatencyTracer::now();
+  if (!mqttClient.publish(LATENCY_PROBE_TOPIC, probeBuffer)) {
+    probe.sentAt = 0;
+    LatencyTracer::getInstance()->recordLost(LATENCY_MQTT_ECHO);
   }
+  probesRemaining--;
 }
 
 bool MQTTHandler::hasSoundMQTTConfigured() {
@@ -305,20 +356,6 @@ bool MQTTHandler::isMQTTConnected() {
   return wifiHandler->isInternetAvailable() && mqttClient.connected();
 }
 
-// New method to check for sound messages
-bool MQTTHandler::getHasSoundMessage() {
-  if (hasSoundMessage) {
-    hasSoundMessage = false; // Reset the flag after checking
-    return true;
-  }
-  return false;
-}
-
-// New method to get the sound message content
-String MQTTHandler::getSoundMessage() {
-  return soundMessage;
-}
-
 void MQTTHandler::update() {
   // Get current time once
   unsigned long currentMillis = millis();
@@ -327,7 +364,7 @@ void MQTTHandler::update() {
   if (!wifiHandler->isInternetAvailable()) {
     // If we were connected but now internet is gone, disconnect cleanly
     if (mqttClient.connected()) {
-      Serial.println("Internet connectivity lost, MQTT will disconnect");
+      LOG_WARN(LOG_MQTT, "Internet connectivity lost, MQTT will disconnect");
       mqttClient.disconnect();
     }
     return;
@@ -338,14 +375,22 @@ void MQTTHandler::update() {
     if (!mqttClient.connected()) {
       // Only try to connect once per minute to avoid blocking other operations
       if (currentMillis - lastMQTTConnectAttempt >= MQTT_RECONNECT_DELAY) {
-        Serial.println("Internet available, attempting periodic MQTT connection");
+        LOG_INFO(LOG_MQTT, "Internet available, attempting periodic MQTT connection");
         connectToMQTTServer();
         lastMQTTConnectAttempt = currentMillis;
       }
     } else {
       // We're connected, process incoming MQTT messages
       // This is non-blocking and should be called regularly
-      mqttClient.loop();
+      {
+        TRACE_SPAN(TRACE_MQTT_LOOP);
+        mqttClient.loop();
+      }
+
+      if (probesRemaining > 0 && currentMillis - lastProbeTime >= LATENCY_PROBE_INTERVAL) {
+        sendLatencyProbe();
+        lastProbeTime = currentMillis;
+      }
     }
   } else if (currentMillis - lastMQTTConnectAttempt >= MQTT_RECONNECT_DELAY) {
     // If the broker URL is empty but we have internet, try initializing again
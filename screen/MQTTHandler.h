@@ -2,16 +2,28 @@
 #define MQTT_HANDLER_H
 
 #include <WiFiClientSecure.h>
+#include "PowerManager.h"
 // Increase MQTT packet size before including PubSubClient
 #define MQTT_MAX_PACKET_SIZE 1024
 #include <PubSubClient.h>
 #include "WiFiHandler.h"
 #include "EEPROMManager.h"
+#include "MQTTDispatcher.h"
+#include "Logger.h"
+#include "LatencyTracer.h"
+#include "EventTrace.h"
+#include "InputCapture.h"
 
 // MQTT Configuration
 #define MQTT_CONNECTION_TIMEOUT 10000  // 10 seconds timeout for MQTT connections
 #define MQTT_RECONNECT_DELAY 5000      // 5 seconds between reconnection attempts
 
+// Broker round-trip probes - the PC app echoes each probe back
+#define LATENCY_PROBE_TOPIC "esp32/latency/probe"
+#define LATENCY_ECHO_TOPIC "esp32/latency/echo"
+#define LATENCY_PROBE_INTERVAL 250     // ms between the probes of a run
+#define LATENCY_PROBE_SLOTS 8          // Probes awaiting their echo; older ones count as lost
+
 class MQTTHandler {
 private:
   WiFiHandler* wifiHandler;            // Reference to WiFi handler
@@ -33,12 +45,25 @@ private:
   unsigned long lastMQTTSentTime = 0;
   unsigned long lastMQTTConnectAttempt = 0;
   
-  // Sound message handling
-  String soundMessage;                 // Latest sound message content
-  bool hasSoundMessage = false;        // Flag for new sound message
+  // Topic routing
+  MQTTDispatcher dispatcher;           // Topic filter trie with registered handlers
+
+  // Echo probes in flight, indexed by sequence number % LATENCY_PROBE_SLOTS
+  struct LatencyProbe {
+    uint16_t sequence;
+    LatencyStamp sentAt;               // 0 once echoed or lost
+  };
+  LatencyProbe probes[LATENCY_PROBE_SLOTS] = {};
+  uint16_t probeSequence = 0;
+  int probesRemaining = 0;             // Probes left in the current run
+  unsigned long lastProbeTime = 0;
   
   // Helper methods
   void logMQTTState(int state);        // Log MQTT connection state
+  bool isOwnMessage(const PayloadView& payload); // Check for our own "sender=<name>," prefix
+  static void brightnessHandler(const char* topic, const PayloadView& payload, void* context);
+  static void echoHandler(const char* topic, const PayloadView& payload, void* context);
+  void sendLatencyProbe();             // Publish the next probe of a run
   
   // Callback method for MQTT messages
   static void staticCallback(char* topic, byte* payload, unsigned int length, void* object);
@@ -50,13 +75,14 @@ public:
 
   // MQTT methods
   void initializeMQTT(bool useLightConfig = false); // Initialize MQTT with stored credentials
+  bool isUsingLightConfig() const { return useLightConfig; } // Light broker selected
   bool connectToMQTTServer();          // Connect to MQTT broker
-  void sendMQTTMessage(const char* topic, const String& message); // Send MQTT message
+  void sendMQTTMessage(const char* topic, const char* message, LatencyStamp inputStamp = 0); // Send MQTT message (traced input recorded on publish)
+  void startLatencyProbes(int count);  // Measure broker round trip to the PC app with count echo probes
   bool isMQTTConnected();              // Check if MQTT is connected
   
-  // Sound message methods
-  bool getHasSoundMessage();           // Check if a new sound message is available (resets flag)
-  String getSoundMessage();            // Get the content of the sound message
+  // Subscription methods
+  bool subscribe(const char* filter, MQTTMessageHandler handler, void* context); // Register a topic handler (+ and # allowed)
   String name;
   
   // Configuration check methods
@@ -4,6 +4,7 @@
 #include <Arduino_GFX_Library.h>
 #include "TouchPanel.h"
 #include "WiFiTCPClient.h"
+#include "Sprite.h"
 
 class ModeController {
 private:
@@ -15,10 +16,7 @@ private:
   bool active;   // Determines if the controller should handle input
   const int modeCount = 3;
 
-  void drawThermometer();
-  void drawBulb();
-  void drawSpeaker();
-  void drawModeLogo();
+  void drawModeLogo();  // The mode's sprite and title over the previous mode's
 
 public:
   ModeController(Arduino_GFX* graphics, TouchPanel* touch, WiFiTCPClient* client);
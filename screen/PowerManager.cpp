@@ -0,0 +1,277 @@
+#include "PowerManager.h"
+#include "SleepHandler.h"   // Wakeup pin definitions
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#ifdef CONFIG_PM_LIGHT_SLEEP_CALLBACKS
+#include <hal/gpio_ll.h>
+#include <soc/gpio_struct.h>
+#endif
+
+// Interrupt types the touch (CST816S) and knob (software serial) drivers use,
+// restored when the pins stop being light sleep wakeup sources
+#define TOUCH_PIN_INTR_TYPE GPIO_INTR_NEGEDGE
+#define KNOB_PIN_INTR_TYPE GPIO_INTR_ANYEDGE
+
+#ifdef CONFIG_PM_LIGHT_SLEEP_CALLBACKS
+static volatile bool wakePinsAllowed = false; // IDLE - the sleep callbacks may arm the pins
+static bool wakePinsArmed = false;            // Pins are level triggered for the current sleep
+
+// Wakeup needs level triggering, which would storm the drivers' ISRs and break
+// the software serial timing while the CPU runs, so the pins only switch to it
+// for the duration of each light sleep. These run with interrupts disabled,
+// hence the register-level calls.
+static esp_err_t IRAM_ATTR armWakePins(int64_t sleepTimeUs, void* arg) {
+  if (wakePinsAllowed) {
+    gpio_ll_set_intr_type(&GPIO, WAKEUP_PIN_TOUCH, GPIO_INTR_LOW_LEVEL);
+    gpio_ll_set_intr_type(&GPIO, WAKEUP_PIN_KNOB, GPIO_INTR_LOW_LEVEL);   // UART start bit
+    gpio_ll_wakeup_enable(&GPIO, WAKEUP_PIN_TOUCH);
+    gpio_ll_wakeup_enable(&GPIO, WAKEUP_PIN_KNOB);
+    wakePinsArmed = true;
+  }
+  return ESP_OK;
+}
+
+static esp_err_t IRAM_ATTR releaseWakePins(int64_t sleepTimeUs, void* arg) {
+  if (wakePinsArmed) {
+    gpio_ll_wakeup_disable(&GPIO, WAKEUP_PIN_TOUCH);
+    gpio_ll_wakeup_disable(&GPIO, WAKEUP_PIN_KNOB);
+    gpio_ll_set_intr_type(&GPIO, WAKEUP_PIN_TOUCH, TOUCH_PIN_INTR_TYPE);
+    gpio_ll_set_intr_type(&GPIO, WAKEUP_PIN_KNOB, KNOB_PIN_INTR_TYPE);
+    wakePinsArmed = false;
+  }
+  return ESP_OK;
+}
+#endif
+
+static const char* stateNames[POWER_STATE_COUNT] = {
+  "active", "dimmed", "idle", "deep"
+};
+
+// Static instance for singleton pattern
+static PowerManager* instance = nullptr;
+
+PowerManager* PowerManager::getInstance() {
+  if (instance == nullptr) {
+    instance = new PowerManager();
+  }
+  return instance;
+}
+
+PowerManager::PowerManager()
+  : state(POWER_ACTIVE), pmConfigured(false), lightSleepAvailable(false),
+    boostCount(0), boostStartUs(0), boostResidencyUs(0) {
+#ifdef CONFIG_PM_ENABLE
+  cpuMaxLock = nullptr;
+#endif
+  residencyMux = portMUX_INITIALIZER_UNLOCKED;
+  stateEnteredUs = esp_timer_get_time();
+  for (int i = 0; i < POWER_STATE_COUNT; i++) {
+    stateResidencyUs[i] = 0;
+  }
+
+  stateMutex = xSemaphoreCreateMutex();
+  powerEvents = xEventGroupCreate();
+  xEventGroupSetBits(powerEvents, POWER_STATE_BIT(POWER_ACTIVE));
+}
+
+const char* PowerManager::getStateName(PowerState state) {
+  return (state >= 0 && state < POWER_STATE_COUNT) ? stateNames[state] : "";
+}
+
+void PowerManager::begin() {
+#ifdef CONFIG_FREERTOS_USE_TICKLESS_IDLE
+  lightSleepAvailable = true;
+#else
+  Serial.println("⚠️ Tickless idle not enabled in this build, light sleep unavailable");
+#endif
+  configurePM(false);
+
+#ifdef CONFIG_PM_LIGHT_SLEEP_CALLBACKS
+  esp_pm_sleep_cbs_register_config_t sleepCallbacks = {};
+  sleepCallbacks.enter_cb = armWakePins;
+  sleepCallbacks.exit_cb = releaseWakePins;
+  if (esp_pm_light_sleep_register_cbs(&sleepCallbacks) != ESP_OK) {
+    Serial.println("❌ Failed to register light sleep callbacks");
+  }
+#else
+  if (lightSleepAvailable) {
+    Serial.println("⚠️ No light sleep callbacks in this build, touch and knob won't wake light sleep");
+  }
+#endif
+
+#ifdef CONFIG_PM_ENABLE
+  if (pmConfigured && cpuMaxLock == nullptr) {
+    if (esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "cpu_boost", &cpuMaxLock) != ESP_OK) {
+      Serial.println("❌ Failed to create CPU boost lock");
+      cpuMaxLock = nullptr;
+    } else if (boostCount > 0) {
+      // Boost was requested before frequency scaling was configured
+      esp_pm_lock_acquire(cpuMaxLock);
+    }
+  }
+#endif
+}
+
+void PowerManager::configurePM(bool lightSleep) {
+#ifdef CONFIG_PM_ENABLE
+  // Before IDF 5 each chip has its own config type
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+  esp_pm_config_t config;
+#elif defined(CONFIG_IDF_TARGET_ESP32S3)
+  esp_pm_config_esp32s3_t config;
+#elif defined(CONFIG_IDF_TARGET_ESP32S2)
+  esp_pm_config_esp32s2_t config;
+#elif defined(CONFIG_IDF_TARGET_ESP32C3)
+  esp_pm_config_esp32c3_t config;
+#else
+  esp_pm_config_esp32_t config;
+#endif
+  config.max_freq_mhz = POWER_MAX_CPU_FREQ;
+  config.min_freq_mhz = POWER_MIN_CPU_FREQ;
+  config.light_sleep_enable = lightSleep && lightSleepAvailable;
+
+  esp_err_t result = esp_pm_configure(&config);
+  if (result != ESP_OK) {
+    Serial.printf("❌ esp_pm_configure failed: %s\n", esp_err_to_name(result));
+    return;
+  }
+  pmConfigured = true;
+#else
+  (void)lightSleep;
+#endif
+}
+
+void PowerManager::configureWakeGPIOs(bool enable) {
+#ifdef CONFIG_PM_LIGHT_SLEEP_CALLBACKS
+  // The pins keep their edge interrupts - armWakePins switches them per sleep
+  if (enable) {
+    esp_sleep_enable_gpio_wakeup();
+  }
+  wakePinsAllowed = enable;
+#else
+  (void)enable;
+#endif
+}
+
+void PowerManager::setState(PowerState newState) {
+  // Activity reports this on every input - skip the lock when nothing changes
+  if (newState == state || newState < 0 || newState >= POWER_STATE_COUNT) {
+    return;
+  }
+
+  // Both tasks move the state - keep each transition and its PM reconfiguration whole
+  xSemaphoreTake(stateMutex, portMAX_DELAY);
+  if (newState == state) {
+    xSemaphoreGive(stateMutex);
+    return;
+  }
+
+  PowerState oldState = state;
+
+  int64_t now = esp_timer_get_time();
+  portENTER_CRITICAL(&residencyMux);
+  stateResidencyUs[oldState] += now - stateEnteredUs;
+  stateEnteredUs = now;
+  state = newState;
+  portEXIT_CRITICAL(&residencyMux);
+
+  // Light sleep only while IDLE
+  if (newState == POWER_IDLE) {
+    configureWakeGPIOs(true);
+    configurePM(true);
+  } else if (oldState == POWER_IDLE) {
+    configurePM(false);
+    configureWakeGPIOs(false);
+  }
+
+  // Swap the state bit - waiters on POWER_AWAKE_BITS are released here
+  xEventGroupClearBits(powerEvents, POWER_STATE_BIT(oldState));
+  xEventGroupSetBits(powerEvents, POWER_STATE_BIT(newState));
+
+  xSemaphoreGive(stateMutex);
+
+  Serial.printf("🔄 Power state: %s -> %s\n", getStateName(oldState), getStateName(newState));
+}
+
+bool PowerManager::waitUntilAwake(uint32_t timeoutMs) {
+  EventBits_t bits = xEventGroupWaitBits(powerEvents, POWER_AWAKE_BITS, pdFALSE, pdFALSE,
+                                         timeoutMs / portTICK_PERIOD_MS);
+  return (bits & POWER_AWAKE_BITS) != 0;
+}
+
+void PowerManager::acquireCpuBoost() {
+  portENTER_CRITICAL(&residencyMux);
+  bool first = boostCount++ == 0;
+  if (first) {
+    boostStartUs = esp_timer_get_time();
+  }
+  portEXIT_CRITICAL(&residencyMux);
+
+#ifdef CONFIG_PM_ENABLE
+  // esp_pm locks count acquisitions themselves, only the outermost one is needed
+  if (first && cpuMaxLock) {
+    esp_pm_lock_acquire(cpuMaxLock);
+  }
+#endif
+}
+
+void PowerManager::releaseCpuBoost() {
+  portENTER_CRITICAL(&residencyMux);
+  bool last = boostCount > 0 && --boostCount == 0;
+  if (last) {
+    boostResidencyUs += esp_timer_get_time() - boostStartUs;
+  }
+  portEXIT_CRITICAL(&residencyMux);
+
+#ifdef CONFIG_PM_ENABLE
+  if (last && cpuMaxLock) {
+    esp_pm_lock_release(cpuMaxLock);
+  }
+#endif
+}
+
+String PowerManager::getResidencyReport() {
+  // Snapshot including the time spent in the current state/boost so far
+  int64_t stateUs[POWER_STATE_COUNT];
+  int64_t now = esp_timer_get_time();
+
+  portENTER_CRITICAL(&residencyMux);
+  for (int i = 0; i < POWER_STATE_COUNT; i++) {
+    stateUs[i] = stateResidencyUs[i];
+  }
+  stateUs[state] += now - stateEnteredUs;
+  int64_t boostUs = boostResidencyUs + (boostCount > 0 ? now - boostStartUs : 0);
+  PowerState currentState = state;
+  int holders = boostCount;
+  portEXIT_CRITICAL(&residencyMux);
+
+  double totalMs = now / 1000.0;
+  char line[80];
+  String report;
+
+  snprintf(line, sizeof(line), "[Power] state %s, CPU %lu MHz, boost holders %d\n",
+           getStateName(currentState), (unsigned long)getCpuFrequencyMhz(), holders);
+  report += line;
+
+  for (int i = 0; i < POWER_STATE_COUNT; i++) {
+    snprintf(line, sizeof(line), "[Power] %-7s %10.1f s  %5.1f%%\n",
+             getStateName((PowerState)i), stateUs[i] / 1000000.0,
+             totalMs > 0 ? stateUs[i] / 10.0 / totalMs : 0.0);
+    report += line;
+  }
+
+  if (!pmConfigured) {
+    report += "[Power] frequency scaling unavailable, CPU fixed at " + String(getCpuFrequencyMhz()) + " MHz";
+    return report;
+  }
+
+  int64_t scaledUs = now - boostUs;
+  snprintf(line, sizeof(line), "[Power] %3d MHz %10.1f s  %5.1f%%\n",
+           POWER_MAX_CPU_FREQ, boostUs / 1000000.0, totalMs > 0 ? boostUs / 10.0 / totalMs : 0.0);
+  report += line;
+  snprintf(line, sizeof(line), "[Power] %3d MHz %10.1f s  %5.1f%% (or below in light sleep)",
+           POWER_MIN_CPU_FREQ, scaledUs / 1000000.0, totalMs > 0 ? scaledUs / 10.0 / totalMs : 0.0);
+  report += line;
+  return report;
+}
@@ -0,0 +1,113 @@
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+#include <freertos/semphr.h>
+#include <esp_pm.h>
+
+// Power states, in order of increasing inactivity
+enum PowerState {
+  POWER_ACTIVE,         // Full brightness, full frame rate
+  POWER_DIMMED,         // Backlight dimmed, full frame rate
+  POWER_IDLE,           // Display off, slow polling, automatic light sleep
+  POWER_DEEP,           // About to enter deep sleep
+  POWER_STATE_COUNT
+};
+
+#define POWER_STATE_BIT(state) (1UL << (state))
+#define POWER_AWAKE_BITS (POWER_STATE_BIT(POWER_ACTIVE) | POWER_STATE_BIT(POWER_DIMMED))
+
+// Inactivity thresholds (deep sleep threshold lives in SleepHandler.h)
+#define POWER_DIM_TIMEOUT 15000       // Dim the backlight after 15 seconds
+#define POWER_IDLE_TIMEOUT 30000      // Display off and light sleep after 30 seconds
+
+// Task periods in IDLE - tasks wake early when the state leaves IDLE
+#define POWER_IDLE_FRAME_INTERVAL 100    // Display task polls touch/knob (ms)
+#define POWER_IDLE_NETWORK_INTERVAL 250  // Network task, well inside the MQTT keepalive (ms)
+
+// Backlight levels (0-255)
+#define BACKLIGHT_FULL 255
+#define BACKLIGHT_DIMMED 40
+
+// Dynamic frequency scaling range
+#define POWER_MAX_CPU_FREQ 240
+#define POWER_MIN_CPU_FREQ 80         // Lowest frequency Wi-Fi keeps working at
+
+/**
+ * Owns the device power state.
+ *
+ * SleepHandler moves the state according to inactivity. The current state is
+ * held as exactly one bit in a FreeRTOS event group, so tasks can read it
+ * cheaply or block until the device is awake again. Entering IDLE enables
+ * ESP-IDF automatic light sleep (tickless idle); leaving IDLE turns it off
+ * again. The touch interrupt and knob RX lines wake the chip only when the
+ * build has light sleep callbacks (CONFIG_PM_LIGHT_SLEEP_CALLBACKS), since
+ * their level wakeup may only be armed for the duration of each sleep.
+ * Otherwise the IDLE polling timers end each sleep.
+ *
+ * With frequency scaling the CPU runs at POWER_MIN_CPU_FREQ unless someone
+ * holds a CPU boost (esp_pm ESP_PM_CPU_FREQ_MAX lock) - boot, interactive
+ * rendering and TLS handshakes do. Time spent per power state and with or
+ * without the boost is accumulated for the power command.
+ */
+class PowerManager {
+private:
+  EventGroupHandle_t powerEvents;     // One bit per PowerState, exactly one set
+  SemaphoreHandle_t stateMutex;       // Serializes setState between tasks
+  volatile PowerState state;
+  bool pmConfigured;                  // esp_pm accepted a configuration
+  bool lightSleepAvailable;           // Build supports automatic light sleep
+
+#ifdef CONFIG_PM_ENABLE
+  esp_pm_lock_handle_t cpuMaxLock;    // Held while boosted
+#endif
+  portMUX_TYPE residencyMux;          // Guards the counters below
+  int boostCount;                     // Nested boost holders
+  int64_t stateEnteredUs;             // When the current state was entered
+  int64_t boostStartUs;               // When the boost was taken (boostCount > 0)
+  int64_t stateResidencyUs[POWER_STATE_COUNT]; // Completed time per state
+  int64_t boostResidencyUs;           // Completed time at max frequency
+
+  // Private constructor - enforces singleton pattern
+  PowerManager();
+
+  void configurePM(bool lightSleep);  // Apply DFS / light sleep settings
+  void configureWakeGPIOs(bool enable); // Allow or stop the light sleep wakeup pins
+
+public:
+  // Creates the singleton instance of PowerManager
+  static PowerManager* getInstance();
+
+  // Configure frequency scaling - call once during boot
+  void begin();
+
+  // Move to a new state and notify waiting tasks (safe from any task)
+  void setState(PowerState newState);
+  PowerState getState() const { return state; }
+  bool isAwake() const { return state == POWER_ACTIVE || state == POWER_DIMMED; }
+
+  // Block until the device is ACTIVE or DIMMED, or the timeout expires
+  bool waitUntilAwake(uint32_t timeoutMs);
+
+  EventGroupHandle_t getEventGroup() const { return powerEvents; }
+  static const char* getStateName(PowerState state);
+
+  // Hold the CPU at max frequency (nestable, safe from any task)
+  void acquireCpuBoost();
+  void releaseCpuBoost();
+  bool isCpuBoosted() const { return boostCount > 0; }
+
+  // Time per power state and per CPU frequency since boot
+  String getResidencyReport();
+};
+
+// Holds a CPU boost for the lifetime of the object
+class CpuBoost {
+public:
+  CpuBoost() { PowerManager::getInstance()->acquireCpuBoost(); }
+  ~CpuBoost() { PowerManager::getInstance()->releaseCpuBoost(); }
+};
+
+#endif // POWER_MANAGER_H
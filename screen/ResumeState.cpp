@@ -0,0 +1,57 @@
+#include "ResumeState.h"
+#include <esp_sleep.h>
+
+struct StoredResumeState {
+  uint32_t magic;
+  uint32_t version;
+  ResumeSnapshot snapshot;
+  uint8_t reserved[3];                 // Keeps the checksum aligned without padding
+  uint32_t checksum;
+};
+
+// RTC slow memory - zeroed on power-on, kept across deep sleep
+RTC_DATA_ATTR static StoredResumeState storedState;
+RTC_DATA_ATTR static uint32_t sleepCount = 0;
+
+static uint32_t resumeChecksum(const StoredResumeState& state) {
+  // FNV-1a over everything but the checksum field
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&state);
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < offsetof(StoredResumeState, checksum); i++) {
+    hash = (hash ^ bytes[i]) * 16777619UL;
+  }
+  return hash;
+}
+
+void ResumeState::save(const ResumeSnapshot& snapshot) {
+  storedState.magic = RESUME_STATE_MAGIC;
+  storedState.version = RESUME_STATE_VERSION;
+  storedState.snapshot = snapshot;
+  storedState.checksum = resumeChecksum(storedState);
+  sleepCount++;
+}
+
+bool ResumeState::load(ResumeSnapshot& snapshot) {
+  if (esp_sleep_get_wakeup_cause() != ESP_SLEEP_WAKEUP_EXT1) {
+    return false;
+  }
+
+  if (storedState.magic != RESUME_STATE_MAGIC ||
+      storedState.version != RESUME_STATE_VERSION ||
+      storedState.checksum != resumeChecksum(storedState)) {
+    Serial.println("⚠️ Resume state invalid, doing a full boot");
+    return false;
+  }
+
+  snapshot = storedState.snapshot;
+  return true;
+}
+
+void ResumeState::clear() {
+  storedState.magic = 0;
+  storedState.checksum = 0;
+}
+
+uint32_t ResumeState::getSleepCount() {
+  return sleepCount;
+}
@@ -0,0 +1,40 @@
+#ifndef RESUME_STATE_H
+#define RESUME_STATE_H
+
+#include <Arduino.h>
+
+#define RESUME_STATE_MAGIC 0x51525354   // "QRST"
+#define RESUME_STATE_VERSION 1
+
+// UI and connection state carried across deep sleep
+struct ResumeSnapshot {
+  uint8_t mode;                        // Mode shown before going to sleep
+  uint8_t soundSetpoint;               // Sound volume setpoint (0-100)
+  uint8_t lightSetpoint;               // Light level (0-100)
+  uint8_t playing;                     // Media was playing (0/1)
+  uint8_t mqttLightConfig;             // MQTT was using the light broker (0/1)
+};
+
+/**
+ * Keeps a ResumeSnapshot in RTC slow memory, which survives deep sleep.
+ *
+ * The snapshot is written right before esp_deep_sleep_start() and consumed on
+ * the next EXT1 wake. It's protected by magic, version and checksum so a cold
+ * boot or a firmware with a different layout falls back to a full boot.
+ */
+class ResumeState {
+public:
+  // Store the snapshot - call right before entering deep sleep
+  static void save(const ResumeSnapshot& snapshot);
+
+  // Fetch the snapshot if this boot is a deep sleep wake with valid state
+  static bool load(ResumeSnapshot& snapshot);
+
+  // Forget the snapshot (a second wake without a new sleep must cold boot)
+  static void clear();
+
+  // Deep sleep cycles since the last cold boot
+  static uint32_t getSleepCount();
+};
+
+#endif // RESUME_STATE_H
@@ -0,0 +1,52 @@
+#include "RoundPanel.h"
+
+RoundPanel::RoundPanel(Arduino_DataBus* bus, int8_t rst, uint8_t rotation, bool ips, int16_t w, int16_t h)
+  : Arduino_GC9A01(bus, rst, rotation, ips, w, h), panelWidth(w), panelHeight(min(h, (int16_t)ROUND_PANEL_MAX_HEIGHT)) {
+  // A pixel is visible when any part of it is inside the circle, measured
+  // from the corner nearest the centre
+  long radius2 = (long)(w / 2) * (w / 2);
+  for (int y = 0; y < panelHeight; y++) {
+    long dy = y < h / 2 ? h / 2 - 1 - y : y - h / 2;
+    int x = 0;
+    while (x < w / 2) {
+      long dx = w / 2 - 1 - x;
+      if (dx * dx + dy * dy < radius2) break;
+      x++;
+    }
+    firstVisible[y] = x;
+  }
+}
+
+bool RoundPanel::isVisible(int16_t x, int16_t y) const {
+  if (y < 0 || y >= panelHeight) {
+    return false;
+  }
+  return x >= firstVisible[y] && x < panelWidth - firstVisible[y];
+}
+
+void RoundPanel::writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (w <= 0 || h <= 0) {
+    return;
+  }
+  int16_t right = x + w - 1;
+  int16_t bottom = min((int16_t)(y + h - 1), (int16_t)(panelHeight - 1));
+
+  while (y <= bottom) {
+    int16_t first = max(x, (int16_t)firstVisible[y]);
+    int16_t last = min(right, (int16_t)(panelWidth - 1 - firstVisible[y]));
+
+    if (first == x && last == right) {
+      // Spans only widen towards the middle row, so the rows the rectangle
+      // fits in are consecutive - send them as one block
+      int16_t band = y;
+      while (band < bottom && isVisible(x, band + 1) && isVisible(right, band + 1)) band++;
+      Arduino_GC9A01::writeFillRectPreclipped(x, y, w, band - y + 1, color);
+      y = band + 1;
+      continue;
+    }
+    if (first <= last) {
+      Arduino_GC9A01::writeFillRectPreclipped(first, y, last - first + 1, 1, color);
+    }
+    y++;
+  }
+}
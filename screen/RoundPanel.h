@@ -0,0 +1,36 @@
+#ifndef ROUND_PANEL_H
+#define ROUND_PANEL_H
+
+#include <Arduino_GFX_Library.h>
+
+#define ROUND_PANEL_MAX_HEIGHT 240  // Rows in the visible span table
+
+/**
+ * GC9A01 that never sends the pixels outside its round glass.
+ *
+ * The corners of the 240x240 frame are not on the panel - about 21% of a full
+ * screen clear. Every rectangle the library fills (fillScreen, fillRect, fast
+ * lines, the scanlines of circles and arcs) ends in writeFillRectPreclipped,
+ * which cuts it to each row's visible span before it goes over SPI. The rows
+ * where the rectangle lies wholly inside the circle are still sent as one
+ * block, so only the rows it leaves the circle on cost an address window each.
+ *
+ * Single pixels and bitmaps are not masked; they are drawn where the
+ * screens put them, which is on the glass.
+ */
+class RoundPanel : public Arduino_GC9A01 {
+public:
+  RoundPanel(Arduino_DataBus* bus, int8_t rst = GFX_NOT_DEFINED, uint8_t rotation = 0, bool ips = false,
+             int16_t w = 240, int16_t h = 240);
+
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+
+  bool isVisible(int16_t x, int16_t y) const;
+
+private:
+  int16_t panelWidth;
+  int16_t panelHeight;
+  uint8_t firstVisible[ROUND_PANEL_MAX_HEIGHT]; // By row: first column on the glass, the last mirrors it
+};
+
+#endif // ROUND_PANEL_H
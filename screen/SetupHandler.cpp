@@ -1,4 +1,11 @@
 #include "SetupHandler.h"
+#include "StateBroadcaster.h"
+#include "ResumeState.h"
+#include "esp_timer.h"
+#include "Logger.h"
+#include "SystemMonitor.h"
+#include "RoundPanel.h"
+#include "EventTrace.h"
 
 // Global component instances
 WiFiTCPClient* tcpClient = nullptr;
@@ -17,12 +24,63 @@ volatile bool displayInitialized = false;
 volatile bool networkInitialized = false;
 volatile bool initComplete = false;
 
+// Boot stage graph
+struct BootStageInfo {
+    const char* name;
+    EventBits_t dependsOn;               // Stages that must be finished first
+    int core;                            // Worker core, or BOOT_INLINE
+    int progressWeight;                  // Share of the progress bar (sums to 100)
+    bool deferredOnResume;               // Finishes in the background after a warm resume
+    void (*init)();
+};
+
+#define STAGE_BIT(stage) (1UL << SetupHandler::stage)
+
+static const BootStageInfo bootStages[SetupHandler::BOOT_STAGE_COUNT] = {
+    { "display",  0,                                                            BOOT_INLINE,  15, false, &SetupHandler::initDisplay },
+    { "eeprom",   0,                                                            DISPLAY_CORE, 10, false, &SetupHandler::initEEPROM },
+    { "knob",     0,                                                            DISPLAY_CORE,  5, false, &SetupHandler::initKnob },
+    { "wifi",     STAGE_BIT(STAGE_EEPROM),                                      NETWORK_CORE, 50, true,  &SetupHandler::initWiFiTCP },
+    { "commands", STAGE_BIT(STAGE_DISPLAY) | STAGE_BIT(STAGE_EEPROM) | STAGE_BIT(STAGE_KNOB), BOOT_INLINE, 10, false, &SetupHandler::initCommandHandler },
+    { "sleep",    0,                                                            BOOT_INLINE,   5, false, &SetupHandler::initSleepHandler },
+    { "tasks",    STAGE_BIT(STAGE_DISPLAY) | STAGE_BIT(STAGE_WIFI_TCP) | STAGE_BIT(STAGE_COMMAND_HANDLER) | STAGE_BIT(STAGE_SLEEP_HANDLER), BOOT_INLINE, 5, false, &SetupHandler::startTasks },
+};
+
+#define ALL_STAGES ((1UL << SetupHandler::BOOT_STAGE_COUNT) - 1)
+
+// Timing of the last boot, kept after SetupHandler is destroyed
+struct BootStageTiming {
+    int64_t startUs;                     // Since reset (esp_timer)
+    int64_t endUs;
+    int core;
+};
+
+static BootStageTiming bootTimings[SetupHandler::BOOT_STAGE_COUNT];
+static int64_t setupStartUs = 0;         // Reset to setup()
+static int64_t bootCompleteUs = 0;       // Reset to pipeline done
+static int64_t firstFrameUs = 0;         // Reset to first screen drawn after a warm resume
+
+// Shared with stage tasks, which may outlive SetupHandler after a warm resume
+static EventGroupHandle_t bootEvents = nullptr;  // One bit per finished stage
+static bool warmResume = false;
+static EventBits_t deferredStages = 0;           // Stages not waited for this boot
+static ResumeSnapshot resumeSnapshot;
+
 // Constructor explicitly initializes mutex first thing
 SetupHandler::SetupHandler() : 
-    currentState(INIT_START), 
-    progressValue(0) {
+    launchedStages(0),
+    requiredStages(ALL_STAGES),
+    progressValue(0),
+    setupComplete(false) {
+    
+    setupStartUs = esp_timer_get_time();
+    bootCompleteUs = 0;
+    firstFrameUs = 0;
+    memset(bootTimings, 0, sizeof(bootTimings));
     
     Serial.begin(115200);
+    Logger::begin();
+    EventTrace::begin();
     Serial.println("\n\n----- Starting device initialization -----");
     
     // Check PSRAM
@@ -44,6 +102,28 @@ SetupHandler::SetupHandler() :
         }
     }
     
+    if (bootEvents == nullptr) {
+        bootEvents = xEventGroupCreate();
+    }
+    
+    // Frequency scaling from here on, boot itself runs at max frequency
+    PowerManager::getInstance()->begin();
+    PowerManager::getInstance()->acquireCpuBoost();
+    
+    // Deep sleep wake with valid RTC state - don't hold the screen for the network
+    warmResume = ResumeState::load(resumeSnapshot);
+    ResumeState::clear();
+    deferredStages = 0;
+    if (warmResume) {
+        for (int i = 0; i < BOOT_STAGE_COUNT; i++) {
+            if (bootStages[i].deferredOnResume) {
+                deferredStages |= 1UL << i;
+            }
+        }
+        requiredStages &= ~deferredStages;
+        Serial.printf("Warm resume after deep sleep #%lu\n", (unsigned long)ResumeState::getSleepCount());
+    }
+    
     // Safeguard - make sure we have initial values for globals
     displayInitialized = false;
     networkInitialized = false;
@@ -56,127 +136,156 @@ SetupHandler::~SetupHandler() {
 }
 
 bool SetupHandler::handle() {
-    bool setupComplete = false;
+    if (setupComplete) {
+        return true;
+    }
     
-    // Always ensure display is updated first
-    if (displayController) {
-        // Update the display to show current progress
-        displayController->update();
-        delay(1); // Brief delay to allow screen refresh
+    // Start everything whose dependencies are done
+    launchReadyStages();
+    
+    EventBits_t doneStages = xEventGroupGetBits(bootEvents) & ALL_STAGES;
+    if (!warmResume) {
+        updateProgress(doneStages);
     }
     
-    static unsigned long lastTransitionTime = 0;
-    unsigned long currentTime = millis();
+    if ((doneStages & requiredStages) == requiredStages) {
+        bootCompleteUs = esp_timer_get_time();
+        PowerManager::getInstance()->releaseCpuBoost();
+        setupComplete = true;
+        initComplete = true;
+        Serial.println("Setup complete!");
+        Serial.println(getBootTimeReport());
+        return true;
+    }
     
-    // Add delay between state transitions to allow screen to update
-    if (currentTime - lastTransitionTime < 50) {
-        return setupComplete; // Return early to give time for screen updates
+    // Keep the screen moving while workers run (the network stage may attach under the mutex)
+    if (displayController && xSemaphoreTake(xMutex, BOOT_FRAME_INTERVAL / portTICK_PERIOD_MS) == pdTRUE) {
+        displayController->update();
+        xSemaphoreGive(xMutex);
+        if (warmResume && firstFrameUs == 0) {
+            firstFrameUs = esp_timer_get_time();
+        }
     }
     
-    switch (currentState) {
-        case INIT_START:
-            Serial.println("Starting initialization sequence");
-            currentState = INIT_DISPLAY;
-            lastTransitionTime = currentTime;
-            break;
-            
-        case INIT_DISPLAY:
-            initDisplay();
-            displayInitialized = true;
-            updateProgress(10);
-            currentState = INIT_EEPROM;
-            lastTransitionTime = currentTime;
-            break;
-            
-        case INIT_EEPROM:
-            initEEPROM();
-            updateProgress(30);
-            currentState = INIT_KNOB;
-            lastTransitionTime = currentTime;
-            break;
-            
-        case INIT_KNOB:
-            initKnob();
-            updateProgress(50);
-            currentState = INIT_COMMAND_HANDLER;
-            lastTransitionTime = currentTime;
-            break;
+    // Sleep until a worker finishes or the next frame is due
+    xEventGroupWaitBits(bootEvents, requiredStages & ~doneStages, pdFALSE, pdFALSE,
+                        BOOT_FRAME_INTERVAL / portTICK_PERIOD_MS);
+    return false;
+}
+
+void SetupHandler::launchReadyStages() {
+    bool launched = true;
+    
+    // Inline stages can unlock further stages, so repeat until nothing new starts
+    while (launched) {
+        launched = false;
+        EventBits_t doneStages = xEventGroupGetBits(bootEvents);
+        EventBits_t inlineStages = 0;
+        
+        // Start every ready worker first so they overlap the inline stages below
+        for (int i = 0; i < BOOT_STAGE_COUNT; i++) {
+            EventBits_t bit = 1UL << i;
+            const BootStageInfo& info = bootStages[i];
+            EventBits_t dependsOn = info.dependsOn & ~deferredStages;
+            if ((launchedStages & bit) || (doneStages & dependsOn) != dependsOn) {
+                continue;
+            }
             
-        case INIT_COMMAND_HANDLER:
-            initCommandHandler();
-            updateProgress(70);
-            currentState = INIT_SLEEP_HANDLER;
-            lastTransitionTime = currentTime;
-            break;
+            launchedStages |= bit;
+            launched = true;
             
-        case INIT_SLEEP_HANDLER:
-            initSleepHandler();
-            updateProgress(80);
-            currentState = INIT_WIFI_TCP;
-            lastTransitionTime = currentTime;
-            break;
+            if (info.core == BOOT_INLINE) {
+                inlineStages |= bit;
+                continue;
+            }
             
-        case INIT_WIFI_TCP:
-            // Do WiFi initialization
-            initWiFiTCP();
-            networkInitialized = true;
-            updateProgress(90);
-            currentState = START_TASKS;
-            lastTransitionTime = currentTime;
-            break;
+            BaseType_t created = xTaskCreatePinnedToCore(
+                stageTask,
+                info.name,
+                BOOT_STAGE_STACK_SIZE,
+                (void*)(intptr_t)i,
+                INIT_TASK_PRIORITY,
+                NULL,
+                info.core
+            );
             
-        case START_TASKS:
-      {
-        static unsigned long completeStartTime = 0;
-        static bool tasksStarted = false;
-        
-        if (!tasksStarted) {
-          startTasks();
-          updateProgress(100);
-          completeStartTime = currentTime;
-          tasksStarted = true;
-          Serial.println("Tasks started, showing 100% progress");
+            if (created != pdPASS) {
+                Serial.printf("⚠️ Could not start %s stage task, running it inline\n", info.name);
+                inlineStages |= bit;
+            }
         }
         
-        // Non-blocking delay - show 100% for 200ms
-        if (currentTime - completeStartTime >= 1000) {
-          currentState = SETUP_COMPLETE;
-          Serial.println("Setup complete!");
-          setupComplete = true;
-          initComplete = true;
-          lastTransitionTime = currentTime;
-          tasksStarted = false; // Reset for next time
-        } else {
-          // Keep updating display while we wait
-          if (displayController) {
-            displayController->update();
-          }
+        // Then run the inline stages on this task
+        for (int i = 0; i < BOOT_STAGE_COUNT; i++) {
+            if (inlineStages & (1UL << i)) {
+                runStage((BootStage)i);
+            }
         }
-      }
-      break;
-      
-    case SETUP_COMPLETE:
-      setupComplete = true;
-      break;
     }
+}
+
+void SetupHandler::runStage(BootStage stage) {
+    BootStageTiming& timing = bootTimings[stage];
+    timing.core = xPortGetCoreID();
+    timing.startUs = esp_timer_get_time();
     
-    return setupComplete;
+    bootStages[stage].init();
+    
+    timing.endUs = esp_timer_get_time();
+    xEventGroupSetBits(bootEvents, 1UL << stage);
 }
 
-void SetupHandler::updateProgress(int progress) {
-    progressValue = progress;
-    if (displayController) {
-        // Force a display update to show progress
+void SetupHandler::stageTask(void* param) {
+    runStage((BootStage)(intptr_t)param);
+    vTaskDelete(NULL);
+}
+
+void SetupHandler::updateProgress(EventBits_t doneStages) {
+    int progress = 0;
+    for (int i = 0; i < BOOT_STAGE_COUNT; i++) {
+        if (doneStages & (1UL << i)) {
+            progress += bootStages[i].progressWeight;
+        }
+    }
+    
+    if (progress != progressValue && displayController) {
+        progressValue = progress;
         displayController->updateInitProgress(progressValue);
-        
-        // Call update immediately to refresh the screen
-        displayController->update();
-        
-        // Small delay to allow the screen to refresh
-        delay(10);
     }
 }
 
+String SetupHandler::getBootTimeReport() {
+    if (bootCompleteUs == 0) {
+        return "[Boot] Boot still in progress";
+    }
+    
+    String report = warmResume ? "[Boot] warm resume from deep sleep\n" : "[Boot] cold boot\n";
+    report += "[Boot] stage     start(ms)  end(ms)  took(ms)  core\n";
+    char line[72];
+    for (int i = 0; i < BOOT_STAGE_COUNT; i++) {
+        const BootStageTiming& timing = bootTimings[i];
+        if (timing.endUs == 0) {
+            // Deferred stage still running in the background
+            snprintf(line, sizeof(line), "[Boot] %-9s %9.1f  running            %d\n",
+                     bootStages[i].name, timing.startUs / 1000.0, timing.core);
+        } else {
+            snprintf(line, sizeof(line), "[Boot] %-9s %9.1f %8.1f %9.1f  %d\n",
+                     bootStages[i].name,
+                     timing.startUs / 1000.0, timing.endUs / 1000.0,
+                     (timing.endUs - timing.startUs) / 1000.0, timing.core);
+        }
+        report += line;
+    }
+    if (firstFrameUs != 0) {
+        snprintf(line, sizeof(line), "[Boot] wake to first frame %.1f ms\n", firstFrameUs / 1000.0);
+        report += line;
+    }
+    snprintf(line, sizeof(line), "[Boot] reset to setup %.1f ms, total %.1f ms",
+             setupStartUs / 1000.0, bootCompleteUs / 1000.0);
+    report += line;
+    return report;
+}
+
 void SetupHandler::initEEPROM() {
     Serial.println("Initializing EEPROM...");
     eepromManager.begin();
@@ -190,19 +299,26 @@ void SetupHandler::initDisplay() {
     if (!gfx) {
         Serial.println("Error: gfx is NULL, initializing it");
         Arduino_DataBus* bus = create_default_Arduino_DataBus();
-        gfx = new Arduino_GC9A01(bus, DF_GFX_RST, 0 /* rotation */, false /* IPS */);
+        gfx = new RoundPanel(bus, DF_GFX_RST, 0 /* rotation */, false /* IPS */);
     }
     
-    if (!gfx->begin()) {
-        Serial.println("Error: gfx->begin() failed!");
-    }
-    
-    // Then initialize display controller
+    // Then initialize display controller (initScreen starts the panel)
+    xSemaphoreTake(xMutex, portMAX_DELAY);
     if (!displayController) {
         displayController = new DisplayController(gfx, 6, 7, 19, 5, nullptr);
         displayController->initScreen();
+        
+        // Skip the init screen and go back to where we were before deep sleep
+        if (warmResume) {
+            displayController->restoreResumeState(resumeSnapshot);
+        }
+        if (tcpClient) {
+            displayController->setTCPClient(tcpClient);
+        }
     }
+    xSemaphoreGive(xMutex);
     
+    displayInitialized = true;
     Serial.println("Display initialized");
 }
 
@@ -210,70 +326,86 @@ void SetupHandler::initKnob() {
     Serial.println("Initializing knob controller...");
     knobController = new KnobController(KNOB_RX_PIN, KNOB_TX_PIN);
     knobController->begin(9600);
-    
-    // Register with display controller
-    if (displayController) {
-        displayController->registerKnobController(knobController);
-    }
     Serial.println("Knob controller initialized");
 }
 
 void SetupHandler::initWiFiTCP() {
     Serial.println("Initializing WiFi/TCP...");
     
-    // Create TCP client if not already created
-    if (tcpClient == nullptr) {
-        tcpClient = new WiFiTCPClient(&eepromManager);
-    }
+    // Connect before publishing the client, so the tasks never see a half-initialized one
+    WiFiTCPClient* client = new WiFiTCPClient(&eepromManager);
+    client->initialize();
+    attachNetwork(client);
+    networkInitialized = true;
     
-    // Start initialization but don't wait for MQTT connection
-    tcpClient->initialize();
+    Serial.println("WiFi/TCP initialized");
+}
+
+void SetupHandler::attachNetwork(WiFiTCPClient* client) {
+    xSemaphoreTake(xMutex, portMAX_DELAY);
+    tcpClient = client;
     
-    // Update TCP client in display controller
+    // Whatever isn't created yet picks the client up when it is
     if (displayController) {
         displayController->setTCPClient(tcpClient);
     }
+    if (commandHandler) {
+        commandHandler->setTCPClient(tcpClient);
+    }
+    StateBroadcaster::getInstance()->setTCPClient(tcpClient);
+    xSemaphoreGive(xMutex);
     
-    // Start MQTT initialization in a separate task
+    // Start MQTT connection in a separate task - handlers are registered by now
     xTaskCreatePinnedToCore(
         [](void* param) {
-            // Wait a moment for other operations to complete
-            vTaskDelay(100 / portTICK_PERIOD_MS);
-            
             Serial.println("Starting MQTT connection in background task...");
+            SystemMonitor::getInstance()->trackTask(xTaskGetCurrentTaskHandle(), MQTT_CONNECT_STACK_SIZE);
             if (tcpClient) {
-                tcpClient->initializeMQTT();
+                // Reconnect to the broker that was in use before deep sleep
+                if (warmResume && resumeSnapshot.mqttLightConfig) {
+                    tcpClient->getMQTTHandler()->initializeMQTT(true);
+                } else {
+                    tcpClient->initializeMQTT();
+                }
                 tcpClient->connectToMQTTServer();
             }
             
+            SystemMonitor::getInstance()->taskExiting();
             vTaskDelete(NULL);
         },
         "MQTTConnectTask",
-        8192,
+        MQTT_CONNECT_STACK_SIZE,
         nullptr,
         1,
         NULL,
         NETWORK_CORE
     );
-    
-    Serial.println("WiFi/TCP initialized (MQTT connecting in background)");
 }
 
 void SetupHandler::initCommandHandler() {
     Serial.println("Initializing command handler...");
-    commandHandler = new CommandHandler(displayController, &eepromManager, tcpClient);
-    commandHandler->initialize();
+    // The network task polls the handler as soon as it is published, so set it up first
+    CommandHandler* handler = new CommandHandler(displayController, &eepromManager, nullptr);
+    handler->initialize();
     
-    // Register knob controller with command handler
+    // Register knob controller with display and command handler
     if (knobController) {
-        commandHandler->registerKnobController(knobController);
+        displayController->registerKnobController(knobController);
+        handler->registerKnobController(knobController);
     }
+    
+    // The network stage may still be running - if so it hands the client over in attachNetwork
+    xSemaphoreTake(xMutex, portMAX_DELAY);
+    handler->setTCPClient(tcpClient);
+    commandHandler = handler;
+    xSemaphoreGive(xMutex);
     Serial.println("Command handler initialized");
 }
 
 void SetupHandler::initSleepHandler() {
     Serial.println("Initializing sleep handler...");
     sleepHandler = SleepHandler::getInstance(&xMutex);
+    sleepHandler->setEEPROMManager(&eepromManager);
     sleepHandler->setInactivityTimeout(30000);  // 30 seconds
     sleepHandler->disable();  // Disabled by default, will be enabled after tasks start
     Serial.println("Sleep handler initialized");
@@ -288,10 +420,8 @@ void SetupHandler::startTasks() {
         sleepHandler->disable();  // Will be enabled by LoopHandler
     }
     
-    // Small delay to let UI update before switching to INFO mode
-    
-    // Switch to INFO mode after initialization
-    if (displayController) {
+    // Switch to INFO mode after initialization (a warm resume is already on its screen)
+    if (displayController && !warmResume) {
         displayController->setMode(INFO);
     }
 }
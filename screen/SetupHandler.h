@@ -11,6 +11,7 @@
 #include "SleepHandler.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/event_groups.h"
 
 // Core definitions
 #define NETWORK_CORE 1  // Core 1 for network/TCP operations (higher priority)
@@ -24,6 +25,12 @@
 // Task stack sizes
 #define NETWORK_STACK_SIZE 8192
 #define DISPLAY_STACK_SIZE 8192
+#define BOOT_STAGE_STACK_SIZE 8192
+#define MQTT_CONNECT_STACK_SIZE 8192
+
+// Boot pipeline
+#define BOOT_INLINE -1           // Stage runs in the setup task instead of a worker
+#define BOOT_FRAME_INTERVAL 10   // Max time between init screen refreshes while waiting on workers (ms)
 
 // Knob communication pins
 #define KNOB_RX_PIN 16
@@ -46,43 +53,70 @@ extern volatile bool displayInitialized;
 extern volatile bool networkInitialized;
 extern volatile bool initComplete;
 
+/**
+ * Boots the device as a dependency graph.
+ *
+ * Each stage lists the stages it needs. As soon as a stage's dependencies
+ * are done it is started - on a worker task pinned to its core, or inline in
+ * the setup task for stages that touch the display. Independent stages (display,
+ * EEPROM, knob UART, then Wi-Fi once EEPROM is loaded) therefore overlap, and the
+ * setup task keeps the init screen animating while it waits. Start and end
+ * times of every stage are kept for the boottime command.
+ *
+ * On a deep sleep wake with valid RTC resume state, the last screen is shown
+ * as soon as the display is up and boot completes without waiting for the
+ * network stage, which keeps connecting in the background.
+ */
 class SetupHandler {
 public:
-    enum SetupState {
-        INIT_START,
-        INIT_EEPROM,
-        INIT_DISPLAY,
-        INIT_KNOB,
-        INIT_WIFI_TCP,
-        INIT_COMMAND_HANDLER,
-        INIT_SLEEP_HANDLER,
-        START_TASKS,
-        SETUP_COMPLETE
+    enum BootStage {
+        STAGE_DISPLAY,
+        STAGE_EEPROM,
+        STAGE_KNOB,
+        STAGE_WIFI_TCP,
+        STAGE_COMMAND_HANDLER,
+        STAGE_SLEEP_HANDLER,
+        STAGE_START_TASKS,
+        BOOT_STAGE_COUNT
     };
 
     SetupHandler();
     ~SetupHandler();
 
-    bool handle(); // Main handle method for state machine, returns true when complete
+    bool handle(); // Runs the boot pipeline, returns true when complete
+
+    // Per-stage timing table of the last boot
+    static String getBootTimeReport();
 
-public:  // Changed from private so lambda can access initWiFiTCP
-    // State machine
-    SetupState currentState;
+private:
+    EventBits_t launchedStages;          // Stages already started
+    EventBits_t requiredStages;          // Stages that must finish before setup returns
     int progressValue;
-    
-    // Initialize specific components
-    void initEEPROM();
-    void initDisplay();
-    void initKnob();
-    void initWiFiTCP();
-    void initCommandHandler();
-    void initSleepHandler();
-    void startTasks();
-    
+    bool setupComplete;
+
+    // Pipeline helpers
+    void launchReadyStages();
+    static void runStage(BootStage stage);
+    static void stageTask(void* param);
+
+    // Hand the network client to everything that needs it (any task, takes xMutex)
+    static void attachNetwork(WiFiTCPClient* client);
+
+public:  // Referenced from the boot stage table
+    // Initialize specific components - stages only touch globals, so a stage
+    // still running after setup() returns doesn't depend on this object
+    static void initEEPROM();
+    static void initDisplay();
+    static void initKnob();
+    static void initWiFiTCP();
+    static void initCommandHandler();
+    static void initSleepHandler();
+    static void startTasks();
+
+private:
     // Helper methods
-    void updateProgress(int progress);
+    void updateProgress(EventBits_t doneStages);
     void printMemoryStats();
-    bool displayInitialized;
 };
 
 
@@ -1,9 +1,5 @@
 #include "SleepHandler.h"
-#include "LoopHandler.h"
-
-void SleepHandler::setLoopHandler(LoopHandler* loop) {
-  loopHandler = loop;
-}
+#include "Logger.h"
 
 // Static instance for singleton pattern
 static SleepHandler* instance = nullptr;
@@ -18,11 +14,10 @@ SleepHandler* SleepHandler::getInstance(SemaphoreHandle_t* mutex) {
 SleepHandler::SleepHandler(SemaphoreHandle_t* mutex)
   : displayController(nullptr),
     commandHandler(nullptr),
-    loopHandler(nullptr),
+    eepromManager(nullptr),
     lastActivityTime(0),
     inactivityTimeout(DEEP_SLEEP_TIMEOUT),  // Default 1 hour
     enabled(false),                         // Disabled by default
-    powerSaveEnabled(false),                // Power save mode disabled by default
     mutexPtr(mutex) {
 
   // Initialize the activity timer
@@ -38,13 +33,19 @@ void SleepHandler::registerControllers(DisplayController* display, CommandHandle
   commandHandler = command;
 }
 
+void SleepHandler::setEEPROMManager(EEPROMManager* manager) {
+  eepromManager = manager;
+}
+
 void SleepHandler::setInactivityTimeout(unsigned long timeoutMs) {
   inactivityTimeout = timeoutMs;
 }
 
 void SleepHandler::resetActivityTime() {
   lastActivityTime = millis();
-  //Serial.println("Sleep timer reset");
+
+  // Wake straight away instead of waiting for the next checkActivity()
+  PowerManager::getInstance()->setState(POWER_ACTIVE);
 }
 
 void SleepHandler::enable() {
@@ -76,12 +77,6 @@ void SleepHandler::checkActivity() {
 
     if (hasActivity) {
       resetActivityTime();
-
-      // If we have activity and were in power save mode, disable it
-      if (powerSaveEnabled && loopHandler) {
-        loopHandler->setPowerSaveMode(false);
-        powerSaveEnabled = false;
-      }
     }
 
     xSemaphoreGive(*mutexPtr);
@@ -91,18 +86,18 @@ void SleepHandler::checkActivity() {
   unsigned long currentTime = millis();
   unsigned long inactivityTime = currentTime - lastActivityTime;
 
-  // Check for power save mode threshold (30 seconds)
-  if (!powerSaveEnabled && inactivityTime >= POWER_SAVE_TIMEOUT && inactivityTime < DEEP_SLEEP_TIMEOUT) {
-    Serial.println("Inactivity threshold reached for power save mode");
-
-    if (loopHandler) {
-      loopHandler->setPowerSaveMode(true);
-      powerSaveEnabled = true;
-    }
+  // Map inactivity onto the power state
+  PowerState target = POWER_ACTIVE;
+  if (inactivityTime >= DEEP_SLEEP_TIMEOUT) {
+    target = POWER_DEEP;
+  } else if (inactivityTime >= POWER_IDLE_TIMEOUT) {
+    target = POWER_IDLE;
+  } else if (inactivityTime >= POWER_DIM_TIMEOUT) {
+    target = POWER_DIMMED;
   }
+  PowerManager::getInstance()->setState(target);
 
-  // Check for deep sleep threshold (1 hour)
-  if (inactivityTime >= DEEP_SLEEP_TIMEOUT) {
+  if (target == POWER_DEEP) {
     Serial.println("Inactivity timeout reached, entering deep sleep");
     enterDeepSleep();
   }
@@ -130,14 +125,29 @@ void SleepHandler::configureWakeupPins() {
   rtc_gpio_pulldown_dis(WAKEUP_PIN_KNOB);
 }
 
+void SleepHandler::releaseWakeupPins() {
+  // Pins stay routed to the RTC domain after a deep sleep wake - the touch
+  // interrupt and knob UART need them back as digital GPIOs
+  rtc_gpio_deinit(WAKEUP_PIN_TOUCH);
+  rtc_gpio_deinit(WAKEUP_PIN_KNOB);
+}
+
 void SleepHandler::enterDeepSleep() {
   // Skip if disabled
   if (!enabled) {
     return;
   }
 
-  // Turn off display if possible
+  // RAM is lost in deep sleep - write out batched config changes
+  if (eepromManager) {
+    eepromManager->commit();
+  }
+
+  // Save UI state for a warm resume, then turn off display if possible
   if (displayController) {
+    ResumeSnapshot snapshot;
+    displayController->captureResumeState(snapshot);
+    ResumeState::save(snapshot);
     displayController->setDisplayOff();
   }
 
@@ -145,6 +155,7 @@ void SleepHandler::enterDeepSleep() {
   configureWakeupPins();
 
   Serial.println("Entering deep sleep...");
+  Logger::flush();  // Pending log lines would be lost
   delay(100);  // Small delay to ensure Serial output completes
 
   // Enter deep sleep mode
@@ -5,29 +5,25 @@
 #include <esp_sleep.h>
 #include "DisplayController.h"
 #include "CommandHandler.h"
-// Remove LoopHandler.h include
-
-// Add forward declaration instead
-class LoopHandler;
+#include "ResumeState.h"
+#include "PowerManager.h"
 
 // GPIO pins for wakeup
 #define WAKEUP_PIN_TOUCH GPIO_NUM_5   // Wakeup when touch screen is pressed and interrupt pin pulls down
 #define WAKEUP_PIN_KNOB GPIO_NUM_16   // Wakeup when motor controller sends a serial command and RX (Pin 16) goes LOW
 
-// Timeout values
-#define POWER_SAVE_TIMEOUT 30000      // 30 seconds of inactivity for power save mode
+// Timeout values (dim/idle thresholds are in PowerManager.h)
 #define DEEP_SLEEP_TIMEOUT 3600000    // 1 hour of inactivity for deep sleep
 
 class SleepHandler {
 private:
     DisplayController* displayController;
     CommandHandler* commandHandler;
-    LoopHandler* loopHandler;         // Added LoopHandler reference
+    EEPROMManager* eepromManager;     // Pending config is committed before deep sleep
     
     unsigned long lastActivityTime;
     unsigned long inactivityTimeout;  // Timeout in milliseconds
     bool enabled;                     // Flag to enable/disable sleep functionality
-    bool powerSaveEnabled;            // Flag for power save mode
     
     SemaphoreHandle_t* mutexPtr;     // Pointer to the application mutex
     
@@ -44,8 +40,8 @@ public:
     // Sets the controllers used to check for activity
     void registerControllers(DisplayController* display, CommandHandler* command);
     
-    // Sets the LoopHandler for power management
-    void setLoopHandler(LoopHandler* loop);
+    // Sets the config store to flush before deep sleep
+    void setEEPROMManager(EEPROMManager* manager);
     
     // Sets the inactivity timeout in milliseconds
     void setInactivityTimeout(unsigned long timeoutMs);
@@ -62,12 +58,15 @@ public:
     // Check if sleep handler is enabled
     bool isEnabled();
     
-    // Check for inactivity and handle sleep if needed
+    // Check for inactivity, update the power state and handle sleep if needed
     void checkActivity();
     
     // Immediately enter deep sleep mode
     void enterDeepSleep();
     
+    // Return the wakeup pins to normal GPIO use after waking from deep sleep
+    static void releaseWakeupPins();
+    
     // Destructor
     ~SleepHandler();
 };
@@ -1,15 +1,42 @@
 #include "SoundController.h"
+#include "StateBroadcaster.h"
 
 SoundController::SoundController(Arduino_GFX* graphics, TouchPanel* touch, MQTTHandler* mqttHandler)
-  : gfx(graphics), touchPanel(touch), mqttHandler(mqttHandler), setpoint(50), lastSetpoint(-1),
-    lastSentSetpoint(-1), lastSetpointChangeTime(0), lastSetpointSentTime(0),
+  : gfx(graphics), touchPanel(touch), mqttHandler(mqttHandler), subscribedHandler(nullptr), udpHandler(nullptr), setpoint(50), lastSetpoint(-1),
+    lastSentSetpoint(-1), lastStreamedSetpoint(-1), lastSetpointChangeTime(0), lastSetpointSentTime(0),
     initialized(false), mqttInitialized(false), stateReceived(false), pageBackRequested(false), lastDrawnSetpoint(-1),
-    colorChange(false), lastSentTime(0), isPlaying(false), externalSetpointChange(false),
+    colorChange(false), lastSentTime(0), isPlaying(false), publishStamp(0), externalSetpointChange(false),
     controllerState(INITIALIZE),
-    playButton(graphics, touch), pauseButton(graphics, touch),
-    rewindButton(graphics, touch), forwardButton(graphics, touch), backButton(graphics, touch),
-    volumeArc(graphics) {
-  // Constructor only initializes variables
+    playButton(graphics), pauseButton(graphics),
+    rewindButton(graphics), forwardButton(graphics), backButton(graphics),
+    volumeArc(graphics), widgets(graphics) {
+  // The arc first - the buttons sit inside it
+  widgets.add(&volumeArc);
+  widgets.add(&playButton);
+  widgets.add(&pauseButton);
+  widgets.add(&rewindButton);
+  widgets.add(&forwardButton);
+  widgets.add(&backButton);
+
+  playButton.setOnRelease(onButtonRelease, this);
+  pauseButton.setOnRelease(onButtonRelease, this);
+  rewindButton.setOnRelease(onButtonRelease, this);
+  forwardButton.setOnRelease(onButtonRelease, this);
+  backButton.setOnRelease(onButtonRelease, this);
+
+  registerMQTTSubscriptions();
+}
+
+void SoundController::registerMQTTSubscriptions() {
+  if (!mqttHandler || mqttHandler == subscribedHandler) {
+    return;
+  }
+
+  // One queue for all three so a state response and the setpoints around it apply in arrival order
+  mqttHandler->subscribe("esp32/sound/setpoint", MQTTMessageQueue::enqueueHandler, &soundQueue);
+  mqttHandler->subscribe("esp32/sound/control", MQTTMessageQueue::enqueueHandler, &soundQueue);
+  mqttHandler->subscribe("esp32/sound/response", MQTTMessageQueue::enqueueHandler, &soundQueue);
+  subscribedHandler = mqttHandler;
 }
 
 void SoundController::updateScreen() {
@@ -34,25 +61,30 @@ void SoundController::updateScreen() {
       break;
   }
 
-  // Always update the volume arc animation (needed in all states)
-  volumeArc.update();
+  // Deliver touches to the buttons - the back button works in all states
+  if (touchPanel) {
+    touchTargets.update(touchPanel);
+  }
+
+  // Animate the volume arc and repaint whatever changed (needed in all states)
+  widgets.render();
 
-  // Always process touch input for back button in all states
-  if (backButton.getHasNewRelease()) {
-    resetController();
+  // Push changes to subscribed TCP clients (duplicates are ignored)
+  StateBroadcaster* broadcaster = StateBroadcaster::getInstance();
+  broadcaster->publish(STATE_SETPOINT, setpoint);
+  if (stateReceived) {
+    broadcaster->publish(STATE_PLAY, isPlaying ? "playing" : "paused");
   }
 }
 
 void SoundController::initializeController() {
-  // Clear the screen and initialize text properties
-  gfx->fillScreen(BLACK);
-  gfx->setTextColor(WHITE);
-  gfx->setTextSize(2);
+  // Clear the screen - every widget is drawn on this frame's render
+  widgets.begin();
 
   Serial.println("Drawing UI elements in INITIALIZE state");
 
   // Initialize media buttons
-  int buttonSize = 60;
+  int buttonSize = MEDIA_BUTTON_SIZE;  // The size the sprites are rendered at
   int centerY = 120;
   int spacing = 60;
 
@@ -69,23 +101,22 @@ void SoundController::initializeController() {
   volumeArc.initialize(120, 120, 110, 15, 180, 180);
   volumeArc.setColor(0x07FF);  // Set a cyan color for the arc
   
-  // Hide both buttons initially until we get status from server
-  playButton.hide();
-  pauseButton.hide();
-  
-  // Force draw all buttons (only visible ones will appear)
-  forwardButton.draw();
-  rewindButton.draw();
-  backButton.draw();
-  
-  // Explicitly draw correct play/pause button
+  // Show the play/pause button for the last known state until the server sends its own
   if (isPlaying) {
+    playButton.hide();
     pauseButton.unhide();
-    pauseButton.draw();
   } else {
+    pauseButton.hide();
     playButton.unhide();
-    playButton.draw();
   }
+
+  // Register the touch regions again - the layout is set above
+  touchTargets.clear();
+  playButton.attach(&touchTargets);
+  pauseButton.attach(&touchTargets);
+  rewindButton.attach(&touchTargets);
+  forwardButton.attach(&touchTargets);
+  backButton.attach(&touchTargets);
   
   // Start segment animation until MQTT connection is established
   volumeArc.startSegmentAnimation();
@@ -104,9 +135,6 @@ void SoundController::waitForSync() {
     Serial.println("MQTT connected, sent initial state request");
   }
   
-  // Update media buttons while waiting
-  updateMediaButtons();
-
   // Process incoming MQTT messages (which may include state responses)
   processIncomingMQTTMessages();
   
@@ -124,10 +152,6 @@ void SoundController::updateController() {
     lastSetpoint = setpoint;
   }
 
-  // Update media buttons
-  updateMediaButtons();
-  handleMediaButtonEvents();
-
   // Check for and process incoming MQTT messages
   processIncomingMQTTMessages();
 
@@ -139,6 +163,13 @@ void SoundController::updateController() {
   // 1. The setpoint has changed from the last sent value
   // 2. The change was initiated locally (not from PC)
   // 3. Enough time has passed since the last send (debounce)
+  // An active UDP peer gets every change at once, ahead of the debounced MQTT publish
+  if (udpHandler && udpHandler->isPeerActive() &&
+      (setpoint != lastStreamedSetpoint) &&
+      !externalSetpointChange) {
+    streamSetpoint();
+  }
+
   unsigned long currentMillis = millis();
   if ((setpoint != lastSentSetpoint) && 
       !externalSetpointChange && 
@@ -147,8 +178,10 @@ void SoundController::updateController() {
     lastSetpointSentTime = currentMillis;  // Record the time of the last sent setpoint
     lastSentSetpoint = setpoint;           // Update the last sent setpoint
     
-    Serial.print("Sent locally changed setpoint: ");
-    Serial.println(setpoint);
+    LOG_DEBUG(LOG_MQTT, "Sent locally changed setpoint: %d", setpoint);
+  } else if (setpoint == lastSentSetpoint) {
+    // Changes that cancelled out (or were overridden by the server) publish nothing
+    publishStamp = 0;
   }
 
   // Reset the external change flag after processing
@@ -158,146 +191,148 @@ void SoundController::updateController() {
 }
 
 void SoundController::processIncomingMQTTMessages() {
-  if (mqttHandler && mqttHandler->getHasSoundMessage()) {
-    String message = mqttHandler->getSoundMessage();
-    Serial.print("Processing sound message: ");
-    Serial.println(message);
-
-    // Note: MQTTHandler has already filtered out messages from self
-    // and extracted the actual command part from the message
-
-    // Check if the message is a setpoint command
-    if (message.startsWith("setpoint:")) {
-      String valueStr = message.substring(9);
-      int newSetpoint = valueStr.toInt();
-
-      // Validate setpoint range
-      if (newSetpoint >= 0 && newSetpoint <= 100) {
-        // Set the flag to indicate this change came from external source
-        externalSetpointChange = true;
-        
-        // Only update if the setpoint is different
-        if (newSetpoint != setpoint) {
-          setpoint = newSetpoint;
-          lastSetpointChangeTime = millis();
+  // Oldest first - a state response overrides the setpoints that arrived before it, not after
+  while (const MQTTMessageQueue::Message* queued = soundQueue.front()) {
+    processSoundMessage(queued->view());
+    soundQueue.pop();
+  }
+}
 
-          // Update the volume arc with the new setpoint
-          volumeArc.setPercentage(setpoint);
-          
-          // Also update lastSentSetpoint to avoid sending it back
-          lastSentSetpoint = setpoint;
+void SoundController::processSoundMessage(const PayloadView& message) {
+  LOG_DEBUG(LOG_MQTT, "Processing sound message: %.*s", (int)message.length(), message.begin());
 
-          Serial.print("Setpoint updated from MQTT: ");
-          Serial.println(setpoint);
-          
-          // If the arc was in animation mode, stop it since we have real data now
-          if (volumeArc.isSegmentAnimationActive()) {
-            volumeArc.stopSegmentAnimation();
-          }
-        } else {
-          Serial.println("Received same setpoint value, ignoring");
-        }
-      } else {
-        Serial.println("Invalid setpoint value received");
-      }
-    }
-    // Handle state response message
-    else if (message.startsWith("state:")) {
-      // Format should be "state:playing,volume:50" or "state:paused,volume:75"
-      String stateStr = message.substring(6); // Skip "state:"
+  // Note: MQTTHandler has already filtered out messages from self
+  // and extracted the actual command part from the message
+
+  // Check if the message is a setpoint command
+  if (message.startsWith("setpoint:")) {
+    int newSetpoint = message.substr(9).toInt();
+
+    // Validate setpoint range
+    if (newSetpoint >= 0 && newSetpoint <= 100) {
+      // Set the flag to indicate this change came from external source
+      externalSetpointChange = true;
       
-      // Extract state part (playing/paused)
-      int commaPos = stateStr.indexOf(',');
-      if (commaPos > 0) {
-        String playState = stateStr.substring(0, commaPos);
-        
-        // Update playing state
-        if (playState == "playing") {
-          isPlaying = true;
-          playButton.hide();
-          pauseButton.unhide();
-          Serial.println("Initial state: playing");
-        } else if (playState == "paused") {
-          isPlaying = false;
-          pauseButton.hide();
-          playButton.unhide();
-          Serial.println("Initial state: paused");
-        }
+      // Only update if the setpoint is different
+      if (newSetpoint != setpoint) {
+        setpoint = newSetpoint;
+        lastSetpointChangeTime = millis();
+
+        // Update the volume arc with the new setpoint
+        volumeArc.setPercentage(setpoint);
         
-        // Extract volume part if present
-        if (stateStr.indexOf("volume:") >= 0) {
-          int volPos = stateStr.indexOf("volume:") + 7; // Skip "volume:"
-          String volStr = stateStr.substring(volPos);
-          int newVol = volStr.toInt();
-          
-          if (newVol >= 0 && newVol <= 100) {
-            setpoint = newVol;
-            lastSentSetpoint = setpoint;
-            volumeArc.setPercentage(setpoint);
-            Serial.print("Initial volume set to: ");
-            Serial.println(setpoint);
-          }
-        }
+        // Also update the sent setpoints to avoid sending it back
+        lastSentSetpoint = setpoint;
+        lastStreamedSetpoint = setpoint;
+
+        LOG_DEBUG(LOG_MQTT, "Setpoint updated from MQTT: %d", setpoint);
         
-        // Stop the arc animation since we now have real data
+        // If the arc was in animation mode, stop it since we have real data now
         if (volumeArc.isSegmentAnimationActive()) {
           volumeArc.stopSegmentAnimation();
         }
-        
-        // Mark state as received
-        stateReceived = true;
-        Serial.println("State received from server");
+      } else {
+        LOG_DEBUG(LOG_MQTT, "Received same setpoint value, ignoring");
       }
+    } else {
+      LOG_WARN(LOG_MQTT, "Invalid setpoint value received");
     }
-    // Handle play/pause state commands
-    else if (message == "unpaused" || message == "playing") {
-      // Update play/pause button state for playing state
-      isPlaying = true;
-      playButton.hide();
-      pauseButton.unhide();
-      Serial.println("Media state changed to playing via MQTT");
+  }
+  // Handle state response message
+  else if (message.startsWith("state:")) {
+    // Format should be "state:playing,volume:50" or "state:paused,volume:75"
+    PayloadView stateStr = message.substr(6); // Skip "state:"
+    
+    // Extract state part (playing/paused)
+    int commaPos = stateStr.indexOf(',');
+    if (commaPos > 0) {
+      PayloadView playState = stateStr.substr(0, commaPos);
       
-      // Stop animation if it was still running
-      if (volumeArc.isSegmentAnimationActive()) {
-        volumeArc.stopSegmentAnimation();
+      // Update playing state
+      if (playState.equals("playing")) {
+        isPlaying = true;
+        playButton.hide();
+        pauseButton.unhide();
+        LOG_DEBUG(LOG_MQTT, "Initial state: playing");
+      } else if (playState.equals("paused")) {
+        isPlaying = false;
+        pauseButton.hide();
+        playButton.unhide();
+        LOG_DEBUG(LOG_MQTT, "Initial state: paused");
       }
       
-      // Mark state as received if not already
-      if (!stateReceived) {
-        stateReceived = true;
-        Serial.println("State received (playing)");
+      // Extract volume part if present
+      int volumePos = stateStr.indexOf("volume:");
+      if (volumePos >= 0) {
+        int newVol = stateStr.substr(volumePos + 7).toInt(); // Skip "volume:"
+        
+        if (newVol >= 0 && newVol <= 100) {
+          setpoint = newVol;
+          lastSentSetpoint = setpoint;
+          lastStreamedSetpoint = setpoint;
+          volumeArc.setPercentage(setpoint);
+          LOG_DEBUG(LOG_MQTT, "Initial volume set to: %d", setpoint);
+        }
       }
-    } 
-    else if (message == "paused") {
-      // Update play/pause button state for paused state
-      isPlaying = false;
-      pauseButton.hide();
-      playButton.unhide();
-      Serial.println("Media state changed to paused via MQTT");
       
-      // Stop animation if it was still running
+      // Stop the arc animation since we now have real data
       if (volumeArc.isSegmentAnimationActive()) {
         volumeArc.stopSegmentAnimation();
       }
       
-      // Mark state as received if not already
-      if (!stateReceived) {
-        stateReceived = true;
-        Serial.println("State received (paused)");
-      }
+      // Mark state as received
+      stateReceived = true;
+      LOG_DEBUG(LOG_MQTT, "State received from server");
     }
-    else if (message == "forward") {
-      // Handle forward command
-      Serial.println("Received forward command");
-      // Implement any UI/feedback for forward command here
+  }
+  // Handle play/pause state commands
+  else if (message.equals("unpaused") || message.equals("playing")) {
+    // Update play/pause button state for playing state
+    isPlaying = true;
+    playButton.hide();
+    pauseButton.unhide();
+    LOG_DEBUG(LOG_MQTT, "Media state changed to playing via MQTT");
+    
+    // Stop animation if it was still running
+    if (volumeArc.isSegmentAnimationActive()) {
+      volumeArc.stopSegmentAnimation();
+    }
+    
+    // Mark state as received if not already
+    if (!stateReceived) {
+      stateReceived = true;
+      LOG_DEBUG(LOG_MQTT, "State received (playing)");
+    }
+  } 
+  else if (message.equals("paused")) {
+    // Update play/pause button state for paused state
+    isPlaying = false;
+    pauseButton.hide();
+    playButton.unhide();
+    LOG_DEBUG(LOG_MQTT, "Media state changed to paused via MQTT");
+    
+    // Stop animation if it was still running
+    if (volumeArc.isSegmentAnimationActive()) {
+      volumeArc.stopSegmentAnimation();
     }
-    else if (message == "rewind") {
-      // Handle rewind command
-      Serial.println("Received rewind command");
-      // Implement any UI/feedback for rewind command here
+    
+    // Mark state as received if not already
+    if (!stateReceived) {
+      stateReceived = true;
+      LOG_DEBUG(LOG_MQTT, "State received (paused)");
     }
-    // Add other message types handling as needed
   }
+  else if (message.equals("forward")) {
+    // Handle forward command
+    LOG_DEBUG(LOG_MQTT, "Received forward command");
+    // Implement any UI/feedback for forward command here
+  }
+  else if (message.equals("rewind")) {
+    // Handle rewind command
+    LOG_DEBUG(LOG_MQTT, "Received rewind command");
+    // Implement any UI/feedback for rewind command here
+  }
+  // Add other message types handling as needed
 }
 
 void SoundController::resetController() {
@@ -309,6 +344,7 @@ void SoundController::resetController() {
   
   // Reset state tracking variables
   initialized = false;
+  publishStamp = 0;
   mqttInitialized = false;
   stateReceived = false;
   
@@ -318,100 +354,37 @@ void SoundController::resetController() {
   Serial.println("Controller reset, returning to INITIALIZE state");
 }
 
-void SoundController::handleMediaButtonEvents() {
-  // Check if play button was released
-  if (playButton.getIsVisible() && playButton.getHasNewRelease()) {
-    // Only send MQTT message for play if MQTT is connected
-    if (mqttHandler && mqttHandler->isMQTTConnected()) {
-      mqttHandler->sendMQTTMessage("esp32/sound/control", "play");
-      Serial.println("Sound control sent via MQTT: play");
-      // We don't set isPlaying here anymore - wait for confirmation via MQTT
-    }
-  }
-
-  // Check if pause button was released
-  if (pauseButton.getIsVisible() && pauseButton.getHasNewRelease()) {
-    // Only send MQTT message for pause if MQTT is connected
-    if (mqttHandler && mqttHandler->isMQTTConnected()) {
-      mqttHandler->sendMQTTMessage("esp32/sound/control", "pause");
-      Serial.println("Sound control sent via MQTT: pause");
-      // We don't set isPlaying here anymore - wait for confirmation via MQTT
-    }
-  }
-
-  // Check if rewind button was released
-  if (rewindButton.getHasNewRelease()) {
-    // Send MQTT message for rewind only if MQTT is connected
-    if (mqttHandler && mqttHandler->isMQTTConnected()) {
-      mqttHandler->sendMQTTMessage("esp32/sound/control", "rewind");
-      Serial.println("Sound control sent via MQTT: rewind");
-    }
-  }
-
-  // Check if forward button was released
-  if (forwardButton.getHasNewRelease()) {
-    // Send MQTT message for forward only if MQTT is connected
-    if (mqttHandler && mqttHandler->isMQTTConnected()) {
-      mqttHandler->sendMQTTMessage("esp32/sound/control", "forward");
-      Serial.println("Sound control sent via MQTT: forward");
-    }
-  }
+void SoundController::onButtonRelease(Button* button, void* context) {
+  static_cast<SoundController*>(context)->handleButtonRelease(button);
 }
 
-// Other methods remain the same as before...
-// Including: drawMediaButtons, updateMediaButtons, checkTouchInput, etc.
-
-void SoundController::drawMediaButtons() {
-  // Only draw visible buttons
-  if (playButton.getIsVisible()) {
-    playButton.draw();
-  }
-  if (pauseButton.getIsVisible()) {
-    pauseButton.draw();
-  }
-  rewindButton.draw();
-  forwardButton.draw();
-  backButton.draw();
-}
-
-void SoundController::updateMediaButtons() {
-  // Update all buttons
-  playButton.update();
-  pauseButton.update();
-  rewindButton.update();
-  forwardButton.update();
-  backButton.update();
-
-  // Draw buttons if their state has changed
-  static bool lastPlayPressed = false;
-  static bool lastPausePressed = false;
-  static bool lastRewindPressed = false;
-  static bool lastForwardPressed = false;
-  static bool lastBackPressed = false;
-
-  if (playButton.getIsVisible() && playButton.getIsPressed() != lastPlayPressed) {
-    playButton.draw();
-    lastPlayPressed = playButton.getIsPressed();
-  }
-
-  if (pauseButton.getIsVisible() && pauseButton.getIsPressed() != lastPausePressed) {
-    pauseButton.draw();
-    lastPausePressed = pauseButton.getIsPressed();
+void SoundController::handleButtonRelease(Button* button) {
+  if (button == &backButton) {
+    resetController();
+    return;
   }
 
-  if (rewindButton.getIsPressed() != lastRewindPressed) {
-    rewindButton.draw();
-    lastRewindPressed = rewindButton.getIsPressed();
+  // Media buttons only act once the server state is known
+  if (controllerState != UPDATE) {
+    return;
   }
 
-  if (forwardButton.getIsPressed() != lastForwardPressed) {
-    forwardButton.draw();
-    lastForwardPressed = forwardButton.getIsPressed();
+  const char* command;
+  if (button == &playButton) {
+    command = "play";
+  } else if (button == &pauseButton) {
+    command = "pause";
+  } else if (button == &rewindButton) {
+    command = "rewind";
+  } else {
+    command = "forward";
   }
 
-  if (backButton.getIsPressed() != lastBackPressed) {
-    backButton.draw();
-    lastBackPressed = backButton.getIsPressed();
+  // Only send the MQTT message if MQTT is connected
+  // Play/pause don't set isPlaying here - wait for confirmation via MQTT
+  if (mqttHandler && mqttHandler->isMQTTConnected()) {
+    mqttHandler->sendMQTTMessage("esp32/sound/control", command);
+    LOG_DEBUG(LOG_MQTT, "Sound control sent via MQTT: %s", command);
   }
 }
 
@@ -420,11 +393,7 @@ void SoundController::checkTouchInput() {
   if (touchPanel) {
     // Process touch input if available
     if (touchPanel->isPressed()) {
-      // Get the touch coordinates
-      int touchX = touchPanel->getTouchX();
-      int touchY = touchPanel->getTouchY();
-
-      // Process touch input based on location
+      // Process touch input based on location (getTouchX/getTouchY)
       // This could be expanded based on your UI layout
     }
   }
@@ -436,7 +405,7 @@ void SoundController::drawStaticVolumeElements() {
   gfx->setTextSize(2);
 }
 
-void SoundController::incrementSetpoint() {
+void SoundController::incrementSetpoint(LatencyStamp inputStamp) {
   if (setpoint < 100) {
     setpoint++;
     lastSetpointChangeTime = millis();  // Update the last change timestamp
@@ -445,11 +414,12 @@ void SoundController::incrementSetpoint() {
     externalSetpointChange = false;
 
     // Update the volume arc
-    volumeArc.setPercentage(setpoint);
+    traceInput(inputStamp);
+    volumeArc.setPercentage(setpoint, inputStamp);
   }
 }
 
-void SoundController::decrementSetpoint() {
+void SoundController::decrementSetpoint(LatencyStamp inputStamp) {
   if (setpoint > 0) {
     setpoint--;
     lastSetpointChangeTime = millis();  // Update the last change timestamp
@@ -458,17 +428,36 @@ void SoundController::decrementSetpoint() {
     externalSetpointChange = false;
 
     // Update the volume arc
-    volumeArc.setPercentage(setpoint);
+    traceInput(inputStamp);
+    volumeArc.setPercentage(setpoint, inputStamp);
   }
 }
 
+void SoundController::streamSetpoint() {
+  if (!udpHandler->sendSetpoint(setpoint)) {
+    return;
+  }
+  lastStreamedSetpoint = setpoint;
+
+  // The datagram is the first copy to leave - the traced input counts as published
+  LatencyTracer::getInstance()->record(LATENCY_KNOB_TO_PUBLISH, publishStamp);
+  publishStamp = 0;
+}
+
 void SoundController::sendSetpointToServer() {
+  // The traced input counts as published either way - this setpoint is not sent again
+  LatencyStamp inputStamp = publishStamp;
+  publishStamp = 0;
+
+  // MQTT stays the channel of record even while UDP streams - the PC app listens there
   // Only send setpoint via MQTT if MQTT is connected
   if (mqttHandler && mqttHandler->isMQTTConnected()) {
-    mqttHandler->sendMQTTMessage("esp32/sound/setpoint", "setpoint:" + String(setpoint));
-    Serial.println("Sound setpoint sent via MQTT: " + String(setpoint));
+    char message[16];
+    snprintf(message, sizeof(message), "setpoint:%d", setpoint);
+    mqttHandler->sendMQTTMessage("esp32/sound/setpoint", message, inputStamp);
+    LOG_DEBUG(LOG_MQTT, "Sound setpoint sent via MQTT: %d", setpoint);
   } else {
-    Serial.println("MQTT not connected, skipping setpoint send");
+    LOG_DEBUG(LOG_MQTT, "MQTT not connected, skipping setpoint send");
   }
 }
 
@@ -482,7 +471,7 @@ void SoundController::requestInitialStateFromServer() {
   }
 }
 
-void SoundController::updateSetpoint(int level) {
+void SoundController::updateSetpoint(int level, LatencyStamp inputStamp) {
   // Only update if the value has changed
   if (level != setpoint) {
     setpoint = level;
@@ -492,10 +481,28 @@ void SoundController::updateSetpoint(int level) {
     externalSetpointChange = false;
 
     // Update the volume arc
-    volumeArc.setPercentage(setpoint);
+    traceInput(inputStamp);
+    volumeArc.setPercentage(setpoint, inputStamp);
+  }
+}
+
+void SoundController::traceInput(LatencyStamp inputStamp) {
+  // Keep the oldest unsent stamp - a burst of detents is published as one setpoint
+  if (inputStamp != 0 && publishStamp == 0) {
+    publishStamp = inputStamp;
   }
 }
 
+void SoundController::restoreState(int level, bool playing) {
+  setpoint = constrain(level, 0, 100);
+  isPlaying = playing;
+
+  // Treat as already sent - the server still has this value
+  lastSentSetpoint = setpoint;
+  lastStreamedSetpoint = setpoint;
+  volumeArc.setPercentage(setpoint);
+}
+
 bool SoundController::isPageBackRequested() const {
   return pageBackRequested;
 }
@@ -514,6 +521,11 @@ void SoundController::resetPageBackRequest() {
 
 void SoundController::setMQTTHandler(MQTTHandler* handler) {
   mqttHandler = handler;
+  registerMQTTSubscriptions();
+}
+
+void SoundController::setUDPHandler(UDPHandler* handler) {
+  udpHandler = handler;
 }
 
 void SoundController::togglePlayPause() {
@@ -4,8 +4,12 @@
 #include <Arduino_GFX_Library.h>
 #include "TouchPanel.h"
 #include "MQTTHandler.h"
+#include "UDPHandler.h"
 #include "Buttons.h"
+#include "TouchGrid.h"
 #include "Arc.h"
+#include "Widget.h"
+#include "LatencyTracer.h"
 
 // State machine enum
 enum ControllerState {
@@ -19,14 +23,19 @@ private:
   Arduino_GFX* gfx;               // Graphics library instance
   TouchPanel* touchPanel;         // Touch panel handler
   MQTTHandler* mqttHandler;       // MQTT communication handler
+  MQTTHandler* subscribedHandler; // Handler our queues are registered with
+  UDPHandler* udpHandler;         // Optional LAN setpoint channel (streams ahead of MQTT when active)
+  MQTTMessageQueue soundQueue;    // Incoming esp32/sound/setpoint, control and response messages, in arrival order
   
   // Volume and state tracking
   int setpoint;                   // Current volume level (0-100)
   int lastSetpoint;               // Last displayed volume level
   int lastDrawnSetpoint;          // Last drawn volume in visualization
   int lastSentSetpoint;           // Last setpoint sent to server
+  int lastStreamedSetpoint;       // Last setpoint streamed to the UDP peer
   bool externalSetpointChange;    // Flag to track if setpoint change came from external source
   bool isPlaying;                 // Flag to track play/pause state
+  LatencyStamp publishStamp;      // Oldest knob input not yet sent to the server (0 = none)
   
   // UI state tracking
   bool colorChange;               // Indicates if the color has changed
@@ -51,6 +60,8 @@ private:
   ForwardButton forwardButton;    // Forward button UI element
   BackButton backButton;          // Back button UI element
   Arc volumeArc;                  // Volume arc UI element
+  WidgetScreen widgets;           // All of the above, repainted once per frame
+  TouchGrid touchTargets;         // The buttons' touch regions
 
   // State machine methods
   void initializeController();    // Initialize UI and elements (INITIALIZE state)
@@ -62,12 +73,15 @@ private:
   void drawSetPoint();                      // Draw the current volume level
   void checkTouchInput();                   // Check for touch input
   void sendSetpointToServer();              // Send volume setpoint to server via MQTT
+  void streamSetpoint();                    // Send volume setpoint to the active UDP peer
   void requestInitialStateFromServer();     // Request initial state from server
-  void drawMediaButtons();                  // Draw all media control buttons
-  void updateMediaButtons();                // Update media button states
-  void handleMediaButtonEvents();           // Handle media button events
-  void processIncomingMQTTMessages();       // Process incoming MQTT messages
+  void handleButtonRelease(Button* button); // Act on a tapped button
+  static void onButtonRelease(Button* button, void* context);
+  void processIncomingMQTTMessages();       // Drain the MQTT message queue
+  void processSoundMessage(const PayloadView& message); // Handle a single sound message
+  void registerMQTTSubscriptions();         // Subscribe our queues to the sound topics
   void resetController();                   // Reset controller state and UI
+  void traceInput(LatencyStamp inputStamp); // Carry a local change's stamp to the arc and the publish
 
 public:
   // Constructor and destructor
@@ -77,9 +91,12 @@ public:
   void updateScreen();
   
   // Volume control methods
-  void updateSetpoint(int setpoint);
-  void incrementSetpoint();
-  void decrementSetpoint();
+  void updateSetpoint(int setpoint, LatencyStamp inputStamp = 0);
+  void incrementSetpoint(LatencyStamp inputStamp = 0);
+  void decrementSetpoint(LatencyStamp inputStamp = 0);
+  int getSetpoint() const { return setpoint; }
+  bool getIsPlaying() const { return isPlaying; }
+  void restoreState(int setpoint, bool playing); // Set state after deep sleep without sending it
   
   // Media control methods
   void togglePlayPause();         // Toggle between play and pause states
@@ -90,6 +107,7 @@ public:
   
   // Configuration methods
   void setMQTTHandler(MQTTHandler* mqttHandler);
+  void setUDPHandler(UDPHandler* udpHandler);
 };
 
 #endif  // SOUND_CONTROLLER_H
\ No newline at end of file
@@ -0,0 +1,38 @@
+#include "Sprite.h"
+
+void Sprite::draw(Arduino_GFX* gfx, int x, int y) const {
+  draw(gfx, x, y, pgm_read_word(&palette[SPRITE_INK_INDEX]));
+}
+
+void Sprite::draw(Arduino_GFX* gfx, int x, int y, uint16_t ink) const {
+  uint16_t colors[16];
+  for (int i = 0; i < 16; i++) {
+    colors[i] = pgm_read_word(&palette[i]);
+  }
+  colors[SPRITE_INK_INDEX] = ink;
+
+  // Expand the runs one row at a time and push each row as a single window
+  uint16_t line[SPRITE_MAX_WIDTH];
+  const uint8_t* next = runs;
+  uint16_t color = 0;
+  int remaining = 0;
+  int left = x + originX;
+  int top = y + originY;
+
+  for (int row = 0; row < height; row++) {
+    int column = 0;
+    while (column < width) {
+      if (remaining == 0) {
+        uint8_t run = pgm_read_byte(next++);
+        color = colors[run >> 4];
+        remaining = (run & 0x0F) + 1;
+      }
+      int count = min(remaining, width - column);
+      for (int i = 0; i < count; i++) {
+        line[column++] = color;
+      }
+      remaining -= count;
+    }
+    gfx->draw16bitRGBBitmap(left, top + row, line, width, 1);
+  }
+}
@@ -0,0 +1,42 @@
+#ifndef SPRITE_H
+#define SPRITE_H
+
+#include <Arduino_GFX_Library.h>
+
+#define SPRITE_MAX_WIDTH 240           // One row is decoded at a time
+#define SPRITE_INK_INDEX 1             // Palette entry replaced by a tint
+
+/**
+ * Pre-rendered icon in flash: a 4-bit palettized image, run-length encoded.
+ *
+ * Each byte of runs is one run - the palette index in the high nibble and
+ * the run length minus one in the low nibble - continuing across rows.
+ * Palette entry 0 is black and entry 1 the icon's ink (white), which draw()
+ * can replace with a tint, e.g. for a pressed button.
+ *
+ * The sprites are generated by host/tools/spritegen.cpp into SpriteData.cpp;
+ * change the drawing there and regenerate rather than editing the data.
+ */
+struct Sprite {
+  int16_t width, height;
+  int16_t originX, originY;            // Top left relative to the point it is drawn at
+  const uint16_t* palette;             // 16 entries
+  const uint8_t* runs;
+
+  void draw(Arduino_GFX* gfx, int x, int y) const;
+  void draw(Arduino_GFX* gfx, int x, int y, uint16_t ink) const;
+};
+
+// Media buttons, MEDIA_BUTTON_SIZE across, drawn at the button centre
+extern const Sprite SPRITE_PLAY;
+extern const Sprite SPRITE_PAUSE;
+extern const Sprite SPRITE_REWIND;
+extern const Sprite SPRITE_FORWARD;
+
+// Home screen mode icons, drawn at the screen centre - all the same size, so
+// each one covers the previous
+extern const Sprite SPRITE_BULB;
+extern const Sprite SPRITE_THERMOMETER;
+extern const Sprite SPRITE_SPEAKER;
+
+#endif // SPRITE_H
@@ -0,0 +1,293 @@
+// Generated by host/tools/spritegen.cpp - do not edit
+
+#include "Sprite.h"
+
+// PLAY: 61x61, 272 bytes
+static const uint16_t PLAY_PALETTE[16] PROGMEM = {
+  0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+static const uint8_t PLAY_RUNS[] PROGMEM = {
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0B, 0x11, 0x0F, 0x0F,
+  0x0F, 0x0A, 0x13, 0x0F, 0x0F, 0x0F, 0x08, 0x15, 0x0F, 0x0F, 0x0F, 0x06, 0x17, 0x0F, 0x0F, 0x0F,
+  0x04, 0x18, 0x0F, 0x0F, 0x0F, 0x03, 0x1A, 0x0F, 0x0F, 0x0F, 0x01, 0x1C, 0x0F, 0x0F, 0x0F, 0x1E,
+  0x0F, 0x0F, 0x0D, 0x1F, 0x0F, 0x0F, 0x0C, 0x1F, 0x11, 0x0F, 0x0F, 0x0A, 0x1F, 0x13, 0x0F, 0x0F,
+  0x08, 0x1F, 0x15, 0x0F, 0x0F, 0x06, 0x1F, 0x16, 0x0F, 0x0F, 0x05, 0x1F, 0x18, 0x0F, 0x0F, 0x03,
+  0x1F, 0x1A, 0x0F, 0x0F, 0x01, 0x1F, 0x1C, 0x0F, 0x0F, 0x1F, 0x1D, 0x0F, 0x0E, 0x1F, 0x1F, 0x0F,
+  0x0C, 0x1F, 0x1F, 0x11, 0x0F, 0x0A, 0x1F, 0x1F, 0x13, 0x0F, 0x08, 0x1F, 0x1F, 0x12, 0x0F, 0x09,
+  0x1F, 0x1F, 0x10, 0x0F, 0x0B, 0x1F, 0x1E, 0x0F, 0x0D, 0x1F, 0x1C, 0x0F, 0x0F, 0x1F, 0x1B, 0x0F,
+  0x0F, 0x00, 0x1F, 0x19, 0x0F, 0x0F, 0x02, 0x1F, 0x17, 0x0F, 0x0F, 0x04, 0x1F, 0x15, 0x0F, 0x0F,
+  0x06, 0x1F, 0x14, 0x0F, 0x0F, 0x07, 0x1F, 0x12, 0x0F, 0x0F, 0x09, 0x1F, 0x10, 0x0F, 0x0F, 0x0B,
+  0x1E, 0x0F, 0x0F, 0x0D, 0x1D, 0x0F, 0x0F, 0x0E, 0x1B, 0x0F, 0x0F, 0x0F, 0x00, 0x19, 0x0F, 0x0F,
+  0x0F, 0x02, 0x17, 0x0F, 0x0F, 0x0F, 0x04, 0x16, 0x0F, 0x0F, 0x0F, 0x05, 0x14, 0x0F, 0x0F, 0x0F,
+  0x07, 0x12, 0x0F, 0x0F, 0x0F, 0x09, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E
+};
+const Sprite SPRITE_PLAY = { 61, 61, -30, -30, PLAY_PALETTE, PLAY_RUNS };
+
+// PAUSE: 61x61, 299 bytes
+static const uint16_t PAUSE_PALETTE[16] PROGMEM = {
+  0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+static const uint8_t PAUSE_RUNS[] PROGMEM = {
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0x1B, 0x01, 0x1B, 0x0F, 0x0F,
+  0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B,
+  0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B,
+  0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F,
+  0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B,
+  0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B,
+  0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F,
+  0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B,
+  0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B,
+  0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F,
+  0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B,
+  0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F, 0x02, 0x1B, 0x01, 0x1B, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01
+};
+const Sprite SPRITE_PAUSE = { 61, 61, -30, -30, PAUSE_PALETTE, PAUSE_RUNS };
+
+// REWIND: 61x61, 282 bytes
+static const uint16_t REWIND_PALETTE[16] PROGMEM = {
+  0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+static const uint8_t REWIND_RUNS[] PROGMEM = {
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x07, 0x10, 0x08, 0x10, 0x0F, 0x0F, 0x0F,
+  0x01, 0x11, 0x07, 0x11, 0x0F, 0x0F, 0x0F, 0x00, 0x12, 0x06, 0x12, 0x0F, 0x0F, 0x0F, 0x14, 0x04,
+  0x14, 0x0F, 0x0F, 0x0D, 0x15, 0x03, 0x15, 0x0F, 0x0F, 0x0C, 0x16, 0x02, 0x16, 0x0F, 0x0F, 0x0B,
+  0x18, 0x00, 0x18, 0x0F, 0x0F, 0x09, 0x1F, 0x13, 0x0F, 0x0F, 0x08, 0x1F, 0x14, 0x0F, 0x0F, 0x07,
+  0x1F, 0x16, 0x0F, 0x0F, 0x05, 0x1F, 0x17, 0x0F, 0x0F, 0x04, 0x1F, 0x18, 0x0F, 0x0F, 0x03, 0x1F,
+  0x1A, 0x0F, 0x0F, 0x01, 0x1F, 0x1B, 0x0F, 0x0F, 0x00, 0x1F, 0x1C, 0x0F, 0x0F, 0x1F, 0x1E, 0x0F,
+  0x0D, 0x1F, 0x1D, 0x0F, 0x0E, 0x1F, 0x1C, 0x0F, 0x0F, 0x1F, 0x1A, 0x0F, 0x0F, 0x01, 0x1F, 0x19,
+  0x0F, 0x0F, 0x02, 0x1F, 0x18, 0x0F, 0x0F, 0x03, 0x1F, 0x16, 0x0F, 0x0F, 0x05, 0x1F, 0x15, 0x0F,
+  0x0F, 0x06, 0x1F, 0x14, 0x0F, 0x0F, 0x07, 0x18, 0x00, 0x18, 0x0F, 0x0F, 0x09, 0x17, 0x01, 0x17,
+  0x0F, 0x0F, 0x0A, 0x16, 0x02, 0x16, 0x0F, 0x0F, 0x0B, 0x14, 0x04, 0x14, 0x0F, 0x0F, 0x0D, 0x13,
+  0x05, 0x13, 0x0F, 0x0F, 0x0E, 0x12, 0x06, 0x12, 0x0F, 0x0F, 0x0F, 0x10, 0x08, 0x10, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F
+};
+const Sprite SPRITE_REWIND = { 61, 61, -30, -30, REWIND_PALETTE, REWIND_RUNS };
+
+// FORWARD: 61x61, 282 bytes
+static const uint16_t FORWARD_PALETTE[16] PROGMEM = {
+  0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+static const uint8_t FORWARD_RUNS[] PROGMEM = {
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x10, 0x08, 0x10, 0x0F,
+  0x0F, 0x0F, 0x00, 0x11, 0x07, 0x11, 0x0F, 0x0F, 0x0F, 0x12, 0x06, 0x12, 0x0F, 0x0F, 0x0D, 0x14,
+  0x04, 0x14, 0x0F, 0x0F, 0x0C, 0x15, 0x03, 0x15, 0x0F, 0x0F, 0x0B, 0x16, 0x02, 0x16, 0x0F, 0x0F,
+  0x09, 0x18, 0x00, 0x18, 0x0F, 0x0F, 0x08, 0x1F, 0x13, 0x0F, 0x0F, 0x07, 0x1F, 0x14, 0x0F, 0x0F,
+  0x05, 0x1F, 0x16, 0x0F, 0x0F, 0x04, 0x1F, 0x17, 0x0F, 0x0F, 0x03, 0x1F, 0x18, 0x0F, 0x0F, 0x01,
+  0x1F, 0x1A, 0x0F, 0x0F, 0x00, 0x1F, 0x1B, 0x0F, 0x0F, 0x1F, 0x1C, 0x0F, 0x0D, 0x1F, 0x1E, 0x0F,
+  0x0E, 0x1F, 0x1D, 0x0F, 0x0F, 0x1F, 0x1C, 0x0F, 0x0F, 0x01, 0x1F, 0x1A, 0x0F, 0x0F, 0x02, 0x1F,
+  0x19, 0x0F, 0x0F, 0x03, 0x1F, 0x18, 0x0F, 0x0F, 0x05, 0x1F, 0x16, 0x0F, 0x0F, 0x06, 0x1F, 0x15,
+  0x0F, 0x0F, 0x07, 0x1F, 0x14, 0x0F, 0x0F, 0x09, 0x18, 0x00, 0x18, 0x0F, 0x0F, 0x0A, 0x17, 0x01,
+  0x17, 0x0F, 0x0F, 0x0B, 0x16, 0x02, 0x16, 0x0F, 0x0F, 0x0D, 0x14, 0x04, 0x14, 0x0F, 0x0F, 0x0E,
+  0x13, 0x05, 0x13, 0x0F, 0x0F, 0x0F, 0x12, 0x06, 0x12, 0x0F, 0x0F, 0x0F, 0x01, 0x10, 0x08, 0x10,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x07
+};
+const Sprite SPRITE_FORWARD = { 61, 61, -30, -30, FORWARD_PALETTE, FORWARD_RUNS };
+
+// BULB: 91x88, 643 bytes
+static const uint16_t BULB_PALETTE[16] PROGMEM = {
+  0x0000, 0xFFFF, 0xFFE0, 0xB5B6, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+static const uint8_t BULB_RUNS[] PROGMEM = {
+  0x0F, 0x0F, 0x07, 0x20, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x09, 0x20, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x09, 0x20, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x09, 0x20, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x09, 0x20,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x09, 0x20, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x09, 0x20, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x09, 0x20, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x09, 0x20, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x09, 0x20, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x09, 0x20, 0x0F, 0x0F, 0x0F, 0x0C, 0x20, 0x0F,
+  0x0F, 0x0F, 0x07, 0x20, 0x0F, 0x0F, 0x01, 0x20, 0x0F, 0x0F, 0x0F, 0x05, 0x20, 0x0F, 0x0F, 0x03,
+  0x20, 0x0F, 0x0F, 0x0F, 0x03, 0x20, 0x0F, 0x0F, 0x05, 0x20, 0x0F, 0x0F, 0x0F, 0x01, 0x20, 0x0F,
+  0x0F, 0x07, 0x20, 0x0F, 0x03, 0x28, 0x0F, 0x02, 0x20, 0x0F, 0x0F, 0x09, 0x20, 0x0E, 0x2F, 0x20,
+  0x0D, 0x20, 0x0F, 0x0F, 0x0B, 0x20, 0x0B, 0x2F, 0x24, 0x0A, 0x20, 0x0F, 0x0F, 0x0D, 0x20, 0x08,
+  0x2F, 0x28, 0x07, 0x20, 0x0F, 0x0F, 0x0F, 0x06, 0x2F, 0x2C, 0x0F, 0x0F, 0x0F, 0x0C, 0x2F, 0x2E,
+  0x0F, 0x0F, 0x0F, 0x0A, 0x2F, 0x2F, 0x20, 0x0F, 0x0F, 0x0F, 0x08, 0x2F, 0x2F, 0x22, 0x0F, 0x0F,
+  0x0F, 0x06, 0x2F, 0x2F, 0x24, 0x0F, 0x0F, 0x0F, 0x04, 0x2F, 0x2F, 0x26, 0x0F, 0x0F, 0x0F, 0x02,
+  0x2F, 0x2F, 0x28, 0x0F, 0x0F, 0x0F, 0x00, 0x2F, 0x2F, 0x2A, 0x0F, 0x0F, 0x0F, 0x2F, 0x2F, 0x2A,
+  0x0F, 0x0F, 0x0E, 0x2F, 0x2F, 0x2C, 0x0F, 0x0F, 0x0D, 0x2F, 0x2F, 0x2C, 0x0F, 0x0F, 0x0C, 0x2F,
+  0x2F, 0x2E, 0x0F, 0x0F, 0x0B, 0x2F, 0x2F, 0x2E, 0x0F, 0x0F, 0x0A, 0x2F, 0x2F, 0x2F, 0x20, 0x0F,
+  0x0F, 0x09, 0x2F, 0x2F, 0x2F, 0x20, 0x0F, 0x0F, 0x09, 0x2F, 0x2F, 0x2F, 0x20, 0x0F, 0x0F, 0x09,
+  0x2F, 0x2F, 0x2F, 0x20, 0x0F, 0x0F, 0x08, 0x2F, 0x2F, 0x2F, 0x22, 0x0F, 0x0F, 0x07, 0x2F, 0x2F,
+  0x2F, 0x22, 0x0F, 0x0F, 0x07, 0x2F, 0x2F, 0x2F, 0x22, 0x0F, 0x08, 0x2A, 0x03, 0x2F, 0x2F, 0x2F,
+  0x22, 0x0F, 0x0F, 0x07, 0x2F, 0x2F, 0x2F, 0x22, 0x03, 0x2A, 0x0F, 0x08, 0x2F, 0x2F, 0x2F, 0x22,
+  0x0F, 0x0F, 0x07, 0x2F, 0x2F, 0x2F, 0x22, 0x0F, 0x0F, 0x07, 0x2F, 0x2F, 0x2F, 0x22, 0x0F, 0x0F,
+  0x07, 0x2F, 0x2F, 0x2F, 0x22, 0x0F, 0x0F, 0x08, 0x2F, 0x2F, 0x2F, 0x20, 0x0F, 0x0F, 0x09, 0x2F,
+  0x2F, 0x2F, 0x20, 0x0F, 0x0F, 0x09, 0x2F, 0x2F, 0x2F, 0x20, 0x0F, 0x0F, 0x09, 0x2F, 0x2F, 0x2F,
+  0x20, 0x0F, 0x0F, 0x0A, 0x2F, 0x2F, 0x2E, 0x0F, 0x0F, 0x0B, 0x2F, 0x2F, 0x2E, 0x0F, 0x0F, 0x0C,
+  0x2F, 0x2F, 0x2C, 0x0F, 0x0F, 0x0D, 0x2F, 0x2F, 0x2C, 0x0F, 0x0F, 0x0E, 0x2F, 0x2F, 0x2A, 0x0F,
+  0x0F, 0x0F, 0x2F, 0x2F, 0x2A, 0x0F, 0x0F, 0x0F, 0x00, 0x2F, 0x2F, 0x28, 0x0F, 0x0F, 0x0F, 0x02,
+  0x2F, 0x2F, 0x26, 0x0F, 0x0F, 0x0F, 0x04, 0x2F, 0x2F, 0x24, 0x0F, 0x0F, 0x0F, 0x06, 0x2F, 0x2F,
+  0x22, 0x0F, 0x0F, 0x0F, 0x08, 0x2F, 0x2F, 0x20, 0x0F, 0x0F, 0x0F, 0x0A, 0x2F, 0x2E, 0x0F, 0x0F,
+  0x0F, 0x04, 0x20, 0x06, 0x2F, 0x2C, 0x05, 0x20, 0x0F, 0x0F, 0x0D, 0x20, 0x09, 0x2F, 0x28, 0x08,
+  0x20, 0x0F, 0x0F, 0x0B, 0x20, 0x0C, 0x2F, 0x24, 0x0B, 0x20, 0x0F, 0x0F, 0x09, 0x20, 0x0F, 0x2F,
+  0x20, 0x0E, 0x20, 0x0F, 0x0F, 0x07, 0x20, 0x0F, 0x01, 0x3D, 0x0F, 0x01, 0x20, 0x0F, 0x0F, 0x05,
+  0x20, 0x0F, 0x02, 0x3D, 0x0F, 0x02, 0x20, 0x0F, 0x0F, 0x03, 0x20, 0x0F, 0x03, 0x3D, 0x0F, 0x03,
+  0x20, 0x0F, 0x0F, 0x01, 0x20, 0x0F, 0x04, 0x3D, 0x0F, 0x04, 0x20, 0x0F, 0x0F, 0x0F, 0x06, 0x35,
+  0x20, 0x36, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x35, 0x20, 0x36, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x35,
+  0x20, 0x36, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x35, 0x20, 0x36, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x35,
+  0x20, 0x36, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x35, 0x20, 0x36, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x35,
+  0x20, 0x36, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x35, 0x20, 0x36, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x35,
+  0x20, 0x36, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x35, 0x20, 0x36, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x35,
+  0x20, 0x36, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x03
+};
+const Sprite SPRITE_BULB = { 91, 88, -40, -40, BULB_PALETTE, BULB_RUNS };
+
+// THERMOMETER: 91x88, 914 bytes
+static const uint16_t THERMOMETER_PALETTE[16] PROGMEM = {
+  0x0000, 0xFFFF, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+static const uint8_t THERMOMETER_RUNS[] PROGMEM = {
+  0x0F, 0x0F, 0x00, 0x1D, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29,
+  0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10,
+  0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x07, 0x15, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29,
+  0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10,
+  0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29,
+  0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x07, 0x15, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10,
+  0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29,
+  0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x07, 0x15, 0x00, 0x29, 0x00, 0x10,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10,
+  0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29,
+  0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x07, 0x15,
+  0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29,
+  0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10,
+  0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x07, 0x15, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29,
+  0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x29, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0C, 0x10, 0x00, 0x20, 0x18, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x12, 0x28, 0x11, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0B, 0x11, 0x00, 0x29, 0x00, 0x12, 0x0F, 0x0F, 0x0F, 0x0F, 0x07, 0x11, 0x00,
+  0x10, 0x2B, 0x10, 0x01, 0x11, 0x0F, 0x0F, 0x0F, 0x0F, 0x04, 0x10, 0x01, 0x20, 0x10, 0x2B, 0x10,
+  0x21, 0x01, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x10, 0x01, 0x21, 0x10, 0x2B, 0x10, 0x22, 0x01,
+  0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x10, 0x01, 0x22, 0x10, 0x2B, 0x10, 0x23, 0x01, 0x10, 0x0F,
+  0x0F, 0x0F, 0x0E, 0x10, 0x01, 0x23, 0x10, 0x2B, 0x10, 0x24, 0x01, 0x10, 0x0F, 0x0F, 0x0F, 0x0D,
+  0x10, 0x00, 0x24, 0x10, 0x2B, 0x10, 0x25, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x25,
+  0x10, 0x2B, 0x10, 0x26, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0B, 0x10, 0x00, 0x25, 0x10, 0x2B, 0x10,
+  0x26, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0A, 0x10, 0x00, 0x26, 0x10, 0x2B, 0x10, 0x27, 0x00, 0x10,
+  0x0F, 0x0F, 0x0F, 0x09, 0x10, 0x00, 0x26, 0x10, 0x2B, 0x10, 0x27, 0x00, 0x10, 0x0F, 0x0F, 0x0F,
+  0x08, 0x10, 0x01, 0x26, 0x10, 0x2B, 0x10, 0x27, 0x01, 0x10, 0x0F, 0x0F, 0x0F, 0x07, 0x10, 0x00,
+  0x27, 0x10, 0x2B, 0x10, 0x28, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x07, 0x10, 0x00, 0x27, 0x10, 0x2B,
+  0x10, 0x28, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x07, 0x10, 0x00, 0x27, 0x1D, 0x28, 0x00, 0x10, 0x0F,
+  0x0F, 0x0F, 0x07, 0x10, 0x00, 0x2F, 0x2E, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x07, 0x10, 0x00, 0x2F,
+  0x2E, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x07, 0x10, 0x00, 0x2F, 0x2E, 0x00, 0x10, 0x0F, 0x0F, 0x0F,
+  0x07, 0x10, 0x00, 0x2F, 0x2E, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x07, 0x10, 0x01, 0x2F, 0x2C, 0x01,
+  0x10, 0x0F, 0x0F, 0x0F, 0x08, 0x10, 0x00, 0x2F, 0x2C, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x09, 0x10,
+  0x00, 0x2F, 0x2C, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0A, 0x10, 0x00, 0x2F, 0x2A, 0x00, 0x10, 0x0F,
+  0x0F, 0x0F, 0x0B, 0x10, 0x00, 0x2F, 0x2A, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x00, 0x2F,
+  0x28, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0D, 0x10, 0x01, 0x2F, 0x26, 0x01, 0x10, 0x0F, 0x0F, 0x0F,
+  0x0E, 0x10, 0x01, 0x2F, 0x24, 0x01, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x10, 0x01, 0x2F, 0x22,
+  0x01, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x10, 0x01, 0x2F, 0x20, 0x01, 0x10, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x04, 0x11, 0x01, 0x2C, 0x01, 0x11, 0x0F, 0x0F, 0x0F, 0x0F, 0x07, 0x11, 0x02, 0x26, 0x02,
+  0x11, 0x0F, 0x0F, 0x0F, 0x0F, 0x0B, 0x11, 0x08, 0x11, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x18, 0x0F,
+  0x0F, 0x0D
+};
+const Sprite SPRITE_THERMOMETER = { 91, 88, -40, -40, THERMOMETER_PALETTE, THERMOMETER_RUNS };
+
+// SPEAKER: 91x88, 890 bytes
+static const uint16_t SPEAKER_PALETTE[16] PROGMEM = {
+  0x0000, 0xFFFF, 0xA514, 0xC618, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+static const uint8_t SPEAKER_RUNS[] PROGMEM = {
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x10, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x09, 0x11, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x08, 0x10, 0x20, 0x10, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x07, 0x10, 0x20, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x07, 0x10, 0x21, 0x10, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x06, 0x10, 0x22, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x05, 0x10, 0x23,
+  0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x04, 0x10, 0x24, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03,
+  0x10, 0x25, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x10, 0x25, 0x10, 0x0F, 0x0F, 0x0F, 0x0E,
+  0x1F, 0x14, 0x26, 0x10, 0x0F, 0x0F, 0x0F, 0x0D, 0x10, 0x3F, 0x31, 0x11, 0x27, 0x10, 0x0F, 0x0F,
+  0x0F, 0x0C, 0x10, 0x3F, 0x31, 0x11, 0x28, 0x10, 0x0F, 0x0F, 0x0F, 0x0B, 0x10, 0x3F, 0x31, 0x11,
+  0x29, 0x10, 0x0F, 0x0F, 0x0F, 0x0A, 0x10, 0x3F, 0x31, 0x11, 0x2A, 0x10, 0x0F, 0x0F, 0x0F, 0x09,
+  0x10, 0x3F, 0x31, 0x11, 0x2A, 0x10, 0x0F, 0x0A, 0x13, 0x0F, 0x0A, 0x10, 0x3F, 0x31, 0x11, 0x2B,
+  0x10, 0x0F, 0x09, 0x10, 0x02, 0x12, 0x0F, 0x07, 0x10, 0x3F, 0x31, 0x11, 0x2C, 0x10, 0x0F, 0x08,
+  0x10, 0x05, 0x11, 0x0F, 0x05, 0x10, 0x3F, 0x31, 0x11, 0x2D, 0x10, 0x0F, 0x07, 0x10, 0x06, 0x11,
+  0x0F, 0x04, 0x10, 0x3F, 0x31, 0x11, 0x2E, 0x10, 0x0F, 0x06, 0x10, 0x08, 0x10, 0x0F, 0x03, 0x10,
+  0x3F, 0x31, 0x11, 0x2F, 0x10, 0x0B, 0x13, 0x05, 0x10, 0x09, 0x10, 0x0F, 0x02, 0x10, 0x3F, 0x31,
+  0x11, 0x2F, 0x10, 0x0B, 0x10, 0x02, 0x11, 0x03, 0x10, 0x0A, 0x10, 0x0F, 0x01, 0x10, 0x3F, 0x31,
+  0x11, 0x2F, 0x20, 0x10, 0x0A, 0x10, 0x04, 0x10, 0x02, 0x10, 0x0B, 0x10, 0x0F, 0x00, 0x10, 0x3F,
+  0x31, 0x11, 0x2F, 0x21, 0x10, 0x09, 0x10, 0x05, 0x10, 0x01, 0x10, 0x0B, 0x10, 0x0F, 0x00, 0x10,
+  0x3F, 0x31, 0x11, 0x2F, 0x22, 0x10, 0x08, 0x10, 0x06, 0x10, 0x00, 0x10, 0x0C, 0x10, 0x0F, 0x10,
+  0x3F, 0x31, 0x11, 0x2F, 0x23, 0x10, 0x07, 0x12, 0x04, 0x14, 0x0A, 0x10, 0x0F, 0x10, 0x3F, 0x31,
+  0x11, 0x2F, 0x24, 0x10, 0x09, 0x10, 0x04, 0x10, 0x02, 0x10, 0x09, 0x11, 0x0E, 0x10, 0x3F, 0x31,
+  0x11, 0x2F, 0x24, 0x10, 0x0A, 0x10, 0x04, 0x10, 0x02, 0x10, 0x09, 0x10, 0x0E, 0x10, 0x3F, 0x31,
+  0x11, 0x2F, 0x25, 0x10, 0x0A, 0x10, 0x03, 0x10, 0x03, 0x10, 0x08, 0x10, 0x0E, 0x10, 0x3F, 0x31,
+  0x11, 0x2F, 0x26, 0x10, 0x09, 0x10, 0x03, 0x10, 0x03, 0x10, 0x08, 0x10, 0x0E, 0x10, 0x3F, 0x31,
+  0x11, 0x2F, 0x27, 0x10, 0x08, 0x10, 0x03, 0x10, 0x03, 0x10, 0x08, 0x10, 0x0E, 0x10, 0x3F, 0x31,
+  0x11, 0x2F, 0x26, 0x10, 0x20, 0x08, 0x10, 0x03, 0x10, 0x03, 0x10, 0x08, 0x10, 0x0E, 0x10, 0x3F,
+  0x31, 0x11, 0x2F, 0x25, 0x10, 0x20, 0x09, 0x10, 0x03, 0x10, 0x03, 0x10, 0x08, 0x10, 0x0E, 0x10,
+  0x3F, 0x31, 0x11, 0x2F, 0x25, 0x10, 0x09, 0x10, 0x03, 0x10, 0x03, 0x10, 0x09, 0x10, 0x0E, 0x10,
+  0x3F, 0x31, 0x11, 0x2F, 0x24, 0x10, 0x09, 0x10, 0x04, 0x10, 0x02, 0x10, 0x09, 0x10, 0x0F, 0x10,
+  0x3F, 0x31, 0x11, 0x2F, 0x23, 0x10, 0x07, 0x12, 0x05, 0x13, 0x0A, 0x10, 0x0F, 0x10, 0x3F, 0x31,
+  0x11, 0x2F, 0x22, 0x10, 0x08, 0x10, 0x06, 0x10, 0x00, 0x10, 0x0C, 0x10, 0x0F, 0x10, 0x3F, 0x31,
+  0x11, 0x2F, 0x21, 0x10, 0x20, 0x08, 0x10, 0x05, 0x10, 0x01, 0x10, 0x0B, 0x10, 0x0F, 0x00, 0x10,
+  0x3F, 0x31, 0x11, 0x2F, 0x20, 0x10, 0x20, 0x09, 0x10, 0x04, 0x10, 0x02, 0x10, 0x0B, 0x10, 0x0F,
+  0x00, 0x10, 0x3F, 0x31, 0x11, 0x2F, 0x20, 0x10, 0x0A, 0x10, 0x01, 0x12, 0x03, 0x10, 0x0A, 0x10,
+  0x0F, 0x01, 0x10, 0x3F, 0x31, 0x11, 0x2F, 0x10, 0x0B, 0x12, 0x06, 0x10, 0x09, 0x11, 0x0F, 0x01,
+  0x10, 0x3F, 0x31, 0x11, 0x2E, 0x10, 0x0F, 0x06, 0x10, 0x08, 0x10, 0x0F, 0x03, 0x10, 0x3F, 0x31,
+  0x11, 0x2D, 0x10, 0x0F, 0x07, 0x10, 0x07, 0x10, 0x0F, 0x04, 0x10, 0x3F, 0x31, 0x11, 0x2C, 0x10,
+  0x20, 0x0F, 0x07, 0x10, 0x05, 0x11, 0x0F, 0x05, 0x10, 0x3F, 0x31, 0x11, 0x2B, 0x10, 0x20, 0x0F,
+  0x08, 0x10, 0x02, 0x12, 0x0F, 0x07, 0x10, 0x3F, 0x31, 0x11, 0x2B, 0x10, 0x0F, 0x09, 0x13, 0x0F,
+  0x0A, 0x10, 0x3F, 0x31, 0x11, 0x2A, 0x10, 0x0F, 0x0F, 0x0F, 0x09, 0x10, 0x3F, 0x31, 0x11, 0x29,
+  0x10, 0x0F, 0x0F, 0x0F, 0x0A, 0x10, 0x3F, 0x31, 0x11, 0x28, 0x10, 0x0F, 0x0F, 0x0F, 0x0B, 0x1F,
+  0x14, 0x27, 0x10, 0x20, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x10, 0x26, 0x10, 0x20, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x00, 0x10, 0x26, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x10, 0x25, 0x10, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x10, 0x24, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0x10, 0x23,
+  0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x04, 0x10, 0x22, 0x10, 0x20, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x04, 0x10, 0x21, 0x10, 0x20, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x05, 0x10, 0x21, 0x10, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x06, 0x10, 0x20, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x07, 0x11, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x08, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01
+};
+const Sprite SPRITE_SPEAKER = { 91, 88, -40, -40, SPEAKER_PALETTE, SPEAKER_RUNS };
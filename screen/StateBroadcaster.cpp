@@ -0,0 +1,229 @@
+#include "StateBroadcaster.h"
+#include "WiFiTCPClient.h"
+
+static const char* fieldNames[STATE_FIELD_COUNT] = {
+  "setpoint", "light", "mode", "play", "wifi", "mqtt", "indoor", "outdoor"
+};
+
+StateBroadcaster* StateBroadcaster::getInstance() {
+  // First reached from both cores - a function-local static is created exactly once
+  static StateBroadcaster* instance = new StateBroadcaster();
+  return instance;
+}
+
+StateBroadcaster::StateBroadcaster()
+  : tcpClient(nullptr), dirtyMask(0), lastFlushTime(0) {
+  stateMutex = xSemaphoreCreateMutex();
+
+  for (int i = 0; i < STATE_FIELD_COUNT; i++) {
+    values[i][0] = '\0';
+  }
+  for (int i = 0; i < STATE_MAX_SUBSCRIBERS; i++) {
+    subscribers[i].clientId = -1;
+    subscribers[i].fieldMask = 0;
+    subscribers[i].pendingMask = 0;
+    subscribers[i].sequence = 0;
+  }
+}
+
+void StateBroadcaster::setTCPClient(WiFiTCPClient* client) {
+  tcpClient = client;
+}
+
+const char* StateBroadcaster::getFieldName(StateField field) {
+  return (field >= 0 && field < STATE_FIELD_COUNT) ? fieldNames[field] : "";
+}
+
+void StateBroadcaster::publish(StateField field, const char* value) {
+  if (field < 0 || field >= STATE_FIELD_COUNT) return;
+
+  xSemaphoreTake(stateMutex, portMAX_DELAY);
+  if (strncmp(values[field], value, STATE_VALUE_LENGTH - 1) != 0) {
+    strncpy(values[field], value, STATE_VALUE_LENGTH - 1);
+    values[field][STATE_VALUE_LENGTH - 1] = '\0';
+    dirtyMask |= (1UL << field);
+  }
+  xSemaphoreGive(stateMutex);
+}
+
+void StateBroadcaster::publish(StateField field, int value) {
+  char buffer[12];
+  snprintf(buffer, sizeof(buffer), "%d", value);
+  publish(field, buffer);
+}
+
+void StateBroadcaster::publishTemperature(StateField field, float value) {
+  char buffer[12];
+  snprintf(buffer, sizeof(buffer), "%.1f", value);
+  publish(field, buffer);
+}
+
+uint32_t StateBroadcaster::parseTopics(const String& topics) {
+  if (topics.length() == 0 || topics == "all") {
+    return STATE_ALL_FIELDS;
+  }
+
+  uint32_t mask = 0;
+  int start = 0;
+  while (start <= (int)topics.length()) {
+    int comma = topics.indexOf(',', start);
+    if (comma < 0) comma = topics.length();
+
+    String topic = topics.substring(start, comma);
+    topic.trim();
+    if (topic == "all") {
+      mask |= STATE_ALL_FIELDS;
+    } else if (topic.length() > 0) {
+      bool known = false;
+      for (int i = 0; i < STATE_FIELD_COUNT; i++) {
+        if (topic == fieldNames[i]) {
+          mask |= (1UL << i);
+          known = true;
+          break;
+        }
+      }
+      if (!known) return 0;
+    }
+    start = comma + 1;
+  }
+  return mask;
+}
+
+StateBroadcaster::Subscriber* StateBroadcaster::findSubscriber(int clientId) {
+  for (int i = 0; i < STATE_MAX_SUBSCRIBERS; i++) {
+    if (subscribers[i].clientId == clientId) {
+      return &subscribers[i];
+    }
+  }
+  return nullptr;
+}
+
+bool StateBroadcaster::subscribe(int clientId, const String& topics) {
+  uint32_t mask = parseTopics(topics);
+  if (mask == 0 || clientId < 0) return false;
+
+  xSemaphoreTake(stateMutex, portMAX_DELAY);
+  Subscriber* subscriber = findSubscriber(clientId);
+  if (!subscriber) {
+    subscriber = findSubscriber(-1);
+    if (subscriber) {
+      subscriber->clientId = clientId;
+      subscriber->fieldMask = 0;
+      subscriber->sequence = 0;
+    }
+  }
+
+  if (subscriber) {
+    // Newly added fields get a snapshot of their current value
+    subscriber->pendingMask |= mask & ~subscriber->fieldMask;
+    subscriber->fieldMask |= mask;
+  }
+  xSemaphoreGive(stateMutex);
+
+  return subscriber != nullptr;
+}
+
+void StateBroadcaster::unsubscribe(int clientId, const String& topics) {
+  uint32_t mask = parseTopics(topics);
+
+  xSemaphoreTake(stateMutex, portMAX_DELAY);
+  Subscriber* subscriber = findSubscriber(clientId);
+  if (subscriber && clientId >= 0) {
+    subscriber->fieldMask &= ~mask;
+    subscriber->pendingMask &= subscriber->fieldMask;
+    if (subscriber->fieldMask == 0) {
+      subscriber->clientId = -1;
+    }
+  }
+  xSemaphoreGive(stateMutex);
+}
+
+String StateBroadcaster::describeSubscription(int clientId) {
+  String description;
+
+  xSemaphoreTake(stateMutex, portMAX_DELAY);
+  Subscriber* subscriber = findSubscriber(clientId);
+  uint32_t mask = (subscriber && clientId >= 0) ? subscriber->fieldMask : 0;
+  xSemaphoreGive(stateMutex);
+
+  for (int i = 0; i < STATE_FIELD_COUNT; i++) {
+    if (mask & (1UL << i)) {
+      if (description.length() > 0) description += ",";
+      description += fieldNames[i];
+    }
+  }
+  return description;
+}
+
+void StateBroadcaster::sampleConnectionState() {
+  publish(STATE_WIFI, tcpClient->isWiFiConnected() ? 1 : 0);
+  publish(STATE_MQTT, tcpClient->isMQTTConnected() ? 1 : 0);
+}
+
+void StateBroadcaster::update() {
+  if (!tcpClient) return;
+
+  unsigned long currentMillis = millis();
+  if (currentMillis - lastFlushTime < STATE_FLUSH_INTERVAL) return;
+  lastFlushTime = currentMillis;
+
+  sampleConnectionState();
+
+  // Snapshot what needs sending while holding the lock, send after releasing it
+  char snapshot[STATE_FIELD_COUNT][STATE_VALUE_LENGTH];
+  uint32_t sendMask[STATE_MAX_SUBSCRIBERS];
+  int clientIds[STATE_MAX_SUBSCRIBERS];
+  uint32_t sequences[STATE_MAX_SUBSCRIBERS];
+  bool anyPending = false;
+
+  xSemaphoreTake(stateMutex, portMAX_DELAY);
+  for (int i = 0; i < STATE_MAX_SUBSCRIBERS; i++) {
+    Subscriber& subscriber = subscribers[i];
+    clientIds[i] = subscriber.clientId;
+    sendMask[i] = 0;
+    if (subscriber.clientId < 0) continue;
+
+    // Forget clients that have disconnected
+    if (!tcpClient->isTCPClientConnected(subscriber.clientId)) {
+      subscriber.clientId = -1;
+      clientIds[i] = -1;
+      continue;
+    }
+
+    subscriber.pendingMask |= dirtyMask & subscriber.fieldMask;
+    sendMask[i] = subscriber.pendingMask;
+    sequences[i] = subscriber.sequence;
+    subscriber.pendingMask = 0;
+    anyPending |= sendMask[i] != 0;
+  }
+  dirtyMask = 0;
+  if (anyPending) {
+    memcpy(snapshot, values, sizeof(snapshot));
+  }
+  xSemaphoreGive(stateMutex);
+
+  if (!anyPending) return;
+
+  char event[16 + STATE_VALUE_LENGTH + 16];
+  for (int i = 0; i < STATE_MAX_SUBSCRIBERS; i++) {
+    if (clientIds[i] < 0 || sendMask[i] == 0) continue;
+
+    for (int field = 0; field < STATE_FIELD_COUNT; field++) {
+      if (!(sendMask[i] & (1UL << field)) || snapshot[field][0] == '\0') continue;
+
+      // Sequence advances even if the client's queue drops the event, so gaps are visible
+      sequences[i]++;
+      int length = snprintf(event, sizeof(event), "evt:%lu:%s=%s",
+                            (unsigned long)sequences[i], fieldNames[field], snapshot[field]);
+      tcpClient->sendTCPResponse(clientIds[i], event, min(length, (int)sizeof(event) - 1), false);
+    }
+  }
+
+  xSemaphoreTake(stateMutex, portMAX_DELAY);
+  for (int i = 0; i < STATE_MAX_SUBSCRIBERS; i++) {
+    if (clientIds[i] >= 0 && subscribers[i].clientId == clientIds[i]) {
+      subscribers[i].sequence = sequences[i];
+    }
+  }
+  xSemaphoreGive(stateMutex);
+}
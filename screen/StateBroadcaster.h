@@ -0,0 +1,86 @@
+#ifndef STATE_BROADCASTER_H
+#define STATE_BROADCASTER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Forward declaration
+class WiFiTCPClient;
+
+// Fields that can be subscribed to with subscribe:<topics>
+enum StateField {
+  STATE_SETPOINT,       // Sound volume setpoint (0-100)
+  STATE_LIGHT,          // Light level (0-100)
+  STATE_MODE,           // Current screen mode
+  STATE_PLAY,           // playing / paused
+  STATE_WIFI,           // Wi-Fi connected (0/1)
+  STATE_MQTT,           // MQTT connected (0/1)
+  STATE_INDOOR_TEMP,    // Indoor temperature (°C)
+  STATE_OUTDOOR_TEMP,   // Outdoor temperature (°C)
+  STATE_FIELD_COUNT
+};
+
+#define STATE_ALL_FIELDS ((1UL << STATE_FIELD_COUNT) - 1)
+#define STATE_VALUE_LENGTH 24         // Longest formatted field value
+#define STATE_MAX_SUBSCRIBERS 4       // Matches TCP_MAX_CLIENTS
+#define STATE_FLUSH_INTERVAL 20       // Minimum time between event flushes (ms)
+
+/**
+ * Pushes state changes to subscribed TCP clients.
+ *
+ * Producers publish the latest value of a field from any task; identical
+ * values are ignored and repeated changes between flushes collapse into one
+ * event. The network task flushes pending fields to each subscriber as
+ * "evt:<seq>:<field>=<value>" lines, with a per-client sequence number so a
+ * client can detect events it missed.
+ */
+class StateBroadcaster {
+private:
+  struct Subscriber {
+    int clientId;                     // TCP client id, -1 if the slot is free
+    uint32_t fieldMask;               // Fields the client subscribed to
+    uint32_t pendingMask;             // Fields waiting to be sent to this client
+    uint32_t sequence;                // Last sequence number sent
+  };
+
+  WiFiTCPClient* tcpClient;
+  SemaphoreHandle_t stateMutex;       // Guards values and dirty mask
+
+  char values[STATE_FIELD_COUNT][STATE_VALUE_LENGTH]; // Latest value per field ("" = unknown)
+  uint32_t dirtyMask;                 // Fields changed since the last flush
+  Subscriber subscribers[STATE_MAX_SUBSCRIBERS];
+  unsigned long lastFlushTime;
+
+  // Private constructor - enforces singleton pattern
+  StateBroadcaster();
+
+  Subscriber* findSubscriber(int clientId);
+  void sampleConnectionState();       // Poll Wi-Fi/MQTT status from the TCP client
+
+public:
+  // Creates the singleton instance of StateBroadcaster
+  static StateBroadcaster* getInstance();
+
+  // Sets the TCP client used to deliver events
+  void setTCPClient(WiFiTCPClient* client);
+
+  // Publish the latest value of a field (safe from any task)
+  void publish(StateField field, const char* value);
+  void publish(StateField field, int value);
+  void publishTemperature(StateField field, float value);
+
+  // Subscription management - returns false if the topic list is invalid or no slot is free
+  bool subscribe(int clientId, const String& topics);
+  void unsubscribe(int clientId, const String& topics);
+  String describeSubscription(int clientId);  // Comma separated list of subscribed fields
+
+  // Parse a comma separated topic list ("all" or empty = every field) into a field mask
+  static uint32_t parseTopics(const String& topics);
+  static const char* getFieldName(StateField field);
+
+  // Flush pending events to subscribers - call from the network task
+  void update();
+};
+
+#endif // STATE_BROADCASTER_H
@@ -0,0 +1,276 @@
+#include "SystemMonitor.h"
+#include <esp_timer.h>
+
+SystemMonitor* SystemMonitor::instance = nullptr;
+std::atomic<uint32_t> SystemMonitor::allocationCount(0);
+std::atomic<uint32_t> SystemMonitor::freeCount(0);
+
+#ifdef CONFIG_HEAP_USE_HOOKS
+// Called by the ESP-IDF heap for every successful allocation and every free,
+// from any task or ISR - keep them to a single atomic increment
+extern "C" void IRAM_ATTR esp_heap_trace_alloc_hook(void* ptr, size_t size, uint32_t caps) {
+  SystemMonitor::countAllocation();
+}
+
+extern "C" void IRAM_ATTR esp_heap_trace_free_hook(void* ptr) {
+  SystemMonitor::freeCount.fetch_add(1, std::memory_order_relaxed);
+}
+#endif
+
+SystemMonitor* SystemMonitor::getInstance() {
+  if (instance == nullptr) {
+    instance = new SystemMonitor();
+  }
+  return instance;
+}
+
+SystemMonitor::SystemMonitor()
+  : trackedCount(0), lastSampleCount(0), lastTotalRunTime(0),
+    frameCount(0), allocatingFrames(0), maxFrameAllocations(0) {
+  trackedMux = portMUX_INITIALIZER_UNLOCKED;
+}
+
+bool SystemMonitor::allocationCountingAvailable() {
+#ifdef CONFIG_HEAP_USE_HOOKS
+  return true;
+#else
+  return false;
+#endif
+}
+
+void SystemMonitor::trackTask(TaskHandle_t handle, uint32_t stackSize) {
+  if (handle == nullptr) return;
+  const char* name = pcTaskGetName(handle);
+
+  portENTER_CRITICAL(&trackedMux);
+  // A task that runs again (e.g. a reconnect) reuses its entry
+  TrackedTask* task = findTracked(name);
+  if (task == nullptr && trackedCount < SYS_MAX_TRACKED_TASKS) {
+    // Fill the entry before counting it - the heap hook scans without the lock
+    task = &trackedTasks[trackedCount];
+    strncpy(task->name, name, sizeof(task->name) - 1);
+    task->name[sizeof(task->name) - 1] = 0;
+    task->handle = nullptr;
+    task->allocations = 0;
+    trackedCount++;
+  }
+  if (task != nullptr) {
+    task->stackSize = stackSize;
+    task->exitHighWaterMark = 0;
+    task->handle = handle;
+  }
+  portEXIT_CRITICAL(&trackedMux);
+}
+
+void SystemMonitor::taskExiting() {
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  UBaseType_t highWaterMark = uxTaskGetStackHighWaterMark(nullptr);
+
+  portENTER_CRITICAL(&trackedMux);
+  for (int i = 0; i < trackedCount; i++) {
+    if (trackedTasks[i].handle == self) {
+      trackedTasks[i].handle = nullptr;
+      trackedTasks[i].exitHighWaterMark = highWaterMark;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&trackedMux);
+}
+
+#ifdef CONFIG_HEAP_USE_HOOKS
+void IRAM_ATTR SystemMonitor::countAllocation() {
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+  if (instance) {
+    instance->attributeAllocation();
+  }
+}
+
+void IRAM_ATTR SystemMonitor::attributeAllocation() {
+  // Runs inside malloc - no locking, no allocation
+  if (xPortInIsrContext()) return;
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  int count = trackedCount;
+  for (int i = 0; i < count; i++) {
+    if (trackedTasks[i].handle == self) {
+      trackedTasks[i].allocations = trackedTasks[i].allocations + 1;
+      return;
+    }
+  }
+}
+
+uint32_t SystemMonitor::getCurrentTaskAllocations() {
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  for (int i = 0; i < trackedCount; i++) {
+    if (trackedTasks[i].handle == self) {
+      return trackedTasks[i].allocations;
+    }
+  }
+  return 0;
+}
+
+void SystemMonitor::recordFrame(uint32_t allocations) {
+  frameCount++;
+  if (allocations > 0) {
+    allocatingFrames++;
+    if (allocations > maxFrameAllocations) {
+      maxFrameAllocations = allocations;
+    }
+  }
+}
+#endif
+
+SystemMonitor::TrackedTask* SystemMonitor::findTracked(const char* name) {
+  for (int i = 0; i < trackedCount; i++) {
+    if (strcmp(trackedTasks[i].name, name) == 0) {
+      return &trackedTasks[i];
+    }
+  }
+  return nullptr;
+}
+
+uint32_t SystemMonitor::previousRunTime(UBaseType_t taskNumber) {
+  for (int i = 0; i < lastSampleCount; i++) {
+    if (lastSamples[i].taskNumber == taskNumber) {
+      return lastSamples[i].runTime;
+    }
+  }
+  return 0;
+}
+
+String SystemMonitor::getReport() {
+  // Only the network task runs commands, so the snapshot can live in static storage
+  static TaskStatus_t tasks[SYS_MAX_TASKS];
+  uint32_t totalRunTime = 0;
+  UBaseType_t taskCount = uxTaskGetSystemState(tasks, SYS_MAX_TASKS, &totalRunTime);
+  UBaseType_t liveTasks = uxTaskGetNumberOfTasks();
+
+  TrackedTask tracked[SYS_MAX_TRACKED_TASKS];
+  portENTER_CRITICAL(&trackedMux);
+  int trackedSnapshot = trackedCount;
+  memcpy(tracked, trackedTasks, sizeof(TrackedTask) * trackedCount);
+  portEXIT_CRITICAL(&trackedMux);
+
+  uint32_t heapFree = ESP.getFreeHeap();
+  uint32_t heapLargest = ESP.getMaxAllocHeap();
+  uint32_t heapMin = ESP.getMinFreeHeap();
+  float fragmentation = heapFree > 0 ? 100.0f * (1.0f - (float)heapLargest / heapFree) : 0.0f;
+  unsigned long uptime = (unsigned long)(esp_timer_get_time() / 1000000);
+
+  // CPU share since the previous report, summed over both cores
+  uint32_t elapsedRunTime = (totalRunTime - lastTotalRunTime) * portNUM_PROCESSORS;
+  bool haveRunTime = configGENERATE_RUN_TIME_STATS && totalRunTime > 0 && elapsedRunTime > 0;
+
+  char line[96];
+  String report;
+  String structured = "sys:uptime=" + String(uptime);
+
+  snprintf(line, sizeof(line), "[Sys] uptime %lu s, %u tasks\n", uptime, (unsigned)liveTasks);
+  report += line;
+  if (taskCount == 0 && liveTasks > SYS_MAX_TASKS) {
+    report += "[Sys] too many tasks to list, raise SYS_MAX_TASKS\n";
+  }
+
+  snprintf(line, sizeof(line), "[Sys] heap free %lu, min free %lu, largest block %lu, fragmentation %.1f%%\n",
+           (unsigned long)heapFree, (unsigned long)heapMin, (unsigned long)heapLargest, fragmentation);
+  report += line;
+  snprintf(line, sizeof(line), ",heap_free=%lu,heap_min=%lu,heap_largest=%lu,heap_frag=%.1f",
+           (unsigned long)heapFree, (unsigned long)heapMin, (unsigned long)heapLargest, fragmentation);
+  structured += line;
+
+  if (allocationCountingAvailable()) {
+    uint32_t allocations = getAllocationCount();
+    uint32_t frees = getFreeCount();
+    snprintf(line, sizeof(line), "[Sys] allocations %lu, frees %lu, outstanding %ld\n",
+             (unsigned long)allocations, (unsigned long)frees, (long)(allocations - frees));
+    report += line;
+    snprintf(line, sizeof(line), ",allocs=%lu,frees=%lu", (unsigned long)allocations, (unsigned long)frees);
+    structured += line;
+
+    snprintf(line, sizeof(line), "[Sys] display frames %lu, %lu allocated (max %lu allocations)\n",
+             (unsigned long)frameCount, (unsigned long)allocatingFrames, (unsigned long)maxFrameAllocations);
+    report += line;
+    snprintf(line, sizeof(line), ",frames=%lu,allocating_frames=%lu,max_frame_allocs=%lu",
+             (unsigned long)frameCount, (unsigned long)allocatingFrames, (unsigned long)maxFrameAllocations);
+    structured += line;
+  } else {
+    report += "[Sys] allocation counting unavailable (build without CONFIG_HEAP_USE_HOOKS)\n";
+    structured += ",allocs=unavailable";
+  }
+
+  report += "[Sys] task             prio    cpu   stack free / size\n";
+
+  for (UBaseType_t i = 0; i < taskCount; i++) {
+    const TaskStatus_t& task = tasks[i];
+    float cpu = haveRunTime
+      ? 100.0f * (task.ulRunTimeCounter - previousRunTime(task.xTaskNumber)) / elapsedRunTime
+      : 0.0f;
+
+    const TrackedTask* trackedTask = nullptr;
+    for (int t = 0; t < trackedSnapshot; t++) {
+      if (tracked[t].handle == task.xHandle) {
+        trackedTask = &tracked[t];
+        break;
+      }
+    }
+    uint32_t stackSize = trackedTask ? trackedTask->stackSize : 0;
+
+    char cpuText[8] = "    -";
+    if (haveRunTime) {
+      snprintf(cpuText, sizeof(cpuText), "%5.1f%%", cpu);
+    }
+    if (trackedTask && allocationCountingAvailable()) {
+      snprintf(line, sizeof(line), "[Sys] %-16s %4u %7s %10lu / %lu, %lu allocs\n", task.pcTaskName,
+               (unsigned)task.uxCurrentPriority, cpuText, (unsigned long)task.usStackHighWaterMark,
+               (unsigned long)stackSize, (unsigned long)trackedTask->allocations);
+    } else if (trackedTask) {
+      snprintf(line, sizeof(line), "[Sys] %-16s %4u %7s %10lu / %lu\n", task.pcTaskName,
+               (unsigned)task.uxCurrentPriority, cpuText, (unsigned long)task.usStackHighWaterMark,
+               (unsigned long)stackSize);
+    } else {
+      snprintf(line, sizeof(line), "[Sys] %-16s %4u %7s %10lu\n", task.pcTaskName,
+               (unsigned)task.uxCurrentPriority, cpuText, (unsigned long)task.usStackHighWaterMark);
+    }
+    report += line;
+
+    snprintf(line, sizeof(line), ";task=%s,stack_free=%lu", task.pcTaskName,
+             (unsigned long)task.usStackHighWaterMark);
+    structured += line;
+    if (trackedTask) {
+      structured += ",stack_size=" + String(stackSize);
+      if (allocationCountingAvailable()) {
+        structured += ",allocs=" + String(trackedTask->allocations);
+      }
+    }
+    if (haveRunTime) {
+      snprintf(line, sizeof(line), ",cpu=%.1f", cpu);
+      structured += line;
+    }
+  }
+
+  // Tracked tasks that have already finished keep their final high-water mark
+  for (int t = 0; t < trackedSnapshot; t++) {
+    if (tracked[t].handle != nullptr) continue;
+    snprintf(line, sizeof(line), "[Sys] %-16s exited       %10lu / %lu\n", tracked[t].name,
+             (unsigned long)tracked[t].exitHighWaterMark, (unsigned long)tracked[t].stackSize);
+    report += line;
+    snprintf(line, sizeof(line), ";task=%s,exited=1,stack_free=%lu,stack_size=%lu", tracked[t].name,
+             (unsigned long)tracked[t].exitHighWaterMark, (unsigned long)tracked[t].stackSize);
+    structured += line;
+  }
+
+  if (!haveRunTime) {
+    report += "[Sys] CPU share unavailable (build without configGENERATE_RUN_TIME_STATS)\n";
+  }
+
+  // Remember the counters for the next report's CPU share
+  lastSampleCount = 0;
+  for (UBaseType_t i = 0; i < taskCount && lastSampleCount < SYS_MAX_TASKS; i++) {
+    lastSamples[lastSampleCount].taskNumber = tasks[i].xTaskNumber;
+    lastSamples[lastSampleCount].runTime = tasks[i].ulRunTimeCounter;
+    lastSampleCount++;
+  }
+  lastTotalRunTime = totalRunTime;
+
+  report += structured;
+  return report;
+}
@@ -0,0 +1,96 @@
+#ifndef SYSTEM_MONITOR_H
+#define SYSTEM_MONITOR_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#define SYS_MAX_TASKS 32              // Tasks listed by the sys command
+#define SYS_MAX_TRACKED_TASKS 8       // Our own tasks with a known stack size
+
+/**
+ * Runtime introspection for the sys command.
+ *
+ * Lists every FreeRTOS task with its CPU share since the previous report
+ * (needs configGENERATE_RUN_TIME_STATS) and its stack high-water mark. Tasks
+ * we create register their stack size so the report can show how much of it
+ * was ever used; short-lived tasks record their final high-water mark before
+ * deleting themselves. Heap fragmentation is reported as the share of free
+ * heap not usable by the largest single allocation, and heap allocations are
+ * counted through the ESP-IDF heap hooks when the build enables them
+ * (CONFIG_HEAP_USE_HOOKS) - in total and per tracked task, plus how many
+ * display frames allocated at all. A screen that is up should render
+ * without touching the heap.
+ */
+class SystemMonitor {
+private:
+  struct TrackedTask {
+    TaskHandle_t handle;              // nullptr once the task has exited
+    char name[16];
+    uint32_t stackSize;               // Bytes, as passed to xTaskCreate
+    uint32_t exitHighWaterMark;       // Minimum free stack recorded at exit
+    uint32_t allocations;             // Heap allocations made by the task (written only by it)
+  };
+
+  struct RunTimeSample {
+    UBaseType_t taskNumber;
+    uint32_t runTime;
+  };
+
+  static SystemMonitor* instance;
+
+  portMUX_TYPE trackedMux;            // Guards trackedTasks
+  TrackedTask trackedTasks[SYS_MAX_TRACKED_TASKS];
+  int trackedCount;
+
+  // Previous run-time counters, for CPU share since the last report
+  RunTimeSample lastSamples[SYS_MAX_TASKS];
+  int lastSampleCount;
+  uint32_t lastTotalRunTime;
+
+  // Display frames, from recordFrame()
+  uint32_t frameCount;
+  uint32_t allocatingFrames;          // Frames that allocated at least once
+  uint32_t maxFrameAllocations;
+
+  SystemMonitor();
+
+  TrackedTask* findTracked(const char* name);
+#ifdef CONFIG_HEAP_USE_HOOKS
+  void attributeAllocation();
+#endif
+  uint32_t previousRunTime(UBaseType_t taskNumber);
+
+public:
+  static SystemMonitor* getInstance();
+
+  // Register a task we created with its stack size (bytes)
+  void trackTask(TaskHandle_t handle, uint32_t stackSize);
+  // Call from a tracked task right before vTaskDelete(NULL)
+  void taskExiting();
+
+  // Human-readable report, one line per task, ending with the structured line
+  String getReport();
+
+#ifdef CONFIG_HEAP_USE_HOOKS
+  // Heap allocations made so far by the calling task (tracked tasks only)
+  uint32_t getCurrentTaskAllocations();
+  // Called by the display task after each frame with the allocations it made
+  void recordFrame(uint32_t allocations);
+#endif
+
+  // Heap allocation counters since boot (0 without heap hooks - check allocationCountingAvailable)
+  static bool allocationCountingAvailable();
+  static uint32_t getAllocationCount() { return allocationCount.load(std::memory_order_relaxed); }
+  static uint32_t getFreeCount() { return freeCount.load(std::memory_order_relaxed); }
+
+  // Incremented from the heap hooks
+  static std::atomic<uint32_t> allocationCount;
+  static std::atomic<uint32_t> freeCount;
+#ifdef CONFIG_HEAP_USE_HOOKS
+  static void countAllocation();      // Count one allocation and attribute it to the current task
+#endif
+};
+
+#endif // SYSTEM_MONITOR_H
@@ -1,8 +1,20 @@
 #include "TCPHandler.h"
+#include <lwip/sockets.h>
 
 TCPHandler::TCPHandler(WiFiHandler* wifiHdlr)
   : wifiHandler(wifiHdlr), tcpServer(nullptr), soundServerPort(12345), 
-    lightServerPort(12345), hasNewTCPMessage(false) {
+    lightServerPort(12345) {
+  
+  queueMutex = xSemaphoreCreateMutex();
+  for (int i = 0; i < TCP_MAX_CLIENTS; i++) {
+    clients[i].id = -1;
+    clients[i].lineLength = 0;
+    clients[i].lineOverflow = false;
+    clients[i].outputHead = 0;
+    clients[i].outputCount = 0;
+    clients[i].lastProgressTime = 0;
+    clients[i].droppedMessages = 0;
+  }
   
   soundServerIP = "";
   lightServerIP = "";
@@ -17,6 +29,14 @@ TCPHandler::TCPHandler(WiFiHandler* wifiHdlr)
 }
 
 TCPHandler::~TCPHandler() {
+  for (int i = 0; i < TCP_MAX_CLIENTS; i++) {
+    if (clients[i].id >= 0) {
+      clients[i].socket.stop();
+    }
+  }
+  if (queueMutex) {
+    vSemaphoreDelete(queueMutex);
+  }
   if (tcpServer) {
     tcpServer->stop();
     delete tcpServer;
@@ -25,7 +45,12 @@ TCPHandler::~TCPHandler() {
 }
 
 void TCPHandler::startTCPServer(int port) {
-  // Clean up any existing server
+  // Clean up any existing server and its clients
+  for (int i = 0; i < TCP_MAX_CLIENTS; i++) {
+    if (clients[i].id >= 0) {
+      closeClient(clients[i], "server restart");
+    }
+  }
   if (tcpServer) {
     tcpServer->stop();
     delete tcpServer;
@@ -56,80 +81,296 @@ void TCPHandler::startTCPServer(int port) {
   Serial.println("TCP server started on " + serverIP.toString() + ":" + String(port));
 }
 
-void TCPHandler::handleTCPServer() {
-  if (!tcpServer) {
-    return;
+bool TCPHandler::getHasNewMessage() {
+  return commandCount > 0;
+}
+
+String TCPHandler::getMessage() {
+  String command;
+  
+  xSemaphoreTake(queueMutex, portMAX_DELAY);
+  if (commandCount > 0) {
+    QueuedCommand& queued = commandQueue[commandHead];
+    command = queued.text;
+    lastMessageClientId = queued.clientId;
+    commandHead = (commandHead + 1) % TCP_COMMAND_QUEUE_DEPTH;
+    commandCount--;
   }
+  xSemaphoreGive(queueMutex);
   
-  // Check if there's a new client connection
-  if (tcpServer->hasClient()) {
-    // If we already have a client, disconnect it
-    if (tcpServerClient) {
-      tcpServerClient.stop();
-      Serial.println("Previous client disconnected");
-    }
+  return command;
+}
 
-    // Accept the new client
-    tcpServerClient = tcpServer->available();
-    Serial.println("New client connected");
+void TCPHandler::sendTCPResponse(const String& message) {
+  broadcastTCPMessage(message);
+}
 
-    // Send welcome message
-    tcpServerClient.println("ESP32 Configuration Server");
-    tcpServerClient.println("Type 'help' for available commands");
-    
-    // Send current IP address
-    IPAddress currentIP = getServerIP();
-    tcpServerClient.println("IP: " + currentIP.toString());
+void TCPHandler::sendTCPResponse(int clientId, const String& message, bool logToSerial) {
+  if (clientId == TCP_BROADCAST) {
+    broadcastTCPMessage(message);
+    return;
   }
+  sendTCPResponse(clientId, message.c_str(), message.length(), logToSerial);
+}
 
-  // Only check for data if client exists and is connected
-  if (!tcpServerClient || !tcpServerClient.connected()) {
+void TCPHandler::sendTCPResponse(int clientId, const char* message, size_t length, bool logToSerial) {
+  if (clientId == TCP_BROADCAST) {
+    broadcastTCPMessage(String(message));
     return;
   }
+  
+  xSemaphoreTake(queueMutex, portMAX_DELAY);
+  ClientSlot* slot = findClient(clientId);
+  if (slot) {
+    queueOutput(*slot, message, length);
+  }
+  xSemaphoreGive(queueMutex);
+  
+  if (logToSerial) {
+    LOG_DEBUG(LOG_TCP, "TCP Response: %s", message);
+  }
+}
 
-  // Check if data is available once - avoids repeated function calls
-  int availableBytes = tcpServerClient.available();
-  if (availableBytes <= 0) {
-    return;
+void TCPHandler::broadcastTCPMessage(const String& message) {
+  // Only copies into each client's output ring - the network task does the socket writes
+  xSemaphoreTake(queueMutex, portMAX_DELAY);
+  for (int i = 0; i < TCP_MAX_CLIENTS; i++) {
+    if (clients[i].id >= 0) {
+      queueOutput(clients[i], message.c_str(), message.length());
+    }
   }
+  xSemaphoreGive(queueMutex);
+  
+  LOG_DEBUG(LOG_TCP, "TCP Response: %s", message.c_str());
+}
 
-  // Process up to 3 commands per call to avoid blocking too long
-  int commandsProcessed = 0;
-  while (tcpServerClient.available() > 0 && commandsProcessed < 3) {
-    // Use readStringUntil but with a timeout to avoid blocking
-    String command = tcpServerClient.readStringUntil('\n');
-    command.trim();
+int TCPHandler::getConnectedClientCount() {
+  int count = 0;
+  for (int i = 0; i < TCP_MAX_CLIENTS; i++) {
+    if (clients[i].id >= 0) count++;
+  }
+  return count;
+}
 
-    if (command.length() > 0) {
-      Serial.println("Received TCP command: " + command);
-      tcpReceivedCommand = command;
-      hasNewTCPMessage = true;
+bool TCPHandler::isClientConnected(int clientId) {
+  return clientId >= 0 && findClient(clientId) != nullptr;
+}
 
-      // Echo the command back to the client
-      tcpServerClient.println("Received: " + command);
-      
-      commandsProcessed++;
+size_t TCPHandler::getOutputSpace(int clientId) {
+  size_t space = 0;
+  xSemaphoreTake(queueMutex, portMAX_DELAY);
+  ClientSlot* slot = findClient(clientId);
+  if (slot) {
+    space = TCP_OUTPUT_BUFFER_SIZE - slot->outputCount;
+  }
+  xSemaphoreGive(queueMutex);
+  return space;
+}
+
+IPAddress TCPHandler::getClientIP(int clientId) {
+  ClientSlot* slot = findClient(clientId);
+  return slot ? slot->socket.remoteIP() : IPAddress();
+}
+
+TCPHandler::ClientSlot* TCPHandler::findClient(int clientId) {
+  for (int i = 0; i < TCP_MAX_CLIENTS; i++) {
+    if (clients[i].id == clientId) {
+      return &clients[i];
     }
+  }
+  return nullptr;
+}
+
+bool TCPHandler::queueOutput(ClientSlot& slot, const char* data, size_t length) {
+  // Messages are queued whole (plus "\r\n") or not at all
+  if (slot.outputCount + length + 2 > TCP_OUTPUT_BUFFER_SIZE) {
+    slot.droppedMessages++;
+    return false;
+  }
+  
+  if (slot.outputCount == 0) {
+    slot.lastProgressTime = millis();
+  }
+  
+  uint16_t tail = (slot.outputHead + slot.outputCount) % TCP_OUTPUT_BUFFER_SIZE;
+  for (size_t i = 0; i < length; i++) {
+    slot.output[tail] = data[i];
+    tail = (tail + 1) % TCP_OUTPUT_BUFFER_SIZE;
+  }
+  slot.output[tail] = '\r';
+  slot.output[(tail + 1) % TCP_OUTPUT_BUFFER_SIZE] = '\n';
+  slot.outputCount += length + 2;
+  return true;
+}
+
+bool TCPHandler::queueCommand(int clientId, const char* text) {
+  bool queued = false;
+  
+  xSemaphoreTake(queueMutex, portMAX_DELAY);
+  if (commandCount < TCP_COMMAND_QUEUE_DEPTH) {
+    QueuedCommand& slot = commandQueue[(commandHead + commandCount) % TCP_COMMAND_QUEUE_DEPTH];
+    slot.clientId = clientId;
+    strncpy(slot.text, text, sizeof(slot.text) - 1);
+    slot.text[sizeof(slot.text) - 1] = '\0';
+    commandCount++;
+    queued = true;
+  }
+  xSemaphoreGive(queueMutex);
+  
+  return queued;
+}
+
+void TCPHandler::acceptClients() {
+  while (tcpServer->hasClient()) {
+    WiFiClient incoming = tcpServer->available();
+    
+    ClientSlot* slot = nullptr;
+    for (int i = 0; i < TCP_MAX_CLIENTS; i++) {
+      if (clients[i].id < 0) {
+        slot = &clients[i];
+        break;
+      }
+    }
+    
+    if (!slot) {
+      incoming.println("Server busy - too many clients");
+      incoming.stop();
+      LOG_WARN(LOG_TCP, "⚠️ Rejected TCP client: all slots in use");
+      continue;
+    }
+    
+    incoming.setNoDelay(true);
+    
+    xSemaphoreTake(queueMutex, portMAX_DELAY);
+    slot->socket = incoming;
+    slot->id = nextClientId++;
+    slot->lineLength = 0;
+    slot->lineOverflow = false;
+    slot->outputHead = 0;
+    slot->outputCount = 0;
+    slot->lastProgressTime = millis();
+    slot->droppedMessages = 0;
+    
+    // Send welcome message
+    IPAddress currentIP = getServerIP();
+    String ipLine = "IP: " + currentIP.toString();
+    queueOutput(*slot, "ESP32 Configuration Server", 26);
+    queueOutput(*slot, "Type 'help' for available commands", 34);
+    queueOutput(*slot, ipLine.c_str(), ipLine.length());
+    xSemaphoreGive(queueMutex);
     
-    // Small yield to allow other processing
-    yield();
+    LOG_INFO(LOG_TCP, "New client connected (id %d, %d active)", slot->id, getConnectedClientCount());
   }
 }
 
-bool TCPHandler::getHasNewMessage() {
-  return hasNewTCPMessage;
+void TCPHandler::readClient(ClientSlot& slot) {
+  // Backpressure: leave input in the socket while this client isn't reading its output
+  if (slot.outputCount > TCP_OUTPUT_HIGH_WATERMARK) {
+    return;
+  }
+  
+  uint8_t chunk[64];
+  int availableBytes = slot.socket.available();
+  
+  while (availableBytes > 0 && commandCount < TCP_COMMAND_QUEUE_DEPTH) {
+    int toRead = availableBytes < (int)sizeof(chunk) ? availableBytes : sizeof(chunk);
+    int bytesRead = slot.socket.read(chunk, toRead);
+    if (bytesRead <= 0) {
+      break;
+    }
+    availableBytes -= bytesRead;
+    
+    for (int i = 0; i < bytesRead; i++) {
+      char c = (char)chunk[i];
+      
+      if (c != '\n') {
+        if (slot.lineLength < TCP_LINE_BUFFER_SIZE - 1) {
+          slot.lineBuffer[slot.lineLength++] = c;
+        } else {
+          slot.lineOverflow = true;
+        }
+        continue;
+      }
+      
+      // Complete line - trim surrounding whitespace in place
+      slot.lineBuffer[slot.lineLength] = '\0';
+      char* start = slot.lineBuffer;
+      while (*start == ' ' || *start == '\t' || *start == '\r') start++;
+      char* end = slot.lineBuffer + slot.lineLength;
+      while (end > start && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r')) end--;
+      *end = '\0';
+      
+      if (slot.lineOverflow) {
+        sendTCPResponse(slot.id, "[Error] Command too long");
+      } else if (*start != '\0') {
+        if (queueCommand(slot.id, start)) {
+          // Echo the command back to the client
+          sendTCPResponse(slot.id, String("Received: ") + start);
+        } else {
+          sendTCPResponse(slot.id, "[Error] Command queue full, try again");
+        }
+      }
+      
+      slot.lineLength = 0;
+      slot.lineOverflow = false;
+    }
+  }
 }
 
-String TCPHandler::getMessage() {
-  hasNewTCPMessage = false;
-  return tcpReceivedCommand;
+void TCPHandler::flushClient(ClientSlot& slot) {
+  unsigned long currentMillis = millis();
+  
+  // Grab the contiguous part of the ring; producers only append behind it
+  xSemaphoreTake(queueMutex, portMAX_DELAY);
+  uint16_t head = slot.outputHead;
+  uint16_t count = slot.outputCount;
+  xSemaphoreGive(queueMutex);
+  
+  if (count == 0) {
+    slot.lastProgressTime = currentMillis;
+    return;
+  }
+  
+  size_t contiguous = TCP_OUTPUT_BUFFER_SIZE - head;
+  size_t toWrite = count < contiguous ? count : contiguous;
+  if (toWrite > TCP_WRITE_CHUNK) toWrite = TCP_WRITE_CHUNK;
+  
+  // WiFiClient::write waits out a full send window for seconds, with xMutex held -
+  // write only what the socket takes now and let the stall timeout drop slow readers
+  int sent = send(slot.socket.fd(), &slot.output[head], toWrite, MSG_DONTWAIT);
+  if (sent < 0) {
+    if (errno != EAGAIN && errno != EWOULDBLOCK) {
+      closeClient(slot, "write failed");
+      return;
+    }
+    sent = 0;
+  }
+  size_t written = sent;
+  
+  if (written > 0) {
+    xSemaphoreTake(queueMutex, portMAX_DELAY);
+    slot.outputHead = (slot.outputHead + written) % TCP_OUTPUT_BUFFER_SIZE;
+    slot.outputCount -= written;
+    slot.lastProgressTime = currentMillis;
+    xSemaphoreGive(queueMutex);
+  } else if (currentMillis - slot.lastProgressTime > TCP_STALL_TIMEOUT) {
+    closeClient(slot, "output stalled");
+  }
 }
 
-void TCPHandler::sendTCPResponse(const String& message) {
-  if (tcpServerClient && tcpServerClient.connected()) {
-    tcpServerClient.println(message);
-    Serial.println("TCP Response: " + message);
+void TCPHandler::closeClient(ClientSlot& slot, const char* reason) {
+  LOG_INFO(LOG_TCP, "TCP client %d disconnected (%s)", slot.id, reason);
+  if (slot.droppedMessages > 0) {
+    LOG_WARN(LOG_TCP, "⚠️ Client dropped %lu messages (slow reader)", (unsigned long)slot.droppedMessages);
   }
+  
+  slot.socket.stop();
+  
+  xSemaphoreTake(queueMutex, portMAX_DELAY);
+  slot.id = -1;
+  slot.outputCount = 0;
+  slot.lineLength = 0;
+  xSemaphoreGive(queueMutex);
 }
 
 bool TCPHandler::connectToServer(const String& ip, uint16_t port) {
@@ -288,41 +529,23 @@ String TCPHandler::getStaticIPConfig() const {
   return config;
 }
 
-// Optimized update method
+// Non-blocking update: accept, read and write for every client
 void TCPHandler::update() {
   // If there's no server, nothing to do
   if (!tcpServer) return;
+  TRACE_SPAN(TRACE_TCP_UPDATE);
   
-  // Only check for new client if we don't already have one
-  if (!tcpServerClient || !tcpServerClient.connected()) {
-    if (tcpServer->hasClient()) {
-      // Accept the new client
-      tcpServerClient = tcpServer->available();
-      Serial.println("New client connected");
-
-      // Send welcome message
-      tcpServerClient.println("ESP32 Configuration Server");
-      tcpServerClient.println("Type 'help' for available commands");
-      
-      // Send current IP address
-      IPAddress currentIP = getServerIP();
-      tcpServerClient.println("IP: " + currentIP.toString());
-    }
-  } else {
-    // Fast check for available data
-    int availableBytes = tcpServerClient.available();
-    if (availableBytes > 0) {
-      // Read one command per cycle to avoid blocking
-      String command = tcpServerClient.readStringUntil('\n');
-      command.trim();
-
-      if (command.length() > 0) {
-        tcpReceivedCommand = command;
-        hasNewTCPMessage = true;
-
-        // Echo the command back to the client
-        tcpServerClient.println("Received: " + command);
-      }
+  acceptClients();
+  
+  for (int i = 0; i < TCP_MAX_CLIENTS; i++) {
+    ClientSlot& slot = clients[i];
+    if (slot.id < 0) continue;
+    
+    readClient(slot);
+    flushClient(slot);
+    
+    if (slot.id >= 0 && !slot.socket.connected()) {
+      closeClient(slot, "closed by peer");
     }
   }
-}
\ No newline at end of file
+}
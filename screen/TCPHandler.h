@@ -4,6 +4,10 @@
 #include <WiFi.h>
 #include <WiFiClient.h>
 #include "WiFiHandler.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "Logger.h"
+#include "EventTrace.h"
 
 // Default values for static IP configuration
 #define DEFAULT_STATIC_IP "192.168.4.1"
@@ -12,14 +16,58 @@
 #define DEFAULT_DNS1 "8.8.8.8"
 #define DEFAULT_DNS2 "8.8.4.4"
 
+// TCP server limits
+#define TCP_MAX_CLIENTS 4                 // Concurrent command clients (PC app, monitors, provisioning)
+#define TCP_LINE_BUFFER_SIZE 256          // Longest accepted command line
+#define TCP_OUTPUT_BUFFER_SIZE 4096       // Per-client queued output
+#define TCP_OUTPUT_HIGH_WATERMARK 3072    // Stop reading from a client while this much output is pending
+#define TCP_WRITE_CHUNK 512               // Max bytes written to one client per update
+#define TCP_STALL_TIMEOUT 10000           // Drop a client whose output hasn't drained for this long (ms)
+#define TCP_COMMAND_QUEUE_DEPTH 8         // Received commands waiting for the CommandHandler
+#define TCP_BROADCAST -1                  // Client id meaning "all connected clients"
+
 class TCPHandler {
 private:
+  // Per-connection state for the command server
+  struct ClientSlot {
+    WiFiClient socket;                       // Accepted connection
+    int id;                                  // Connection id (unique per accept), -1 if free
+    char lineBuffer[TCP_LINE_BUFFER_SIZE];   // Partial input line
+    uint16_t lineLength;                     // Bytes in lineBuffer
+    bool lineOverflow;                       // Current line exceeded the buffer, discard until '\n'
+    char output[TCP_OUTPUT_BUFFER_SIZE];     // Output ring buffer
+    uint16_t outputHead;                     // Next byte to send
+    uint16_t outputCount;                    // Bytes waiting to be sent
+    unsigned long lastProgressTime;          // Last time output drained (or was empty)
+    uint32_t droppedMessages;                // Messages dropped because output was full
+  };
+
+  // Received command tagged with the connection that sent it
+  struct QueuedCommand {
+    int clientId;
+    char text[TCP_LINE_BUFFER_SIZE];
+  };
+
   WiFiHandler* wifiHandler;            // Reference to WiFi handler
   WiFiClient client;                   // TCP client for server connections
   WiFiServer* tcpServer = nullptr;     // TCP server for AP mode
-  WiFiClient tcpServerClient;          // Current TCP server client connection
-  String tcpReceivedCommand;           // Buffer for received TCP command
-  bool hasNewTCPMessage = false;       // Flag for new TCP message
+  ClientSlot clients[TCP_MAX_CLIENTS]; // Connected command clients
+  int nextClientId = 0;                // Id handed to the next accepted client
+  SemaphoreHandle_t queueMutex;        // Guards output rings and the command queue
+
+  QueuedCommand commandQueue[TCP_COMMAND_QUEUE_DEPTH]; // Commands waiting to be processed
+  uint8_t commandHead = 0;             // Oldest queued command
+  uint8_t commandCount = 0;            // Number of queued commands
+  int lastMessageClientId = TCP_BROADCAST; // Sender of the last command returned by getMessage()
+  
+  // Command server helpers
+  void acceptClients();                // Accept pending connections into free slots
+  void readClient(ClientSlot& slot);   // Drain available input into the line buffer
+  void flushClient(ClientSlot& slot);  // Write the next chunk of queued output
+  void closeClient(ClientSlot& slot, const char* reason); // Disconnect and free a slot
+  bool queueOutput(ClientSlot& slot, const char* data, size_t length); // Append a line (caller holds mutex)
+  bool queueCommand(int clientId, const char* text);       // Append a received command
+  ClientSlot* findClient(int clientId); // Look up a slot by connection id
   
   // Server parameters
   String soundServerIP;
@@ -41,10 +89,17 @@ public:
 
   // TCP server methods
   void startTCPServer(int port);       // Start TCP server on specified port
-  void handleTCPServer();              // Handle incoming TCP connections and data
-  bool getHasNewMessage();             // Check if there's a new TCP message
-  String getMessage();                 // Get the received TCP message
-  void sendTCPResponse(const String& message); // Send response to connected TCP client
+  bool getHasNewMessage();             // Check if there's a queued TCP command
+  String getMessage();                 // Pop the oldest queued TCP command
+  int getMessageClientId() const { return lastMessageClientId; } // Sender of the last popped command
+  void sendTCPResponse(const String& message); // Queue a message for every connected client
+  void sendTCPResponse(int clientId, const String& message, bool logToSerial = true); // Queue a message for one client
+  void sendTCPResponse(int clientId, const char* message, size_t length, bool logToSerial = true); // Same, without a String
+  void broadcastTCPMessage(const String& message); // Queue a message for every connected client
+  int getConnectedClientCount();       // Number of connected command clients
+  bool isClientConnected(int clientId); // Check whether a client id is still connected
+  size_t getOutputSpace(int clientId); // Bytes of output a client can take without dropping (0 if unknown)
+  IPAddress getClientIP(int clientId);  // Remote address of a client (0.0.0.0 if unknown)
   
   // TCP client methods
   bool connectToServer(const String& ip, uint16_t port); // Connect to TCP server
@@ -75,7 +130,7 @@ public:
                         const String& subnet, const String& dns1, const String& dns2);
   
   // Main update method
-  void update();                       // Handle periodic TCP tasks
+  void update();                       // Accept clients, read input and flush output (never blocks)
 };
 
 #endif // TCP_HANDLER_H
\ No newline at end of file
@@ -35,7 +35,7 @@ bool TimeHandler::isTimeValid(time_t timeValue) const {
   return timeValue > VALID_TIME_THRESHOLD;
 }
 
-String TimeHandler::getDayOfWeekString(int wday) {
+const char* TimeHandler::getDayOfWeekString(int wday) {
   // Convert time.h weekday (0-6, Sunday = 0) to our 3-letter format
   static const char* days[] = { "SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT" };
   
@@ -104,44 +104,26 @@ void TimeHandler::updateTimeStrings() {
   
   // Only update if we have a valid time
   if (timeinfo.tm_year > 120) { // Year is years since 1900, so 2020 = 120
-    // Format date as YYYY/MM/DD
-    char dateBuffer[11];
-    sprintf(dateBuffer, "%04d/%02d/%02d", 
-            timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday);
-    currentDate = String(dateBuffer);
+    // Format date as YYYY/MM/DD - fields reduced to their digit count so each fits its buffer
+    snprintf(clock.date, sizeof(clock.date), "%04u/%02u/%02u",
+             (unsigned)(timeinfo.tm_year + 1900) % 10000, (unsigned)(timeinfo.tm_mon + 1) % 100,
+             (unsigned)timeinfo.tm_mday % 100);
     
     // Format time as HH:MM
-    char timeBuffer[6];
-    sprintf(timeBuffer, "%02d:%02d", timeinfo.tm_hour, timeinfo.tm_min);
-    currentTime = String(timeBuffer);
+    snprintf(clock.time, sizeof(clock.time), "%02u:%02u",
+             (unsigned)timeinfo.tm_hour % 100, (unsigned)timeinfo.tm_min % 100);
     
     // Get day of week
-    dayOfWeek = getDayOfWeekString(timeinfo.tm_wday);
+    memcpy(clock.dayOfWeek, getDayOfWeekString(timeinfo.tm_wday), sizeof(clock.dayOfWeek));
   }
 }
 
-String TimeHandler::getCurrentDate() {
+void TimeHandler::getClock(ClockSnapshot& snapshot) {
   // Only update strings if time is initialized
   if (timeInitialized) {
     updateTimeStrings();
   }
-  return currentDate;
-}
-
-String TimeHandler::getCurrentTime() {
-  // Only update strings if time is initialized
-  if (timeInitialized) {
-    updateTimeStrings();
-  }
-  return currentTime;
-}
-
-String TimeHandler::getDayOfWeek() {
-  // Only update strings if time is initialized
-  if (timeInitialized) {
-    updateTimeStrings();
-  }
-  return dayOfWeek;
+  snapshot = clock;
 }
 
 int TimeHandler::getCurrentYear() {
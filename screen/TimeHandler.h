@@ -7,14 +7,34 @@
 #include <time.h>
 #include <sys/time.h>
 
+/**
+ * Date and time as the screens display them, in fixed buffers so a snapshot
+ * can be copied and compared every frame without touching the heap.
+ */
+struct ClockSnapshot {
+    char date[11];       // YYYY/MM/DD
+    char time[6];        // HH:MM
+    char dayOfWeek[4];   // SUN..SAT
+
+    bool operator==(const ClockSnapshot& other) const { return memcmp(this, &other, sizeof(*this)) == 0; }
+    bool operator!=(const ClockSnapshot& other) const { return !(*this == other); }
+
+    // Placeholder shown until the time is known
+    static ClockSnapshot unknown() {
+        ClockSnapshot clock;
+        memcpy(clock.date, "----/--/--", sizeof(clock.date));
+        memcpy(clock.time, "--:--", sizeof(clock.time));
+        memcpy(clock.dayOfWeek, "---", sizeof(clock.dayOfWeek));
+        return clock;
+    }
+};
+
 class TimeHandler {
 private:
     // RTC memory variable that persists across deep sleep cycles
     RTC_DATA_ATTR static bool rtcTimeInitialized;
     
-    String currentDate = "----/--/--"; // Current date (default value)
-    String currentTime = "--:--";      // Current time (default value)
-    String dayOfWeek = "---";          // Current day of week (default value)
+    ClockSnapshot clock = ClockSnapshot::unknown(); // Current date, time and day of week
     
     unsigned long lastNtpSyncTime = 0; // Last time we synced with NTP
     unsigned long lastTimeCheckTime = 0; // Last time we updated our string representations
@@ -27,7 +47,7 @@ private:
     static const time_t VALID_TIME_THRESHOLD = 1577836800;  // Jan 1, 2020 (valid time must be after this)
     
     // Helper method to convert numeric weekday to 3-letter string
-    String getDayOfWeekString(int wday);
+    const char* getDayOfWeekString(int wday);
     
     // Update the string representations of date and time
     void updateTimeStrings();
@@ -70,25 +90,11 @@ public:
     struct tm getTimeStruct();
     
     /**
-     * Get current date in format YYYY/MM/DD
-     * 
-     * @return Current date string
-     */
-    String getCurrentDate();
-    
-    /**
-     * Get current time in format HH:MM
-     * 
-     * @return Current time string
-     */
-    String getCurrentTime();
-    
-    /**
-     * Get current day of week (SUN, MON, TUE, etc.)
+     * Get current date (YYYY/MM/DD), time (HH:MM) and day of week (SUN, MON, etc.)
      * 
-     * @return Current day of week string
+     * @param snapshot Receives the current values, placeholders until the time is set
      */
-    String getDayOfWeek();
+    void getClock(ClockSnapshot& snapshot);
     
     /**
      * Get current year (4-digit)
@@ -0,0 +1,129 @@
+#include "TouchGrid.h"
+
+TouchGrid::TouchGrid()
+  : targetCount(0), activeTarget(-1), activeInside(false), holdSent(false) {
+  memset(cellCounts, 0, sizeof(cellCounts));
+}
+
+int TouchGrid::addRect(int x, int y, int width, int height, TouchHandler handler, void* context) {
+  Target target = { (int16_t)x, (int16_t)y, (int16_t)width, (int16_t)height, 0, true, handler, context };
+  return add(target, x, y, x + width - 1, y + height - 1);
+}
+
+int TouchGrid::addCircle(int centerX, int centerY, int radius, TouchHandler handler, void* context) {
+  Target target = { (int16_t)centerX, (int16_t)centerY, 0, 0, (int16_t)radius, true, handler, context };
+  return add(target, centerX - radius, centerY - radius, centerX + radius, centerY + radius);
+}
+
+int TouchGrid::add(const Target& target, int left, int top, int right, int bottom) {
+  if (targetCount >= TOUCH_GRID_MAX_TARGETS) {
+    Serial.println("[Error] Touch grid full");
+    return -1;
+  }
+  uint8_t id = targetCount++;
+  targets[id] = target;
+
+  // Register in every cell the region's bounding box touches
+  int firstColumn = constrain(left / TOUCH_GRID_CELL_SIZE, 0, TOUCH_GRID_COLUMNS - 1);
+  int lastColumn = constrain(right / TOUCH_GRID_CELL_SIZE, 0, TOUCH_GRID_COLUMNS - 1);
+  int firstRow = constrain(top / TOUCH_GRID_CELL_SIZE, 0, TOUCH_GRID_ROWS - 1);
+  int lastRow = constrain(bottom / TOUCH_GRID_CELL_SIZE, 0, TOUCH_GRID_ROWS - 1);
+  for (int row = firstRow; row <= lastRow; row++) {
+    for (int column = firstColumn; column <= lastColumn; column++) {
+      uint8_t& count = cellCounts[row][column];
+      if (count < TOUCH_GRID_CELL_TARGETS) {
+        cells[row][column][count++] = id;
+      } else {
+        Serial.println("[Error] Touch grid cell full");
+      }
+    }
+  }
+  return id;
+}
+
+void TouchGrid::setEnabled(int id, bool enabled) {
+  if (id < 0 || id >= targetCount || targets[id].enabled == enabled) {
+    return;
+  }
+  targets[id].enabled = enabled;
+  if (!enabled && id == activeTarget) {
+    activeTarget = -1;
+    deliver(id, TOUCH_CANCEL);
+  }
+}
+
+void TouchGrid::clear() {
+  targetCount = 0;
+  activeTarget = -1;
+  memset(cellCounts, 0, sizeof(cellCounts));
+}
+
+int TouchGrid::hitTest(int x, int y) const {
+  if (x < 0 || y < 0) {
+    return -1;
+  }
+  int column = x / TOUCH_GRID_CELL_SIZE;
+  int row = y / TOUCH_GRID_CELL_SIZE;
+  if (column >= TOUCH_GRID_COLUMNS || row >= TOUCH_GRID_ROWS) {
+    return -1;
+  }
+
+  // Later targets are on top
+  for (int i = cellCounts[row][column] - 1; i >= 0; i--) {
+    uint8_t id = cells[row][column][i];
+    if (targets[id].enabled && contains(targets[id], x, y)) {
+      return id;
+    }
+  }
+  return -1;
+}
+
+bool TouchGrid::contains(const Target& target, int x, int y) const {
+  if (target.radius > 0) {
+    long dx = x - target.x;
+    long dy = y - target.y;
+    return dx * dx + dy * dy <= (long)target.radius * target.radius;
+  }
+  return x >= target.x && x < target.x + target.width && y >= target.y && y < target.y + target.height;
+}
+
+void TouchGrid::update(TouchPanel* touchPanel) {
+  if (activeTarget < 0) {
+    // Nothing held - only a new press needs a lookup
+    if (!touchPanel->getHasNewPress()) {
+      return;
+    }
+    activeTarget = hitTest(touchPanel->getTouchX(), touchPanel->getTouchY());
+    if (activeTarget >= 0) {
+      activeInside = true;
+      holdSent = false;
+      deliver(activeTarget, TOUCH_PRESS);
+    }
+    return;
+  }
+
+  int id = activeTarget;
+  if (!touchPanel->isPressed()) {
+    // The panel swallows the first release after boot - that one is not a tap
+    activeTarget = -1;
+    deliver(id, activeInside && touchPanel->getHasNewRelease() ? TOUCH_RELEASE : TOUCH_CANCEL);
+    return;
+  }
+
+  // Still down - follow the finger on and off the pressed target only
+  bool inside = contains(targets[id], touchPanel->getTouchX(), touchPanel->getTouchY());
+  if (inside != activeInside) {
+    activeInside = inside;
+    deliver(id, inside ? TOUCH_PRESS : TOUCH_CANCEL);
+  }
+  if (inside && !holdSent && touchPanel->isHold()) {
+    holdSent = true;
+    deliver(id, TOUCH_HOLD);
+  }
+}
+
+void TouchGrid::deliver(int id, TouchEvent event) {
+  if (targets[id].handler) {
+    targets[id].handler(event, targets[id].context);
+  }
+}
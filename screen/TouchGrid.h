@@ -0,0 +1,67 @@
+#ifndef TOUCH_GRID_H
+#define TOUCH_GRID_H
+
+#include <Arduino.h>
+#include "TouchPanel.h"
+
+#define TOUCH_GRID_CELL_SIZE 30      // Pixels per cell side
+#define TOUCH_GRID_COLUMNS 8         // 240 / 30
+#define TOUCH_GRID_ROWS 8
+#define TOUCH_GRID_MAX_TARGETS 8     // Touch targets per screen
+#define TOUCH_GRID_CELL_TARGETS 4    // Targets overlapping one cell
+
+enum TouchEvent {
+  TOUCH_PRESS,                       // Finger down on the target, or back onto it
+  TOUCH_HOLD,                        // Still down after the panel's hold time
+  TOUCH_RELEASE,                     // Lifted while on the target
+  TOUCH_CANCEL                       // Slid off the target, lifted elsewhere, or the target was disabled
+};
+
+typedef void (*TouchHandler)(TouchEvent event, void* context);
+
+/**
+ * Per-screen touch targets, bucketed by a coarse grid of the panel.
+ *
+ * A new press looks up the one cell under the finger and tests only the
+ * few targets registered there, topmost first; at most one target gets the
+ * touch. Until the finger lifts, only that target's region is tested as the
+ * finger moves. Frames without a touch return at once.
+ */
+class TouchGrid {
+public:
+  TouchGrid();
+
+  // Returns the target id, or -1 when the grid is full
+  int addRect(int x, int y, int width, int height, TouchHandler handler, void* context);
+  int addCircle(int centerX, int centerY, int radius, TouchHandler handler, void* context);
+  void setEnabled(int id, bool enabled);
+  void clear();                      // Drop every target, e.g. on screen entry
+
+  void update(TouchPanel* touchPanel); // Deliver this frame's touch events
+  int hitTest(int x, int y) const;     // Topmost enabled target at the point, or -1
+
+private:
+  struct Target {
+    int16_t x, y;                    // Top left, or centre of a circle
+    int16_t width, height;
+    int16_t radius;                  // 0 for rectangles
+    bool enabled;
+    TouchHandler handler;
+    void* context;
+  };
+
+  Target targets[TOUCH_GRID_MAX_TARGETS];
+  uint8_t targetCount;
+  uint8_t cells[TOUCH_GRID_ROWS][TOUCH_GRID_COLUMNS][TOUCH_GRID_CELL_TARGETS];
+  uint8_t cellCounts[TOUCH_GRID_ROWS][TOUCH_GRID_COLUMNS];
+
+  int activeTarget;                  // Target that got the press, -1 when none
+  bool activeInside;                 // Finger is still on it
+  bool holdSent;
+
+  int add(const Target& target, int left, int top, int right, int bottom);
+  bool contains(const Target& target, int x, int y) const;
+  void deliver(int id, TouchEvent event);
+};
+
+#endif // TOUCH_GRID_H
@@ -1,4 +1,5 @@
 #include "TouchPanel.h"
+#include "InputCapture.h"
 
 TouchPanel::TouchPanel(int sda, int scl, int rst, int irq)
   : touch(sda, scl, rst, irq), pressDetected(false), _pressDetected(false),
@@ -17,6 +18,7 @@ void TouchPanel::handleTouchPanel() {
   hasNewRelease = false;
   hasNewHoldRelease = false;
   if (touch.available()) {
+    InputCapture::recordTouch(touch.data.x, touch.data.y, touch.data.gestureID, touch.data.points, touch.data.event);
     if (!firstPress) {
       touchX = touch.data.x;
       touchY = touch.data.y;
@@ -62,8 +64,6 @@ void TouchPanel::handleTouchPanel() {
   }
 
   _pressDetected = pressDetected;
-
-  int releaseExpireDuration = 10;
 }
 
 bool TouchPanel::isPressed() const {
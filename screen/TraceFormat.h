@@ -0,0 +1,62 @@
+#ifndef TRACE_FORMAT_H
+#define TRACE_FORMAT_H
+
+// Binary event trace record format, shared by the firmware (EventTrace) and
+// the host decoder (host/tools/trace2chrome.cpp) - plain C++, no Arduino
+
+#include <stdint.h>
+
+#define TRACE_FORMAT_VERSION 1
+
+// Record kinds
+enum TraceRecordType : uint8_t {
+  TRACE_BEGIN,                // Span opened on the recording task
+  TRACE_END,                  // Innermost open span of the same event closed
+  TRACE_INSTANT,              // Point event, arg is event specific
+  TRACE_COUNTER               // Sampled value in arg
+};
+
+// Traced events - append only, the decoder's names follow this order
+enum TraceEvent : uint16_t {
+  TRACE_DISPLAY_FRAME,        // Span: DisplayController::update (all panel SPI traffic happens here)
+  TRACE_KNOB_UPDATE,          // Span: KnobController::update
+  TRACE_NETWORK_UPDATE,       // Span: WiFiTCPClient::update
+  TRACE_COMMAND_UPDATE,       // Span: CommandHandler::update
+  TRACE_MUTEX_WAIT,           // Span: waiting for xMutex, arg on END = 1 if taken
+  TRACE_MUTEX_HOLD,           // Span: xMutex held
+  TRACE_TASK_BLOCKED,         // Span: task sleeping between iterations
+  TRACE_SCREEN_TRANSITION,    // Span: blocking full-screen transition animation
+  TRACE_MQTT_CONNECT,         // Span: broker connect incl. TLS handshake, arg on END = 1 if connected
+  TRACE_MQTT_LOOP,            // Span: PubSubClient::loop incl. message callbacks
+  TRACE_MQTT_PUBLISH,         // Span: publish, arg = payload bytes
+  TRACE_MQTT_RECEIVE,         // Instant: message received, arg = payload bytes
+  TRACE_TCP_UPDATE,           // Span: TCP command server accept/read/write
+  TRACE_CONFIG_COMMIT,        // Span: EEPROM commit to flash
+  TRACE_FREE_HEAP,            // Counter: free heap bytes
+  TRACE_EVENT_COUNT
+};
+
+// One fixed-size record. Timestamps are the low 32 bits of esp_timer (us)
+// and wrap every ~71 minutes; the decoder unwraps them in ring order.
+struct TraceRecord {
+  uint32_t timestamp;         // us
+  uint32_t task;              // Low 32 bits of the recording task's handle
+  uint32_t arg;               // Event specific
+  uint16_t event;             // TraceEvent
+  uint8_t type;               // TraceRecordType
+  uint8_t core;               // CPU core that recorded it
+};
+
+static_assert(sizeof(TraceRecord) == 16, "TraceRecord is a 16-byte wire format");
+
+inline const char* traceEventName(uint16_t event) {
+  static const char* const names[] = {
+    "display frame", "knob update", "network update", "command update", "mutex wait",
+    "mutex hold", "blocked", "screen transition", "mqtt connect", "mqtt loop",
+    "mqtt publish", "mqtt receive", "tcp update", "config commit", "free heap"
+  };
+  static_assert(sizeof(names) / sizeof(names[0]) == TRACE_EVENT_COUNT, "Name every trace event");
+  return event < TRACE_EVENT_COUNT ? names[event] : "unknown";
+}
+
+#endif // TRACE_FORMAT_H
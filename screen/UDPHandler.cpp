@@ -0,0 +1,154 @@
+#include "UDPHandler.h"
+
+UDPHandler::UDPHandler(WiFiHandler* wifiHdlr)
+  : wifiHandler(wifiHdlr), listening(false), peerPort(0), lastPeerContact(0),
+    peerActive(false), sequence(0), lastValue(-1), lastSendTime(0), repeatPending(false) {
+  udpMutex = xSemaphoreCreateMutex();
+}
+
+UDPHandler::~UDPHandler() {
+  if (listening) {
+    udp.stop();
+  }
+  if (udpMutex) {
+    vSemaphoreDelete(udpMutex);
+  }
+}
+
+void UDPHandler::begin() {
+  xSemaphoreTake(udpMutex, portMAX_DELAY);
+  openPort();
+  xSemaphoreGive(udpMutex);
+}
+
+void UDPHandler::openPort() {
+  if (listening) {
+    udp.stop();
+  }
+  listening = udp.begin(UDP_SETPOINT_PORT);
+  if (listening) {
+    Serial.println("✅ UDP setpoint channel listening on port " + String(UDP_SETPOINT_PORT));
+  } else {
+    Serial.println("❌ Failed to open UDP port " + String(UDP_SETPOINT_PORT));
+  }
+}
+
+void UDPHandler::registerPeer(const IPAddress& ip, uint16_t port) {
+  xSemaphoreTake(udpMutex, portMAX_DELAY);
+  peerIP = ip;
+  peerPort = port;
+  lastPeerContact = millis();
+  repeatPending = false;
+  setPeerActive(true);
+
+  // Let the peer know the current value straight away
+  if (lastValue >= 0) {
+    sendDatagram(lastValue);
+  }
+  xSemaphoreGive(udpMutex);
+}
+
+void UDPHandler::unregisterPeer() {
+  xSemaphoreTake(udpMutex, portMAX_DELAY);
+  peerPort = 0;
+  repeatPending = false;
+  setPeerActive(false);
+  xSemaphoreGive(udpMutex);
+}
+
+void UDPHandler::setPeerActive(bool active) {
+  if (active == peerActive) return;
+  peerActive = active;
+
+  if (active) {
+    Serial.println("📤 UDP setpoint peer active: " + peerIP.toString() + ":" + String(peerPort));
+  } else {
+    Serial.println("⚠️ UDP setpoint peer inactive, falling back to MQTT");
+  }
+}
+
+void UDPHandler::sendDatagram(int value) {
+  char datagram[32];  // "sp:" + 10-digit sequence + ":" + any int
+  int length = snprintf(datagram, sizeof(datagram), "sp:%lu:%d", (unsigned long)++sequence, value);
+
+  udp.beginPacket(peerIP, peerPort);
+  udp.write((const uint8_t*)datagram, length);
+  udp.endPacket();
+}
+
+bool UDPHandler::sendSetpoint(int value) {
+  xSemaphoreTake(udpMutex, portMAX_DELAY);
+  bool sent = peerActive && listening;
+  if (sent) {
+    lastValue = value;
+    lastSendTime = millis();
+    repeatPending = true;
+    sendDatagram(value);
+  }
+  xSemaphoreGive(udpMutex);
+  return sent;
+}
+
+void UDPHandler::handleIncoming() {
+  int packetSize = udp.parsePacket();
+  while (packetSize > 0) {
+    char buffer[32];
+    int length = udp.read(buffer, sizeof(buffer) - 1);
+    buffer[length > 0 ? length : 0] = '\0';
+
+    // Any datagram from the registered peer counts as a keepalive
+    if (peerPort != 0 && udp.remoteIP() == peerIP) {
+      lastPeerContact = millis();
+      setPeerActive(true);
+
+      if (strncmp(buffer, "ping", 4) == 0) {
+        char reply[24];
+        int replyLength = snprintf(reply, sizeof(reply), "pong:%lu", (unsigned long)sequence);
+        udp.beginPacket(udp.remoteIP(), udp.remotePort());
+        udp.write((const uint8_t*)reply, replyLength);
+        udp.endPacket();
+      }
+    }
+
+    packetSize = udp.parsePacket();
+  }
+}
+
+String UDPHandler::getStatus() const {
+  xSemaphoreTake(udpMutex, portMAX_DELAY);
+  String status;
+  if (peerPort == 0) {
+    status = "UDP: no peer registered";
+  } else {
+    status = "UDP: peer " + peerIP.toString() + ":" + String(peerPort) +
+             (peerActive ? " (active" : " (inactive") + ", seq " + String(sequence) + ")";
+  }
+  xSemaphoreGive(udpMutex);
+  return status;
+}
+
+void UDPHandler::update() {
+  xSemaphoreTake(udpMutex, portMAX_DELAY);
+  if (!listening) {
+    if (wifiHandler && (wifiHandler->isWiFiConnected() || wifiHandler->isAPModeActive())) {
+      openPort();
+    }
+    xSemaphoreGive(udpMutex);
+    return;
+  }
+
+  handleIncoming();
+
+  unsigned long currentMillis = millis();
+
+  // Repeat the latest value once so losing the final datagram of a turn doesn't matter
+  if (repeatPending && peerActive && currentMillis - lastSendTime >= UDP_REPEAT_DELAY) {
+    sendDatagram(lastValue);
+    repeatPending = false;
+  }
+
+  if (peerActive && currentMillis - lastPeerContact > UDP_PEER_TIMEOUT) {
+    setPeerActive(false);
+  }
+  xSemaphoreGive(udpMutex);
+}
@@ -0,0 +1,65 @@
+#ifndef UDP_HANDLER_H
+#define UDP_HANDLER_H
+
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include "WiFiHandler.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// UDP setpoint channel configuration
+#define UDP_SETPOINT_PORT 4210        // Local port the device listens on for peer pings
+#define UDP_PEER_TIMEOUT 5000         // Peer considered gone after this long without a datagram (ms)
+#define UDP_REPEAT_DELAY 40           // Resend the latest value once after this delay (ms)
+
+/**
+ * Low-latency LAN setpoint channel.
+ *
+ * A peer registers (udpRegister:<port> over TCP) and then receives
+ * "sp:<seq>:<value>" datagrams for every local setpoint change. Values are
+ * absolute, so a lost datagram is corrected by the next one, and the latest
+ * value is repeated once to cover loss of the final change. The peer keeps the
+ * channel alive by sending "ping" datagrams to UDP_SETPOINT_PORT; when it goes
+ * quiet the channel reports inactive. It only runs ahead of MQTT, which still
+ * carries every setpoint.
+ *
+ * Setpoints are sent from the display task and pings read on the network
+ * task, so every use of the socket and the peer state is under udpMutex.
+ */
+class UDPHandler {
+private:
+  WiFiHandler* wifiHandler;            // Reference to WiFi handler
+  WiFiUDP udp;                         // UDP socket
+  bool listening;                      // Local port is open
+  SemaphoreHandle_t udpMutex;          // Guards the socket and everything below
+
+  IPAddress peerIP;                    // Registered peer address
+  uint16_t peerPort;                   // Registered peer port (0 = no peer)
+  unsigned long lastPeerContact;       // Last datagram/registration from the peer
+  bool peerActive;                     // Channel usable for setpoints
+
+  uint32_t sequence;                   // Last sequence number sent
+  int lastValue;                       // Last setpoint sent (-1 = none)
+  unsigned long lastSendTime;          // When lastValue was sent
+  bool repeatPending;                  // Latest value still needs its repeat
+
+  void openPort();                     // Open the local UDP port, under the lock
+  void sendDatagram(int value);        // Write one setpoint datagram
+  void handleIncoming();               // Process pings from the peer
+  void setPeerActive(bool active);     // Log and update channel state
+
+public:
+  UDPHandler(WiFiHandler* wifiHandler);
+  ~UDPHandler();
+
+  void begin();                        // Open the local UDP port
+  void registerPeer(const IPAddress& ip, uint16_t port); // Start streaming to a peer
+  void unregisterPeer();               // Stop streaming
+  bool isPeerActive() const { return peerActive; }
+  bool sendSetpoint(int value);        // Stream a setpoint, false if the channel is inactive
+  String getStatus() const;            // Human readable channel status
+
+  void update();                       // Read pings, handle repeats and peer timeout
+};
+
+#endif // UDP_HANDLER_H
@@ -77,8 +77,10 @@ bool WeatherHandler::updateWeather() {
 
   // Extract weather data
   if (doc.containsKey("main") && doc["main"].containsKey("temp")) {
-    float temperature = doc["main"]["temp"];
-    weatherTemp = String(int(round(temperature))) + "°C";
+    float reading = doc["main"]["temp"];
+    temperature = round(reading);
+    temperatureValid = true;
+    weatherTemp = String(int(temperature)) + "°C";
 
     // Extract additional data if available
     if (doc["main"].containsKey("humidity")) {
@@ -114,6 +116,11 @@ String WeatherHandler::getWeatherTemperature() const {
   return weatherTemp;
 }
 
+bool WeatherHandler::getTemperature(float& value) const {
+  value = temperature;
+  return temperatureValid;
+}
+
 int WeatherHandler::getHumidity() const {
   return humidity;
 }
@@ -15,6 +15,8 @@ private:
     
     // Weather data
     String weatherTemp = "--°C";     // Current temperature
+    float temperature = 0;           // Current temperature in °C, rounded like weatherTemp
+    bool temperatureValid = false;   // An update has provided the temperature
     int humidity = 0;                // Humidity percentage
     float windSpeed = 0;             // Wind speed in m/s
     String condition = "Unknown";    // Weather condition (Clear, Clouds, etc.)
@@ -37,6 +39,7 @@ public:
     
     // Getters
     String getWeatherTemperature() const;
+    bool getTemperature(float& value) const;   // False until the first successful update
     int getHumidity() const;
     float getWindSpeed() const;
     String getCondition() const;
@@ -1,4 +1,5 @@
 #include "WiFiHandler.h"
+#include "TimeHandler.h"      // ClockSnapshot
 
 WiFiHandler::WiFiHandler(EEPROMManager* eepromMgr)
   : eepromManager(eepromMgr) {
@@ -22,139 +23,256 @@ void WiFiHandler::initialize() {
   Serial.println("WiFiHandler initialized");
 }
 
+// Last good connection, kept in RTC memory so it survives deep sleep and the
+// restart on wake. Not zero-initialized - validated by magic and checksum.
+RTC_NOINIT_ATTR static WiFiConnectCache rtcWiFiCache;
+
+static uint32_t wifiCacheChecksum(const WiFiConnectCache& cache) {
+  // FNV-1a over everything but the checksum field
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&cache);
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < offsetof(WiFiConnectCache, checksum); i++) {
+    hash = (hash ^ bytes[i]) * 16777619UL;
+  }
+  return hash;
+}
+
+// When DHCP granted the cached lease. Applying a lease through WiFi.config makes it
+// a static address that is never renewed, so it is only reused for a while after
+// the DHCP exchange - reconnects on the cached lease leave the stamp alone.
+struct LeaseStamp {
+  uint32_t ip;           // Lease the stamp belongs to, guards against stale RTC memory
+  time_t obtainedAt;     // System time of the DHCP exchange, kept across deep sleep
+};
+RTC_NOINIT_ATTR static LeaseStamp rtcLeaseStamp;
+
+static bool isLeaseFresh(uint32_t ip) {
+  time_t now = time(nullptr);
+  return rtcLeaseStamp.ip == ip &&
+         now >= rtcLeaseStamp.obtainedAt &&
+         now - rtcLeaseStamp.obtainedAt < WIFI_LEASE_REUSE_WINDOW;
+}
+
+static bool isWiFiCacheValid(const WiFiConnectCache& cache) {
+  return cache.magic == WIFI_CACHE_MAGIC &&
+         cache.slot >= 0 && cache.slot < NUM_WIFI_CREDENTIALS &&
+         cache.channel >= 1 && cache.channel <= 14 &&
+         cache.checksum == wifiCacheChecksum(cache);
+}
+
+bool WiFiHandler::waitForConnection(unsigned long timeoutMs) {
+  unsigned long startTime = millis();
+  while (millis() - startTime < timeoutMs) {
+    wl_status_t status = WiFi.status();
+    if (status == WL_CONNECTED) {
+      return true;
+    }
+    if (status == WL_CONNECT_FAILED || status == WL_NO_SSID_AVAIL) {
+      return false;
+    }
+    delay(WIFI_CONNECT_POLL_INTERVAL);
+  }
+  return WiFi.status() == WL_CONNECTED;
+}
+
+bool WiFiHandler::connectWithCache(int& slot) {
+  // RTC copy is fresh (same power session), the EEPROM copy survives power loss
+  bool fromRTC = isWiFiCacheValid(rtcWiFiCache);
+  const WiFiConnectCache& cache = fromRTC ? rtcWiFiCache : eepromManager->wifiCache;
+  if (!fromRTC && !isWiFiCacheValid(cache)) {
+    return false;
+  }
+
+  String ssid = eepromManager->wifiCredentials[cache.slot].ssid;
+  String password = eepromManager->wifiCredentials[cache.slot].password;
+  if (ssid.isEmpty()) {
+    return false;
+  }
+
+  // Reuse the DHCP lease only when it is from this power session, still well within
+  // its lifetime, and no static IP is configured
+  usingCachedLease = false;
+  bool useLease = fromRTC && cache.ip != 0 && !eepromManager->staticIPEnabled && isLeaseFresh(cache.ip);
+  if (useLease) {
+    WiFi.config(IPAddress(cache.ip), IPAddress(cache.gateway), IPAddress(cache.subnet), IPAddress(cache.dns));
+  }
+
+  Serial.printf("⚡ Fast connect to %s (BSSID %02X:%02X:%02X:%02X:%02X:%02X, channel %d%s)\n",
+                ssid.c_str(), cache.bssid[0], cache.bssid[1], cache.bssid[2],
+                cache.bssid[3], cache.bssid[4], cache.bssid[5], cache.channel,
+                useLease ? ", cached lease" : "");
+
+  WiFi.begin(ssid.c_str(), password.c_str(), cache.channel, cache.bssid);
+  if (waitForConnection(WIFI_FAST_CONNECT_TIMEOUT)) {
+    slot = cache.slot;
+    usingCachedLease = useLease;
+    return true;
+  }
+
+  Serial.println("❌ Fast connect failed, dropping cached access point");
+  WiFi.disconnect();
+  if (useLease) {
+    // Back to DHCP for the slower paths
+    WiFi.config(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
+  }
+  memset(&rtcWiFiCache, 0, sizeof(rtcWiFiCache));
+  eepromManager->clearWiFiCache();
+  return false;
+}
+
+void WiFiHandler::storeConnectCache(int slot) {
+  WiFiConnectCache cache;
+  memset(&cache, 0, sizeof(cache));
+  cache.magic = WIFI_CACHE_MAGIC;
+  cache.slot = slot;
+  cache.channel = WiFi.channel();
+  memcpy(cache.bssid, WiFi.BSSID(), sizeof(cache.bssid));
+  if (!eepromManager->staticIPEnabled) {
+    cache.ip = (uint32_t)WiFi.localIP();
+    cache.gateway = (uint32_t)WiFi.gatewayIP();
+    cache.subnet = (uint32_t)WiFi.subnetMask();
+    cache.dns = (uint32_t)WiFi.dnsIP();
+
+    // Only a DHCP exchange restarts the reuse window
+    if (!usingCachedLease) {
+      rtcLeaseStamp.ip = cache.ip;
+      rtcLeaseStamp.obtainedAt = time(nullptr);
+    }
+  }
+  cache.checksum = wifiCacheChecksum(cache);
+
+  rtcWiFiCache = cache;
+  eepromManager->saveWiFiCache(cache);
+}
+
+void WiFiHandler::completeConnection(int slot, const char* method, unsigned long startTime) {
+  lastConnectDuration = millis() - startTime;
+  lastConnectMethod = method;
+
+  Serial.println("\n✅ Connected to WiFi (" + String(method) + ") in " + String(lastConnectDuration) + " ms");
+  Serial.print("IP Address: ");
+  Serial.println(WiFi.localIP());
+
+  // Remember the network for the next boot
+  if (eepromManager->lastConnectedNetworkIndex != slot) {
+    eepromManager->lastConnectedNetworkIndex = slot;
+    eepromManager->saveWiFiCredentials();
+  }
+  storeConnectCache(slot);
+
+  // Get the actual channel of the connected WiFi
+  wifiChannel = WiFi.channel();
+  Serial.print("WiFi connected on channel: ");
+  Serial.println(wifiChannel);
+
+  // Restart AP on the same channel as the connected WiFi
+  restartAPWithChannel();
+
+  wifiConnected = true;
+
+  checkInternetConnectivity();
+  beginOTA(eepromManager->deviceName.c_str());
+}
+
+String WiFiHandler::getConnectReport() const {
+  if (lastConnectDuration == 0) {
+    return "WiFi connect: not connected yet";
+  }
+  return "WiFi connect: " + String(lastConnectDuration) + " ms (" + String(lastConnectMethod) + ")";
+}
+
 bool WiFiHandler::connectToWifi() {
-  // Try to connect to last known network first
-  if (eepromManager) {
-    eepromManager->loadWiFiCredentials();
-
-    int lastIndex = eepromManager->lastConnectedNetworkIndex;
-    if (lastIndex >= 0 && lastIndex < 3) {
-      String lastSSID = eepromManager->wifiCredentials[lastIndex].ssid;
-      String lastPassword = eepromManager->wifiCredentials[lastIndex].password;
-
-      if (!lastSSID.isEmpty()) {
-        Serial.print("🔗 Attempting to reconnect to last known network: ");
-        Serial.println(lastSSID);
-
-        // Already in WIFI_AP_STA mode from constructor
-        WiFi.begin(lastSSID.c_str(), lastPassword.c_str());
-
-        unsigned long startTime = millis();
-        while (WiFi.status() != WL_CONNECTED && millis() - startTime < 15000) {
-          delay(250);  // Reduced delay for faster response
-          if ((millis() - startTime) % 1000 == 0) {
-            Serial.print(".");
-          }
-        }
-
-        if (WiFi.status() == WL_CONNECTED) {
-          Serial.println("\n✅ Successfully reconnected to last known WiFi network!");
-          Serial.print("IP Address: ");
-          Serial.println(WiFi.localIP());
-          // Get the current channel of the connected WiFi and use it for AP
-          wifiChannel = WiFi.channel();
-          Serial.print("WiFi connected on channel: ");
-          Serial.println(wifiChannel);
-          // Restart AP on the same channel as the connected WiFi
-          restartAPWithChannel();
-          wifiConnected = true;
-          // Check internet connectivity
-          checkInternetConnectivity();
-          beginOTA(eepromManager->deviceName.c_str());
-          return true;
-        } else {
-          Serial.println("\n❌ Failed to connect to last known WiFi network.");
-        }
+  if (!eepromManager) {
+    return false;
+  }
+
+  unsigned long connectStart = millis();
+  eepromManager->loadWiFiCredentials();
+
+  // 1. Go straight to the last good access point - no scan
+  int cachedSlot;
+  if (connectWithCache(cachedSlot)) {
+    completeConnection(cachedSlot, "cached", connectStart);
+    return true;
+  }
+
+  // 2. Try the last known network by SSID
+  int lastIndex = eepromManager->lastConnectedNetworkIndex;
+  if (lastIndex >= 0 && lastIndex < NUM_WIFI_CREDENTIALS) {
+    String lastSSID = eepromManager->wifiCredentials[lastIndex].ssid;
+    String lastPassword = eepromManager->wifiCredentials[lastIndex].password;
+
+    if (!lastSSID.isEmpty()) {
+      Serial.print("🔗 Attempting to reconnect to last known network: ");
+      Serial.println(lastSSID);
+
+      // Already in WIFI_AP_STA mode from constructor
+      WiFi.begin(lastSSID.c_str(), lastPassword.c_str());
+
+      if (waitForConnection(WIFI_CONNECT_TIMEOUT)) {
+        completeConnection(lastIndex, "last known", connectStart);
+        return true;
       }
+      Serial.println("\n❌ Failed to connect to last known WiFi network.");
     }
   }
 
-  // If reconnection fails, scan for networks - but don't block too long
+  // 3. Full scan as the last resort
   Serial.println("\n🔍 Scanning for available WiFi networks...");
   int networkCount = WiFi.scanNetworks();
 
-  if (networkCount == 0) {
+  if (networkCount <= 0) {
     Serial.println("❌ No WiFi networks found.");
     return false;
   }
 
   // Find matches with stored networks
-  bool foundNetwork = false;
-  String selectedSSID, selectedPassword;
   int selectedIndex = -1;
-  int selectedChannel = 1;
+  int selectedNetwork = -1;
 
-  for (int j = 0; j < 3; j++) {
+  for (int j = 0; j < NUM_WIFI_CREDENTIALS && selectedIndex < 0; j++) {
     String storedSSID = eepromManager->wifiCredentials[j].ssid;
-    String storedPassword = eepromManager->wifiCredentials[j].password;
-
-    if (storedSSID.length() > 0) {
-      for (int i = 0; i < networkCount; i++) {
-        if (WiFi.SSID(i) == storedSSID) {
-          foundNetwork = true;
-          selectedSSID = storedSSID;
-          selectedPassword = storedPassword;
-          selectedIndex = j;
-          // Remember the channel of this network
-          selectedChannel = WiFi.channel(i);
-          Serial.print("✅ Found saved network: ");
-          Serial.print(selectedSSID);
-          Serial.print(" on channel ");
-          Serial.println(selectedChannel);
-          break;
-        }
+    if (storedSSID.length() == 0) continue;
+
+    for (int i = 0; i < networkCount; i++) {
+      if (WiFi.SSID(i) == storedSSID) {
+        selectedIndex = j;
+        selectedNetwork = i;
+        Serial.print("✅ Found saved network: ");
+        Serial.print(storedSSID);
+        Serial.print(" on channel ");
+        Serial.println(WiFi.channel(i));
+        break;
       }
     }
-    if (foundNetwork) break;
   }
 
-  if (!foundNetwork) {
+  if (selectedIndex < 0) {
     Serial.println("❌ No matching saved networks found.");
+    WiFi.scanDelete();
     return false;
   }
 
-  // Connect to the selected network
+  // Connect to the selected network, pinned to the BSSID/channel the scan found
+  String selectedSSID = eepromManager->wifiCredentials[selectedIndex].ssid;
+  String selectedPassword = eepromManager->wifiCredentials[selectedIndex].password;
+  int selectedChannel = WiFi.channel(selectedNetwork);
+  uint8_t selectedBSSID[6];
+  memcpy(selectedBSSID, WiFi.BSSID(selectedNetwork), sizeof(selectedBSSID));
+  WiFi.scanDelete();
+
   Serial.print("🔗 Connecting to ");
   Serial.println(selectedSSID);
 
-  WiFi.begin(selectedSSID.c_str(), selectedPassword.c_str());
-
-  unsigned long startTime2 = millis();
-  unsigned long maxConnectTime = 15000;  // 15 seconds max connect time
+  WiFi.begin(selectedSSID.c_str(), selectedPassword.c_str(), selectedChannel, selectedBSSID);
 
-  while (WiFi.status() != WL_CONNECTED && millis() - startTime2 < maxConnectTime) {
-    if ((millis() - startTime2) % 1000 == 0) {
-      Serial.print(".");
-    }
-    delay(250);
-  }
-
-  if (WiFi.status() == WL_CONNECTED) {
-    Serial.println("\n✅ Connected to WiFi!");
-    Serial.print("IP Address: ");
-    Serial.println(WiFi.localIP());
-
-    // Save last known network
-    eepromManager->lastConnectedNetworkIndex = selectedIndex;
-    eepromManager->saveWiFiCredentials();
-
-    // Get the actual channel of the connected WiFi
-    wifiChannel = WiFi.channel();
-    Serial.print("WiFi connected on channel: ");
-    Serial.println(wifiChannel);
-
-    // Restart AP on the same channel as the connected WiFi
-    restartAPWithChannel();
-
-    wifiConnected = true;
-
-    checkInternetConnectivity();
-    beginOTA(eepromManager->deviceName.c_str());
+  if (waitForConnection(WIFI_CONNECT_TIMEOUT)) {
+    completeConnection(selectedIndex, "scan", connectStart);
     return true;
-  } else {
-    Serial.println("\n❌ Connection failed.");
-    return false;
   }
+
+  Serial.println("\n❌ Connection failed.");
+  return false;
 }
 
 bool WiFiHandler::startAPSTAMode() {
@@ -295,18 +413,16 @@ bool WiFiHandler::updateWeather() {
   return internetHandler ? internetHandler->updateWeather() : false;
 }
 
-String WiFiHandler::getCurrentDate() const {
-  return internetHandler ? internetHandler->getCurrentDate() : "----/--/--";
+void WiFiHandler::getClock(ClockSnapshot& clock) const {
+  if (internetHandler) {
+    internetHandler->getClock(clock);
+  } else {
+    clock = ClockSnapshot::unknown();
+  }
 }
 
-String WiFiHandler::getCurrentTime() const {
-  return internetHandler ? internetHandler->getCurrentTime() : "--:--";
-}
-String WiFiHandler::getDayOfWeek() const {
-  return internetHandler ? internetHandler->getDayOfWeek() : "---";
-}
-String WiFiHandler::getWeatherTemperature() const {
-  return internetHandler ? internetHandler->getWeatherTemperature() : "--°C";
+bool WiFiHandler::getOutdoorTemperature(float& temperature) const {
+  return internetHandler ? internetHandler->getOutdoorTemperature(temperature) : false;
 }
 
 void WiFiHandler::update() {
@@ -16,6 +16,12 @@
 #define AP_CHECK_INTERVAL 30000       // Check AP status every 30 seconds
 #define WIFI_SCAN_INTERVAL 60000      // Scan for networks once per minute
 
+// Connection timeouts
+#define WIFI_FAST_CONNECT_TIMEOUT 4000  // Direct connect to cached BSSID/channel
+#define WIFI_CONNECT_TIMEOUT 15000      // Connect by SSID (last known or after scan)
+#define WIFI_CONNECT_POLL_INTERVAL 10   // Status poll interval while connecting
+#define WIFI_LEASE_REUSE_WINDOW 1800    // Reuse a cached DHCP lease for this long after DHCP granted it (s)
+
 class WiFiHandler {
 private:
     EEPROMManager* eepromManager;        // Reference to EEPROM manager
@@ -26,6 +32,17 @@ private:
     unsigned long lastAPCheckTime = 0;   // Time of last AP status check
     bool autoStartAP = true;             // Flag to auto-start AP mode when WiFi connection fails
     int wifiChannel = 1;                 // WiFi channel (must be the same for AP and STA modes)
+    
+    // Connect timing report
+    unsigned long lastConnectDuration = 0; // How long the last successful connect took (ms)
+    const char* lastConnectMethod = "none"; // "cached", "last known" or "scan"
+    bool usingCachedLease = false;       // Current connection reuses a cached lease instead of DHCP
+    
+    // Connection helpers
+    bool connectWithCache(int& slot);    // Connect straight to the cached BSSID/channel, slot gets its network
+    bool waitForConnection(unsigned long timeoutMs); // Poll until connected, failed or timed out
+    void completeConnection(int slot, const char* method, unsigned long startTime); // Common success path
+    void storeConnectCache(int slot);    // Save BSSID, channel and lease for the next connect
 
 public:
     WiFiHandler(EEPROMManager* eepromMgr);
@@ -45,6 +62,7 @@ public:
     bool isAPModeActive() const { return apModeActive; }
     bool isAPActive();                   // Check if AP is really active by scanning
     int getWiFiSignalStrength();         // Get WiFi signal strength (0-3)
+    String getConnectReport() const;     // Duration and method of the last connect
     
     // Configuration methods
     void setAutoStartAP(bool enable) { autoStartAP = enable; }
@@ -60,10 +78,8 @@ public:
     // Time and weather methods (delegated to InternetHandler)
     bool updateDateTime();
     bool updateWeather();
-    String getCurrentDate() const;
-    String getCurrentTime() const;
-    String getDayOfWeek() const;
-    String getWeatherTemperature() const;
+    void getClock(ClockSnapshot& clock) const;
+    bool getOutdoorTemperature(float& temperature) const;
     
     // Main update method - call this regularly
     void update();
@@ -1,6 +1,7 @@
 #include "Client.h"
 #include "WiFiTCPClient.h"
 #include "WeatherHandler.h"  // Include the complete WeatherHandler class definition
+#include "TimeHandler.h"     // ClockSnapshot
 
 // Add a static flag to prevent double connection attempts
 static bool wifiConnectionAttempted = false;
@@ -10,11 +11,13 @@ WiFiTCPClient::WiFiTCPClient(EEPROMManager* eepromMgr, unsigned long mqttInterva
   wifiHandler = new WiFiHandler(eepromManager);
   tcpHandler = new TCPHandler(wifiHandler);
   mqttHandler = new MQTTHandler(wifiHandler, eepromManager);
+  udpHandler = new UDPHandler(wifiHandler);
   wifiConnectionAttempted = false;
 }
 
 WiFiTCPClient::~WiFiTCPClient() {
   // Delete in reverse order of creation
+  delete udpHandler;
   delete mqttHandler;
   delete tcpHandler;
   delete wifiHandler;
@@ -44,8 +47,6 @@ void WiFiTCPClient::initialize() {
   Serial.println("MQTT configuration loaded");
   // Complete initialization without MQTT connection attempt
   Serial.println("WiFi/TCP components initialized - MQTT connection will be attempted shortly");
-  // Delay to allow system to stabilize
-  delay(10);
   // Try to connect to MQTT server if internet is available
   if (wifiHandler->isInternetAvailable()) {
     Serial.println("Internet available, getting time and weather info from web.");
@@ -141,6 +142,44 @@ String WiFiTCPClient::getMessage() {
   return tcpHandler ? tcpHandler->getMessage() : "";
 }
 
+void WiFiTCPClient::sendTCPResponse(int clientId, const String& message, bool logToSerial) {
+  if (tcpHandler) {
+    tcpHandler->sendTCPResponse(clientId, message, logToSerial);
+  }
+}
+
+void WiFiTCPClient::sendTCPResponse(int clientId, const char* message, size_t length, bool logToSerial) {
+  if (tcpHandler) {
+    tcpHandler->sendTCPResponse(clientId, message, length, logToSerial);
+  }
+}
+
+void WiFiTCPClient::broadcastTCPMessage(const String& message) {
+  if (tcpHandler) {
+    tcpHandler->broadcastTCPMessage(message);
+  }
+}
+
+int WiFiTCPClient::getMessageClientId() {
+  return tcpHandler ? tcpHandler->getMessageClientId() : TCP_BROADCAST;
+}
+
+int WiFiTCPClient::getTCPClientCount() {
+  return tcpHandler ? tcpHandler->getConnectedClientCount() : 0;
+}
+
+bool WiFiTCPClient::isTCPClientConnected(int clientId) {
+  return tcpHandler ? tcpHandler->isClientConnected(clientId) : false;
+}
+
+size_t WiFiTCPClient::getTCPOutputSpace(int clientId) {
+  return tcpHandler ? tcpHandler->getOutputSpace(clientId) : 0;
+}
+
+IPAddress WiFiTCPClient::getTCPClientIP(int clientId) {
+  return tcpHandler ? tcpHandler->getClientIP(clientId) : IPAddress();
+}
+
 bool WiFiTCPClient::connectToSoundServer() {
   return tcpHandler ? tcpHandler->connectToSoundServer() : false;
 }
@@ -181,7 +220,7 @@ bool WiFiTCPClient::connectToMQTTServer() {
   return mqttHandler ? mqttHandler->connectToMQTTServer() : false;
 }
 
-void WiFiTCPClient::sendMQTTMessage(const char* topic, const String& message) {
+void WiFiTCPClient::sendMQTTMessage(const char* topic, const char* message) {
   if (mqttHandler) {
     mqttHandler->sendMQTTMessage(topic, message);
   }
@@ -200,49 +239,16 @@ bool WiFiTCPClient::isMQTTConnected() {
 }
 
 // Time and weather methods - delegate to WiFiHandler
-String WiFiTCPClient::getCurrentDate() {
+void WiFiTCPClient::getClock(ClockSnapshot& clock) {
   if (wifiHandler) {
-    String date = wifiHandler->getCurrentDate();
-    // Verify we got a valid date
-    if (date.length() > 5) {
-      return date;
-    }
-  }
-  return "----/--/--";
-}
-
-String WiFiTCPClient::getDayOfWeek() {
-  if (wifiHandler) {
-    String dayOfWeek = wifiHandler->getDayOfWeek();
-    if (dayOfWeek.length() == 3) {
-      return dayOfWeek;
-    }
-  }
-  return "---";
-}
-
-String WiFiTCPClient::getCurrentTime() {
-  if (wifiHandler) {
-    String time = wifiHandler->getCurrentTime();
-    // Verify we got a valid time
-    if (time.length() == 5) {
-      return time;
-    }
+    wifiHandler->getClock(clock);
+  } else {
+    clock = ClockSnapshot::unknown();
   }
-  return "--:--";
 }
 
-
-
-String WiFiTCPClient::getWeatherTemperature() {
-  if (wifiHandler) {
-    String temp = wifiHandler->getWeatherTemperature();
-    // Verify we got a valid temperature
-    if (temp.length() > 2 && temp != "10.5°C") {
-      return temp;
-    }
-  }
-  return "--°C";
+bool WiFiTCPClient::getOutdoorTemperature(float& temperature) {
+  return wifiHandler ? wifiHandler->getOutdoorTemperature(temperature) : false;
 }
 
 // Main update method - coordinate all updates
@@ -281,20 +287,23 @@ void WiFiTCPClient::update() {
         }
       }
       break;
+
+    case 3:
+      // LAN setpoint channel - keepalives, repeats and peer timeout
+      if (udpHandler) {
+        udpHandler->update();
+      }
+      break;
   }
 
   // Move to next handler for next cycle
-  handlerIndex = (handlerIndex + 1) % 3;
+  handlerIndex = (handlerIndex + 1) % 4;
 }
 
 // Add this method to your existing WiFiHandler.cpp file
 
-bool WiFiTCPClient::getHasSoundMessage() {
-  return mqttHandler ? mqttHandler->getHasSoundMessage() : false;
-}
-
-String WiFiTCPClient::getSoundMessage() {
-  return mqttHandler ? mqttHandler->getSoundMessage() : "";
+bool WiFiTCPClient::subscribeMQTT(const char* filter, MQTTMessageHandler handler, void* context) {
+  return mqttHandler ? mqttHandler->subscribe(filter, handler, context) : false;
 }
 
 int WiFiHandler::getWiFiSignalStrength() {
@@ -4,6 +4,7 @@
 #include "WiFiHandler.h"
 #include "TCPHandler.h"
 #include "MQTTHandler.h"
+#include "UDPHandler.h"
 #include "EEPROMManager.h"
 
 class WiFiTCPClient {
@@ -12,6 +13,7 @@ private:
   WiFiHandler* wifiHandler;      // WiFi connection handler
   TCPHandler* tcpHandler;        // TCP communication handler
   MQTTHandler* mqttHandler;      // MQTT communication handler
+  UDPHandler* udpHandler;        // LAN UDP setpoint channel
 
   unsigned long intervalMs;  // Interval for periodic operations
 
@@ -36,9 +38,17 @@ public:
   int getWiFiSignalStrength();          // Get WiFi signal strength (0-3)
 
   // TCP methods (keeping for backward compatibility)
-  void sendTCPResponse(const String& message);  // Send response to TCP client
+  void sendTCPResponse(const String& message);  // Send response to all TCP clients
+  void sendTCPResponse(int clientId, const String& message, bool logToSerial = true); // Send response to one TCP client
+  void sendTCPResponse(int clientId, const char* message, size_t length, bool logToSerial = true); // Same, without a String
+  void broadcastTCPMessage(const String& message); // Queue a message for every TCP client
   bool getHasNewMessage();                      // Check if there's a new TCP message
   String getMessage();                          // Get the received TCP message
+  int getMessageClientId();                     // Client that sent the last received message
+  int getTCPClientCount();                      // Number of connected TCP clients
+  bool isTCPClientConnected(int clientId);      // Check whether a TCP client is still connected
+  size_t getTCPOutputSpace(int clientId);       // Output a TCP client can take without dropping
+  IPAddress getTCPClientIP(int clientId);       // Remote address of a TCP client
   bool connectToSoundServer();                  // Connect to the sound server
   bool connectToLightServer();                  // Connect to the light server
   void sendData(const String& data);            // Send data to the server
@@ -49,20 +59,17 @@ public:
   // MQTT methods
   void initializeMQTT();                                           // Initialize MQTT with stored credentials
   bool connectToMQTTServer();                                      // Connect to MQTT broker
-  void sendMQTTMessage(const char* topic, const String& message);  // Send MQTT message
+  void sendMQTTMessage(const char* topic, const char* message);    // Send MQTT message
   bool hasSoundMQTTConfigured();                                   // Check if Sound MQTT is configured
   bool hasLightMQTTConfigured();                                   // Check if Light MQTT is configured
   bool isMQTTConnected();                                          // Check if MQTT is connected
   
-  // New methods for sound message handling
-  bool getHasSoundMessage();                                       // Check for new sound messages
-  String getSoundMessage();                                        // Get the sound message content
+  // MQTT subscriptions
+  bool subscribeMQTT(const char* filter, MQTTMessageHandler handler, void* context); // Register an MQTT topic handler
 
   // Time and weather methods
-  String getCurrentDate();  // Get current date
-  String getCurrentTime();  // Get current time
-  String getDayOfWeek();
-  String getWeatherTemperature();  // Get weather temperature
+  void getClock(ClockSnapshot& clock);              // Get current date, time and day of week
+  bool getOutdoorTemperature(float& temperature);   // Get weather temperature, false if unknown
 
   // Load configuration and update
   void loadConfiguration();  // Load configuration from EEPROM
@@ -71,6 +78,7 @@ public:
   // Access to handlers
   MQTTHandler* getMQTTHandler() { return mqttHandler; }  // Get access to the MQTT handler
   WiFiHandler* getWiFiHandler() { return wifiHandler; }  // Get access to the WiFi handler
+  UDPHandler* getUDPHandler() { return udpHandler; }     // Get access to the UDP setpoint channel
 };
 
 #endif  // WIFI_TCP_CLIENT_H
\ No newline at end of file
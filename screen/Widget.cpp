@@ -0,0 +1,349 @@
+#include "Widget.h"
+
+//////////////////////////////////////////////////
+// WidgetRect
+//////////////////////////////////////////////////
+
+bool WidgetRect::intersects(const WidgetRect& other) const {
+  return !isEmpty() && !other.isEmpty() &&
+         x < other.x + other.w && other.x < x + w &&
+         y < other.y + other.h && other.y < y + h;
+}
+
+WidgetRect WidgetRect::intersection(const WidgetRect& other) const {
+  if (!intersects(other)) {
+    return empty();
+  }
+  int16_t left = max(x, other.x);
+  int16_t top = max(y, other.y);
+  int16_t right = min(x + w, other.x + other.w);
+  int16_t bottom = min(y + h, other.y + other.h);
+  return { left, top, (int16_t)(right - left), (int16_t)(bottom - top) };
+}
+
+WidgetRect WidgetRect::unite(const WidgetRect& other) const {
+  if (isEmpty()) return other;
+  if (other.isEmpty()) return *this;
+  int16_t left = min(x, other.x);
+  int16_t top = min(y, other.y);
+  int16_t right = max(x + w, other.x + other.w);
+  int16_t bottom = max(y + h, other.y + other.h);
+  return { left, top, (int16_t)(right - left), (int16_t)(bottom - top) };
+}
+
+int WidgetRect::subtract(const WidgetRect& other, WidgetRect out[4]) const {
+  if (isEmpty()) {
+    return 0;
+  }
+  if (!intersects(other)) {
+    out[0] = *this;
+    return 1;
+  }
+
+  // Full-width strips above and below, then the sides of the band in between
+  WidgetRect covered = intersection(other);
+  int count = 0;
+  if (covered.y > y) {
+    out[count++] = { x, y, w, (int16_t)(covered.y - y) };
+  }
+  if (covered.y + covered.h < y + h) {
+    out[count++] = { x, (int16_t)(covered.y + covered.h), w, (int16_t)(y + h - covered.y - covered.h) };
+  }
+  if (covered.x > x) {
+    out[count++] = { x, covered.y, (int16_t)(covered.x - x), covered.h };
+  }
+  if (covered.x + covered.w < x + w) {
+    out[count++] = { (int16_t)(covered.x + covered.w), covered.y, (int16_t)(x + w - covered.x - covered.w), covered.h };
+  }
+  return count;
+}
+
+//////////////////////////////////////////////////
+// Widget
+//////////////////////////////////////////////////
+
+Widget::Widget(Arduino_GFX* graphics)
+  : gfx(graphics), bounds(WidgetRect::empty()), visible(true), dirty(true), fullRedraw(true),
+    clip(WidgetRect::empty()), drawnBounds(WidgetRect::empty()), holeX(0), holeY(0), holeRadius(0) {}
+
+void Widget::setBounds(int x, int y, int width, int height) {
+  WidgetRect newBounds = { (int16_t)x, (int16_t)y, (int16_t)width, (int16_t)height };
+  if (newBounds == bounds) {
+    return;
+  }
+  bounds = newBounds;
+  if (fullRedraw || drawnBounds.isEmpty() || !isOpaque() || !clipsToArea()) {
+    invalidate();
+    return;
+  }
+
+  // Opaque and clipped: paint only what it newly covers, what it left is
+  // repainted as background (a growing fill redraws just the added rows)
+  clip = clip.intersection(bounds);
+  WidgetRect exposed[4];
+  int parts = bounds.subtract(drawnBounds, exposed);
+  for (int part = 0; part < parts; part++) {
+    damage(exposed[part]);
+  }
+  dirty = true;
+}
+
+void Widget::setVisible(bool isVisible) {
+  if (isVisible != visible) {
+    visible = isVisible;
+    invalidate();
+  }
+}
+
+void Widget::setHole(int centerX, int centerY, int radius) {
+  holeX = centerX;
+  holeY = centerY;
+  holeRadius = radius;
+}
+
+void Widget::invalidate() {
+  dirty = true;
+  fullRedraw = true;
+}
+
+void Widget::damage(const WidgetRect& area) {
+  WidgetRect part = area.intersection(bounds);
+  if (part.isEmpty()) {
+    return;
+  }
+  clip = dirty ? clip.unite(part) : part;
+  dirty = true;
+}
+
+bool Widget::overlaps(const WidgetRect& area) const {
+  return visible && bounds.intersects(area) && !holeContains(area);
+}
+
+bool Widget::holeContains(const WidgetRect& area) const {
+  if (holeRadius <= 0 || area.isEmpty()) {
+    return false;
+  }
+  // Inside when the corner furthest from the centre is
+  long dx = max(abs(area.x - holeX), abs(area.x + area.w - 1 - holeX));
+  long dy = max(abs(area.y - holeY), abs(area.y + area.h - 1 - holeY));
+  return dx * dx + dy * dy < (long)holeRadius * holeRadius;
+}
+
+//////////////////////////////////////////////////
+// WidgetScreen
+//////////////////////////////////////////////////
+
+WidgetScreen::WidgetScreen(Arduino_GFX* graphics, uint16_t backgroundColor)
+  : gfx(graphics), background(backgroundColor), widgetCount(0), damageCount(0), widgetsDrawn(0) {}
+
+void WidgetScreen::add(Widget* widget) {
+  if (widgetCount < WIDGET_SCREEN_MAX_WIDGETS) {
+    widgets[widgetCount++] = widget;
+  }
+}
+
+void WidgetScreen::begin() {
+  gfx->fillScreen(background);
+  for (int i = 0; i < widgetCount; i++) {
+    widgets[i]->drawnBounds = WidgetRect::empty();
+    widgets[i]->invalidate();
+  }
+}
+
+void WidgetScreen::render() {
+  widgetsDrawn = 0;
+  damageCount = 0;
+
+  for (int i = 0; i < widgetCount; i++) {
+    widgets[i]->animate();
+  }
+
+  // Background to repaint: what widgets no longer cover, and what lies under
+  // transparent widgets about to be redrawn
+  for (int i = 0; i < widgetCount; i++) {
+    Widget* widget = widgets[i];
+    if (!widget->dirty) {
+      continue;
+    }
+    bool shown = widget->visible && !widget->bounds.isEmpty();
+    if (!widget->drawnBounds.isEmpty() && (!shown || widget->bounds != widget->drawnBounds)) {
+      if (shown && widget->isOpaque()) {
+        WidgetRect uncovered[4];
+        int parts = widget->drawnBounds.subtract(widget->bounds, uncovered);
+        for (int part = 0; part < parts; part++) {
+          addDamage(uncovered[part]);
+        }
+      } else {
+        addDamage(widget->drawnBounds);
+      }
+    }
+    if (shown && !widget->isOpaque()) {
+      addDamage(widget->bounds);
+    }
+  }
+
+  for (int d = 0; d < damageCount; d++) {
+    gfx->fillRect(damage[d].x, damage[d].y, damage[d].w, damage[d].h, background);
+    for (int i = 0; i < widgetCount; i++) {
+      if (widgets[i]->overlaps(damage[d])) {
+        widgets[i]->damage(damage[d]);
+      }
+    }
+  }
+
+  // Paint order - whatever a widget paints over is redrawn after it
+  for (int i = 0; i < widgetCount; i++) {
+    Widget* widget = widgets[i];
+    if (!widget->dirty) {
+      continue;
+    }
+    if (!widget->visible || widget->bounds.isEmpty()) {
+      widget->drawnBounds = WidgetRect::empty();
+    } else {
+      // A shrinking fill has nothing of its own to repaint
+      WidgetRect area = widget->fullRedraw ? widget->bounds : widget->clip;
+      if (!area.isEmpty()) {
+        widget->draw(area);
+        widgetsDrawn++;
+        damageAbove(i, widget->clipsToArea() ? area : widget->bounds);
+      }
+      widget->drawnBounds = widget->bounds;
+    }
+    widget->dirty = false;
+    widget->fullRedraw = false;
+    widget->clip = WidgetRect::empty();
+  }
+}
+
+void WidgetScreen::addDamage(const WidgetRect& area) {
+  if (area.isEmpty()) {
+    return;
+  }
+  for (int d = 0; d < damageCount; d++) {
+    if (damage[d].intersects(area)) {
+      damage[d] = damage[d].unite(area);
+      return;
+    }
+  }
+  if (damageCount < WIDGET_SCREEN_MAX_DAMAGE) {
+    damage[damageCount++] = area;
+  } else {
+    damage[damageCount - 1] = damage[damageCount - 1].unite(area);
+  }
+}
+
+void WidgetScreen::damageAbove(int index, const WidgetRect& area) {
+  // Widgets in a ring's hole were not painted over
+  for (int i = index + 1; i < widgetCount; i++) {
+    if (widgets[i]->overlaps(area) && !widgets[index]->holeContains(widgets[i]->bounds)) {
+      widgets[i]->damage(area);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+// Label
+//////////////////////////////////////////////////
+
+Label::Label(Arduino_GFX* graphics)
+  : Widget(graphics), anchorX(0), anchorY(0), align(LABEL_CENTER), textSize(1),
+    color(WHITE), background(BLACK), opaque(true) {
+  text[0] = 0;
+}
+
+void Label::setText(const char* newText) {
+  if (strncmp(text, newText, sizeof(text) - 1) != 0) {
+    strncpy(text, newText, sizeof(text) - 1);
+    text[sizeof(text) - 1] = 0;
+    invalidate();
+    layout();
+  }
+}
+
+void Label::setAnchor(int x, int y, LabelAlign newAlign) {
+  anchorX = x;
+  anchorY = y;
+  align = newAlign;
+  layout();
+}
+
+void Label::setTextSize(uint8_t size) {
+  if (size != textSize) {
+    textSize = size;
+    layout();
+  }
+}
+
+void Label::setColor(uint16_t newColor) {
+  if (newColor != color) {
+    color = newColor;
+    invalidate();
+  }
+}
+
+void Label::setBackground(uint16_t newBackground) {
+  if (!opaque || newBackground != background) {
+    background = newBackground;
+    opaque = true;
+    invalidate();
+  }
+}
+
+void Label::setTransparent() {
+  if (opaque) {
+    opaque = false;
+    invalidate();
+  }
+}
+
+void Label::layout() {
+  int width = strlen(text) * 6 * textSize;
+  int x = anchorX;
+  if (align == LABEL_CENTER) {
+    x -= width / 2;
+  } else if (align == LABEL_RIGHT) {
+    x -= width;
+  }
+  setBounds(x, anchorY, width, 8 * textSize);
+}
+
+void Label::draw(const WidgetRect& clip) {
+  // Opaque text paints its own cells, so there is nothing to clear first
+  gfx->setTextSize(textSize);
+  if (opaque) {
+    gfx->setTextColor(color, background);
+  } else {
+    gfx->setTextColor(color);
+  }
+  gfx->setCursor(bounds.x, bounds.y);
+  gfx->print(text);
+}
+
+//////////////////////////////////////////////////
+// Fill
+//////////////////////////////////////////////////
+
+Fill::Fill(Arduino_GFX* graphics, uint16_t fillColor)
+  : Widget(graphics), color(fillColor) {}
+
+void Fill::setColor(uint16_t newColor) {
+  if (newColor != color) {
+    color = newColor;
+    invalidate();
+  }
+}
+
+void Fill::draw(const WidgetRect& clip) {
+  gfx->fillRect(clip.x, clip.y, clip.w, clip.h, color);
+}
+
+//////////////////////////////////////////////////
+// Icon
+//////////////////////////////////////////////////
+
+Icon::Icon(Arduino_GFX* graphics, IconDrawFunction function, void* drawContext, bool isOpaque)
+  : Widget(graphics), drawFunction(function), context(drawContext), opaque(isOpaque) {}
+
+void Icon::draw(const WidgetRect& clip) {
+  drawFunction(gfx, bounds, context);
+}
@@ -0,0 +1,182 @@
+#ifndef WIDGET_H
+#define WIDGET_H
+
+#include <Arduino_GFX_Library.h>
+
+#define WIDGET_SCREEN_MAX_WIDGETS 16   // Widgets per screen
+#define WIDGET_SCREEN_MAX_DAMAGE 8     // Background rects repainted per frame before merging
+
+// Screen rectangle; empty when w or h is not positive
+struct WidgetRect {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+
+  bool isEmpty() const { return w <= 0 || h <= 0; }
+  bool operator==(const WidgetRect& other) const {
+    return x == other.x && y == other.y && w == other.w && h == other.h;
+  }
+  bool operator!=(const WidgetRect& other) const { return !(*this == other); }
+
+  bool intersects(const WidgetRect& other) const;
+  WidgetRect intersection(const WidgetRect& other) const;
+  WidgetRect unite(const WidgetRect& other) const;       // Bounding box of both
+  int subtract(const WidgetRect& other, WidgetRect out[4]) const; // Parts not covered by other
+
+  static WidgetRect empty() { return { 0, 0, 0, 0 }; }
+};
+
+/**
+ * Node of a screen's retained widget tree.
+ *
+ * A widget owns its bounds and knows how to paint itself; screens only change
+ * its properties. Setters invalidate the widget when the value actually
+ * changes, and WidgetScreen::render() repaints what was invalidated once per
+ * frame, however many properties changed in between.
+ *
+ * Opaque widgets paint every pixel they own (their own background included).
+ * Transparent ones are drawn over whatever lies beneath, which is repainted
+ * first. Widgets that honour the clip rect only repaint the damaged part, and
+ * when they are opaque a resize repaints only the area they newly cover.
+ */
+class Widget {
+public:
+  Widget(Arduino_GFX* graphics);
+  virtual ~Widget() {}
+
+  void setBounds(int x, int y, int width, int height);
+  void setVisible(bool visible);
+  void setHole(int centerX, int centerY, int radius); // Round area inside the bounds the widget never paints (rings)
+  void invalidate();                                // Repaint on the next render
+
+  const WidgetRect& getBounds() const { return bounds; }
+  bool getIsVisible() const { return visible; }
+  bool needsRedraw() const { return dirty; }
+
+  // Called by WidgetScreen
+  virtual void animate() {}                          // Per-frame step, before damage is collected
+  virtual void draw(const WidgetRect& clip) = 0;     // Paint inside the bounds
+  virtual bool isOpaque() const { return true; }
+  virtual bool clipsToArea() const { return false; } // Paints only the clip rect, not the whole bounds
+  bool overlaps(const WidgetRect& area) const;
+
+protected:
+  Arduino_GFX* gfx;
+  WidgetRect bounds;
+  bool visible;
+
+private:
+  friend class WidgetScreen;
+
+  bool dirty;                // Something to repaint on the next render
+  bool fullRedraw;           // All of it, rather than just the damaged clip
+  WidgetRect clip;           // Damaged part to repaint
+  WidgetRect drawnBounds;    // Where it was last painted (empty = not on the panel)
+  int16_t holeX, holeY, holeRadius;
+
+  void damage(const WidgetRect& area);
+  bool holeContains(const WidgetRect& area) const;
+};
+
+/**
+ * Root of a screen's widget tree: the background and its widgets in paint
+ * order, later widgets on top of earlier ones.
+ *
+ * render() works out the damage for the frame - areas a widget left or that
+ * lie under a redrawn transparent widget - repaints the background there,
+ * then redraws each invalidated widget and everything stacked on it, once.
+ */
+class WidgetScreen {
+public:
+  WidgetScreen(Arduino_GFX* graphics, uint16_t backgroundColor = BLACK);
+
+  void add(Widget* widget);       // On top of the widgets added before it
+  void begin();                   // Clear the panel and draw every widget on the next render
+  void render();                  // Animate and repaint this frame's damage
+
+  // Stats of the last render
+  uint8_t getWidgetsDrawn() const { return widgetsDrawn; }
+  uint8_t getDamageRects() const { return damageCount; }
+
+private:
+  Arduino_GFX* gfx;
+  uint16_t background;
+  Widget* widgets[WIDGET_SCREEN_MAX_WIDGETS];
+  uint8_t widgetCount;
+  WidgetRect damage[WIDGET_SCREEN_MAX_DAMAGE];
+  uint8_t damageCount;
+  uint8_t widgetsDrawn;
+
+  void addDamage(const WidgetRect& area);
+  void damageAbove(int index, const WidgetRect& area);
+};
+
+// Text in the default 6x8 font, sized to its text and placed by an anchor
+enum LabelAlign {
+  LABEL_LEFT,                     // Anchor is the left edge
+  LABEL_CENTER,                   // Anchor is the horizontal centre
+  LABEL_RIGHT                     // Anchor is the right edge
+};
+
+#define LABEL_MAX_TEXT 16
+
+class Label : public Widget {
+public:
+  Label(Arduino_GFX* graphics);
+
+  void setText(const char* text);
+  void setAnchor(int x, int y, LabelAlign align = LABEL_CENTER); // y is the top of the text
+  void setTextSize(uint8_t size);
+  void setColor(uint16_t color);
+  void setBackground(uint16_t color); // Paint the text cell in this color
+  void setTransparent();              // Draw over whatever is beneath
+
+  const char* getText() const { return text; }
+
+  void draw(const WidgetRect& clip) override;
+  bool isOpaque() const override { return opaque; }
+
+private:
+  char text[LABEL_MAX_TEXT];
+  int16_t anchorX, anchorY;
+  LabelAlign align;
+  uint8_t textSize;
+  uint16_t color;
+  uint16_t background;
+  bool opaque;
+
+  void layout();
+};
+
+// Solid rectangle
+class Fill : public Widget {
+public:
+  Fill(Arduino_GFX* graphics, uint16_t color = BLACK);
+
+  void setColor(uint16_t color);
+
+  void draw(const WidgetRect& clip) override;
+  bool clipsToArea() const override { return true; }
+
+private:
+  uint16_t color;
+};
+
+// Graphic drawn by its owner's function, e.g. an arrow or a status icon
+typedef void (*IconDrawFunction)(Arduino_GFX* gfx, const WidgetRect& bounds, void* context);
+
+class Icon : public Widget {
+public:
+  Icon(Arduino_GFX* graphics, IconDrawFunction drawFunction, void* context, bool opaque = true);
+
+  void draw(const WidgetRect& clip) override;
+  bool isOpaque() const override { return opaque; }
+
+private:
+  IconDrawFunction drawFunction;
+  void* context;
+  bool opaque;
+};
+
+#endif // WIDGET_H
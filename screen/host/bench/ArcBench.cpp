@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+#include <Arduino_GFX_Library.h>
+#include "Arc.h"
+#include "AntiAlias.h"
+
+// Volume arc geometry from SoundController: centre (120,120), radius 110,
+// width 15, 180 degree sweep starting at 180
+#define ARC_CENTER 120
+#define ARC_RADIUS 110
+#define ARC_WIDTH 15
+#define ARC_LENGTH 180
+#define ARC_START 180
+
+// Raw rasterization of one ring segment of the given sweep (degrees)
+static void BM_FillArc(benchmark::State& state) {
+  Arduino_GC9A01 gfx(nullptr);
+  float sweep = (float)state.range(0);
+  gfx.resetPixelsWritten();
+  for (auto _ : state) {
+    gfx.fillArc(ARC_CENTER, ARC_CENTER, ARC_RADIUS + ARC_WIDTH / 2, ARC_RADIUS - ARC_WIDTH / 2,
+                ARC_START, ARC_START + sweep, WHITE);
+  }
+  state.counters["pixels"] = benchmark::Counter((double)gfx.getPixelsWritten() / state.iterations());
+}
+BENCHMARK(BM_FillArc)->Arg(2)->Arg(18)->Arg(90)->Arg(180)->Arg(270);
+
+// The same segment with smoothed edges - what Arc draws
+static void BM_FillArcSmooth(benchmark::State& state) {
+  Arduino_GC9A01 gfx(nullptr);
+  float sweep = (float)state.range(0);
+  gfx.resetPixelsWritten();
+  for (auto _ : state) {
+    AntiAlias::fillArc(&gfx, ARC_CENTER, ARC_CENTER, ARC_RADIUS + ARC_WIDTH / 2, ARC_RADIUS - ARC_WIDTH / 2,
+                       ARC_START, ARC_START + sweep, WHITE, BLACK);
+  }
+  state.counters["pixels"] = benchmark::Counter((double)gfx.getPixelsWritten() / state.iterations());
+}
+BENCHMARK(BM_FillArcSmooth)->Arg(2)->Arg(18)->Arg(90)->Arg(180)->Arg(270);
+
+// One knob detent: the arc animates one percent and redraws only the delta
+static void BM_ArcSetpointStep(benchmark::State& state) {
+  Arduino_GC9A01 gfx(nullptr);
+  Arc arc(&gfx);
+  arc.initialize(ARC_CENTER, ARC_CENTER, ARC_RADIUS, ARC_WIDTH, ARC_LENGTH, ARC_START);
+  hostAdvanceMillis(1);
+
+  int percentage = 0;
+  int direction = 1;
+  gfx.resetPixelsWritten();
+  for (auto _ : state) {
+    percentage += direction;
+    if (percentage >= 100 || percentage <= 0) direction = -direction;
+    arc.setPercentage(percentage);
+    arc.update();              // Starts the animation
+    hostAdvanceMillis(300);    // Skip to its end
+    arc.update();              // Draws the new segment
+  }
+  state.counters["pixels"] = benchmark::Counter((double)gfx.getPixelsWritten() / state.iterations());
+}
+BENCHMARK(BM_ArcSetpointStep);
+
+// Full repaint of the background slot, as on a screen change
+static void BM_ArcFullSegment(benchmark::State& state) {
+  Arduino_GC9A01 gfx(nullptr);
+  Arc arc(&gfx);
+  arc.initialize(ARC_CENTER, ARC_CENTER, ARC_RADIUS, ARC_WIDTH, ARC_LENGTH, ARC_START);
+  for (auto _ : state) {
+    arc.drawFullSegment();
+  }
+}
+BENCHMARK(BM_ArcFullSegment);
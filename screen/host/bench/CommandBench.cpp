@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+#include "CommandHandler.h"
+
+// Serial command path: the line is read, split at ':' and looked up in the
+// command table. update() checks one source per call (serial, knob, TCP), so
+// three calls cover one full round.
+static void runCommand(benchmark::State& state, const char* line) {
+  static EEPROMManager eeprom;
+  static bool eepromReady = false;
+  if (!eepromReady) {
+    eeprom.begin();
+    eepromReady = true;
+  }
+
+  CommandHandler handler(nullptr, &eeprom, nullptr);
+  handler.initialize();
+
+  for (auto _ : state) {
+    Serial.inject(line);
+    handler.update();
+    handler.update();
+    handler.update();
+  }
+}
+
+static void BM_CommandGetValue(benchmark::State& state) {
+  runCommand(state, "getEEPROMValue:soundMQTTPort\n");
+}
+BENCHMARK(BM_CommandGetValue);
+
+static void BM_CommandSetValue(benchmark::State& state) {
+  runCommand(state, "setEEPROMValue:soundTCPPort:5000\n");
+}
+BENCHMARK(BM_CommandSetValue);
+
+static void BM_CommandUnknown(benchmark::State& state) {
+  runCommand(state, "notACommand:1:2\n");
+}
+BENCHMARK(BM_CommandUnknown);
+
+static void BM_CommandHelp(benchmark::State& state) {
+  runCommand(state, "help\n");
+}
+BENCHMARK(BM_CommandHelp);
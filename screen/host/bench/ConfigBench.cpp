@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+#include "EEPROMManager.h"
+#include "ConfigKeys.h"
+
+// Lookup of every key in the table through the hashed index
+static void BM_ConfigKeyLookup(benchmark::State& state) {
+  int count = ConfigKeys::count();
+  for (auto _ : state) {
+    for (int i = 0; i < count; i++) {
+      benchmark::DoNotOptimize(ConfigKeys::find(ConfigKeys::at(i).name));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ConfigKeyLookup);
+
+static void BM_ConfigGetValue(benchmark::State& state) {
+  EEPROMManager eeprom;
+  eeprom.begin();
+  const ConfigKey* key = ConfigKeys::find("lightMQTTURL");
+  char value[CONFIG_LINE_LENGTH];
+  for (auto _ : state) {
+    eeprom.getValue(*key, value, sizeof(value));
+    benchmark::DoNotOptimize(value);
+  }
+}
+BENCHMARK(BM_ConfigGetValue);
+
+// Pack, CRC and write of the config image to the alternate slot
+static void BM_ConfigCommit(benchmark::State& state) {
+  EEPROMManager eeprom;
+  eeprom.begin();
+  int port = 1000;
+  for (auto _ : state) {
+    eeprom.saveSoundTCPServer("192.168.1.20", port++);
+    eeprom.commit();
+  }
+}
+BENCHMARK(BM_ConfigCommit);
+
+// Boot path: pick the newest valid slot and unpack it
+static void BM_ConfigLoad(benchmark::State& state) {
+  {
+    EEPROMManager eeprom;
+    eeprom.begin();
+    eeprom.saveDeviceName("bench");
+    eeprom.commit();
+  }
+  for (auto _ : state) {
+    EEPROMManager eeprom;
+    eeprom.begin();
+    benchmark::DoNotOptimize(eeprom.deviceName);
+  }
+}
+BENCHMARK(BM_ConfigLoad);
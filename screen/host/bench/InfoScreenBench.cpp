@@ -0,0 +1,28 @@
+#include <benchmark/benchmark.h>
+#include <Arduino_GFX_Library.h>
+#include "InfoScreen.h"
+#include "SystemMonitor.h"
+
+// Steady-state info screen frames at the display task's rate - once the
+// screen is up, a frame should not touch the heap
+static void BM_InfoScreenFrame(benchmark::State& state) {
+  EEPROMManager eeprom;
+  eeprom.begin();
+  WiFiTCPClient client(&eeprom);
+  client.initialize();
+
+  Arduino_GC9A01 gfx(nullptr);
+  TouchPanel touch(0, 0, 0, 0);
+  InfoScreen screen(&gfx, &touch, &client);
+  screen.update();             // First frame draws everything
+  hostAdvanceMillis(1);
+
+  uint32_t allocations = SystemMonitor::getAllocationCount();
+  for (auto _ : state) {
+    hostAdvanceMillis(16);
+    screen.update();
+  }
+  state.counters["allocs"] = benchmark::Counter(
+    (double)(SystemMonitor::getAllocationCount() - allocations) / state.iterations());
+}
+BENCHMARK(BM_InfoScreenFrame);
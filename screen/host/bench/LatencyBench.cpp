@@ -0,0 +1,45 @@
+#include <benchmark/benchmark.h>
+#include <Arduino_GFX_Library.h>
+#include "Arc.h"
+#include "LatencyTracer.h"
+
+// Cost of one histogram sample on the hot path
+static void BM_LatencyRecord(benchmark::State& state) {
+  LatencyTracer* tracer = LatencyTracer::getInstance();
+  tracer->reset();
+  uint32_t value = 1;
+  for (auto _ : state) {
+    tracer->recordValue(LATENCY_KNOB_TO_PIXEL, value);
+    value = value * 1103515245u + 12345u;
+    value &= 0xFFFFF;                    // Up to ~1 s
+  }
+  tracer->reset();
+}
+BENCHMARK(BM_LatencyRecord);
+
+// Knob detent to first arc pixels with the display task's 5 ms frame period,
+// in simulated time - the counters are the traced p50/p99 in ms
+static void BM_KnobToPixel(benchmark::State& state) {
+  Arduino_GC9A01 gfx(nullptr);
+  Arc arc(&gfx);
+  arc.initialize(120, 120, 110, 15, 180, 180);
+  LatencyTracer* tracer = LatencyTracer::getInstance();
+  tracer->reset();
+
+  int percentage = 0;
+  int direction = 1;
+  for (auto _ : state) {
+    percentage += direction;
+    if (percentage >= 100 || percentage <= 0) direction = -direction;
+    arc.setPercentage(percentage, LatencyTracer::now());
+    // Frames until the animation has settled
+    for (int frame = 0; frame < 64; frame++) {
+      hostAdvanceMillis(5);
+      arc.update();
+    }
+  }
+  state.counters["p50_ms"] = tracer->getPercentile(LATENCY_KNOB_TO_PIXEL, 50) / 1000.0;
+  state.counters["p99_ms"] = tracer->getPercentile(LATENCY_KNOB_TO_PIXEL, 99) / 1000.0;
+  tracer->reset();
+}
+BENCHMARK(BM_KnobToPixel);
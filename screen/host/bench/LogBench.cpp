@@ -0,0 +1,29 @@
+#include <benchmark/benchmark.h>
+#include "Logger.h"
+
+// Caller-side cost of a log line: format into the ring and return
+static void BM_LogEnqueue(benchmark::State& state) {
+  Logger::setLevel(LOG_MQTT, LOG_LEVEL_INFO);
+  int count = 0;
+  for (auto _ : state) {
+    LOG_INFO(LOG_MQTT, "📤 Sent MQTT message on topic [%s]: %s", "qnob/setpoint", "sender=QNOB,42");
+    if (++count == LOG_QUEUE_DEPTH / 2) {
+      state.PauseTiming();
+      Logger::flush();
+      state.ResumeTiming();
+      count = 0;
+    }
+  }
+  Logger::flush();
+}
+BENCHMARK(BM_LogEnqueue);
+
+// A message below the module's level - no arguments are evaluated
+static void BM_LogDisabled(benchmark::State& state) {
+  Logger::setLevel(LOG_MQTT, LOG_LEVEL_INFO);
+  String message = "sender=QNOB,42";
+  for (auto _ : state) {
+    LOG_DEBUG(LOG_MQTT, "TCP Response: %s", message.c_str());
+  }
+}
+BENCHMARK(BM_LogDisabled);
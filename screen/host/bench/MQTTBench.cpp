@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+#include "MQTTHandler.h"
+#include "MQTTDispatcher.h"
+
+// Filters the firmware registers (MQTTHandler and SoundController)
+static const char* const FIRMWARE_FILTERS[] = {
+  "esp32/light/brightness",
+  "esp32/sound/setpoint",
+  "esp32/sound/control",
+  "esp32/sound/response",
+};
+
+static void countHandler(const char* topic, const PayloadView& payload, void* context) {
+  (void)topic;
+  (void)payload;
+  (*static_cast<int*>(context))++;
+}
+
+static void BM_DispatcherMatch(benchmark::State& state) {
+  MQTTDispatcher dispatcher;
+  int calls = 0;
+  for (const char* filter : FIRMWARE_FILTERS) dispatcher.subscribe(filter, countHandler, &calls);
+  dispatcher.subscribe("esp32/+/state", countHandler, &calls);
+  dispatcher.subscribe("home/#", countHandler, &calls);
+
+  const char* topics[] = { "esp32/sound/setpoint", "esp32/light/state", "home/kitchen/temp", "other/topic" };
+  for (auto _ : state) {
+    for (const char* topic : topics) {
+      benchmark::DoNotOptimize(dispatcher.match(topic));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 4);
+}
+BENCHMARK(BM_DispatcherMatch);
+
+// What the callback does with a payload: strip "sender=...," and read the value
+static void BM_PayloadParse(benchmark::State& state) {
+  static const char raw[] = "sender=livingroom-knob,setpoint:42";
+  for (auto _ : state) {
+    PayloadView message(raw, sizeof(raw) - 1);
+    if (message.startsWith("sender=")) {
+      int commaPos = message.indexOf(',');
+      if (commaPos >= 0) message = message.substr(commaPos + 1);
+    }
+    long value = -1;
+    if (message.startsWith("setpoint:")) value = message.substr(9).toInt();
+    benchmark::DoNotOptimize(value);
+  }
+}
+BENCHMARK(BM_PayloadParse);
+
+// Whole inbound path: PubSubClient buffer -> MQTTHandler::callback ->
+// dispatcher -> SoundController-style queue, and the consumer pop
+static void BM_MQTTInbound(benchmark::State& state) {
+  EEPROMManager eeprom;
+  eeprom.begin();
+  eeprom.wifiCredentials[0].ssid = "HostNetwork";
+  eeprom.wifiCredentials[0].password = "password";
+  eeprom.lastConnectedNetworkIndex = 0;
+  eeprom.saveSoundMQTTServer("broker.local", 8883, "user", "secret");
+
+  WiFiHandler wifiHandler(&eeprom);
+  wifiHandler.initialize();
+
+  MQTTHandler mqttHandler(&wifiHandler, &eeprom);
+  MQTTMessageQueue setpointQueue;
+  mqttHandler.subscribe("esp32/sound/setpoint", MQTTMessageQueue::enqueueHandler, &setpointQueue);
+  mqttHandler.initializeMQTT(false);
+  if (!mqttHandler.connectToMQTTServer()) {
+    state.SkipWithError("MQTT connect failed");
+    return;
+  }
+
+  static const char payload[] = "sender=livingroom-knob,setpoint:42";
+  long total = 0;
+  for (auto _ : state) {
+    PubSubClient::hostDeliver("esp32/sound/setpoint", reinterpret_cast<const uint8_t*>(payload), sizeof(payload) - 1);
+    const MQTTMessageQueue::Message* message = setpointQueue.front();
+    if (message) {
+      total += message->view().substr(9).toInt();
+      setpointQueue.pop();
+    }
+  }
+  benchmark::DoNotOptimize(total);
+  if (total != 42 * (long)state.iterations()) state.SkipWithError("messages were lost");
+}
+BENCHMARK(BM_MQTTInbound);
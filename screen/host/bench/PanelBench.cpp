@@ -0,0 +1,30 @@
+#include <benchmark/benchmark.h>
+#include <Arduino_GFX_Library.h>
+#include "RoundPanel.h"
+
+// Full screen clear, as on every screen change - the round panel skips the corners
+template <class Panel>
+static void BM_FillScreen(benchmark::State& state) {
+  Panel gfx(nullptr);
+  bool flip = false;
+
+  gfx.resetPixelsWritten();
+  for (auto _ : state) {
+    flip = !flip;
+    gfx.fillScreen(flip ? WHITE : BLACK);
+  }
+  state.counters["pixels"] = benchmark::Counter((double)gfx.getPixelsWritten() / state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_FillScreen, Arduino_GC9A01);
+BENCHMARK_TEMPLATE(BM_FillScreen, RoundPanel);
+
+// Small fills inside the circle go out untouched, as one block
+static void BM_FillRectInside(benchmark::State& state) {
+  RoundPanel gfx(nullptr);
+  bool flip = false;
+  for (auto _ : state) {
+    flip = !flip;
+    gfx.fillRect(70, 70, 100, 100, flip ? WHITE : BLACK);
+  }
+}
+BENCHMARK(BM_FillRectInside);
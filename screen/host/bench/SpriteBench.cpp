@@ -0,0 +1,31 @@
+#include <benchmark/benchmark.h>
+#include <Arduino_GFX_Library.h>
+#include "ModeController.h"
+#include "Sprite.h"
+
+// Home screen knob step - used to clear the panel and draw the logo from
+// primitives (twice), now one sprite blit and the title
+static void BM_ModeSwitch(benchmark::State& state) {
+  Arduino_GC9A01 gfx(nullptr);
+  ModeController modes(&gfx, nullptr, nullptr);
+  modes.setActive(true);
+
+  gfx.resetPixelsWritten();
+  for (auto _ : state) {
+    modes.nextMode();
+    modes.updateScreen();
+  }
+  state.counters["pixels"] = benchmark::Counter((double)gfx.getPixelsWritten() / state.iterations());
+}
+BENCHMARK(BM_ModeSwitch);
+
+// Media button press/release repaint, tinted
+static void BM_ButtonSpriteDraw(benchmark::State& state) {
+  Arduino_GC9A01 gfx(nullptr);
+  bool pressed = false;
+  for (auto _ : state) {
+    pressed = !pressed;
+    SPRITE_PLAY.draw(&gfx, 120, 120, pressed ? RED : WHITE);
+  }
+}
+BENCHMARK(BM_ButtonSpriteDraw);
@@ -0,0 +1,17 @@
+#include <benchmark/benchmark.h>
+#include "TimeHandler.h"
+#include "SystemMonitor.h"
+
+// Clock snapshot as the info screen requests it every refresh
+static void BM_ClockSnapshot(benchmark::State& state) {
+  TimeHandler timeHandler(9);
+  ClockSnapshot clock;
+  uint32_t allocations = SystemMonitor::getAllocationCount();
+  for (auto _ : state) {
+    timeHandler.getClock(clock);
+    benchmark::DoNotOptimize(clock);
+  }
+  state.counters["allocs"] = benchmark::Counter(
+    (double)(SystemMonitor::getAllocationCount() - allocations) / state.iterations());
+}
+BENCHMARK(BM_ClockSnapshot);
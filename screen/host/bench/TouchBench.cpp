@@ -0,0 +1,41 @@
+#include <benchmark/benchmark.h>
+#include "TouchGrid.h"
+
+static void ignoreTouch(TouchEvent event, void* context) {}
+
+// Sound page layout: four media buttons in a row and the back button below
+static void addSoundTargets(TouchGrid& grid) {
+  grid.addCircle(120, 120, 30, ignoreTouch, nullptr);
+  grid.addCircle(120, 120, 30, ignoreTouch, nullptr);
+  grid.addCircle(60, 120, 30, ignoreTouch, nullptr);
+  grid.addCircle(180, 120, 30, ignoreTouch, nullptr);
+  grid.addRect(100, 200, 41, 21, ignoreTouch, nullptr);
+  grid.setEnabled(1, false);
+}
+
+// Frame with no finger on the panel - used to be five button bounds tests
+static void BM_TouchGridIdle(benchmark::State& state) {
+  TouchPanel touch(0, 0, 0, 0);
+  TouchGrid grid;
+  addSoundTargets(grid);
+  touch.handleTouchPanel();
+
+  for (auto _ : state) {
+    grid.update(&touch);
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_TouchGridIdle);
+
+// Resolving a press, sweeping across the panel
+static void BM_TouchGridHitTest(benchmark::State& state) {
+  TouchGrid grid;
+  addSoundTargets(grid);
+
+  int x = 0;
+  for (auto _ : state) {
+    x = (x + 7) % 240;
+    benchmark::DoNotOptimize(grid.hitTest(x, 120));
+  }
+}
+BENCHMARK(BM_TouchGridHitTest);
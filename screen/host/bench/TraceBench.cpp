@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+#include "EventTrace.h"
+
+// Cost of one record - what every traced span pays twice
+static void BM_TraceRecord(benchmark::State& state) {
+  EventTrace::begin();
+  EventTrace::setEnabled(true);
+  for (auto _ : state) {
+    TRACE_INSTANT(TRACE_MQTT_RECEIVE, 42);
+  }
+}
+BENCHMARK(BM_TraceRecord);
+
+static void BM_TraceSpan(benchmark::State& state) {
+  EventTrace::begin();
+  EventTrace::setEnabled(true);
+  for (auto _ : state) {
+    TRACE_SPAN(TRACE_DISPLAY_FRAME);
+  }
+}
+BENCHMARK(BM_TraceSpan);
+
+// Recording switched off by the trace command
+static void BM_TraceDisabled(benchmark::State& state) {
+  EventTrace::begin();
+  EventTrace::setEnabled(false);
+  for (auto _ : state) {
+    TRACE_SPAN(TRACE_DISPLAY_FRAME);
+  }
+  EventTrace::setEnabled(true);
+}
+BENCHMARK(BM_TraceDisabled);
+
+// One dump line: copy a line's records out of the ring and base64 them
+static void BM_TraceDumpLine(benchmark::State& state) {
+  EventTrace::begin();
+  EventTrace::setEnabled(true);
+  for (int i = 0; i < TRACE_DUMP_RECORDS_PER_LINE; i++) {
+    TRACE_INSTANT(TRACE_MQTT_RECEIVE, i);
+  }
+  uint32_t first, end;
+  EventTrace::getRange(first, end);
+  char line[4 * ((TRACE_DUMP_RECORDS_PER_LINE * sizeof(TraceRecord) + 2) / 3) + 1];
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(EventTrace::encodeRecords(end - TRACE_DUMP_RECORDS_PER_LINE,
+                                                       TRACE_DUMP_RECORDS_PER_LINE, line, sizeof(line)));
+  }
+  state.SetBytesProcessed(state.iterations() * TRACE_DUMP_RECORDS_PER_LINE * sizeof(TraceRecord));
+}
+BENCHMARK(BM_TraceDumpLine);
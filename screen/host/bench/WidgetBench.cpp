@@ -0,0 +1,41 @@
+#include <benchmark/benchmark.h>
+#include <Arduino_GFX_Library.h>
+#include "LightController.h"
+
+// Light screen with nothing changing - the mode text and arrows used to be
+// redrawn on every frame, the widget tree draws nothing
+static void BM_LightIdleFrame(benchmark::State& state) {
+  Arduino_GC9A01 gfx(nullptr);
+  TouchPanel touch(0, 0, 0, 0);
+  LightController light(&gfx, &touch, nullptr);
+  light.updateScreen();        // First frame draws everything
+
+  gfx.resetPixelsWritten();
+  for (auto _ : state) {
+    hostAdvanceMillis(5);
+    light.updateScreen();
+  }
+  state.counters["pixels"] = benchmark::Counter((double)gfx.getPixelsWritten() / state.iterations());
+}
+BENCHMARK(BM_LightIdleFrame);
+
+// One knob detent per frame, sweeping the water level up and down
+static void BM_LightLevelStep(benchmark::State& state) {
+  Arduino_GC9A01 gfx(nullptr);
+  TouchPanel touch(0, 0, 0, 0);
+  LightController light(&gfx, &touch, nullptr);
+  light.updateScreen();
+
+  int level = 50;
+  int direction = 1;
+  gfx.resetPixelsWritten();
+  for (auto _ : state) {
+    level += direction;
+    if (level >= 100 || level <= 0) direction = -direction;
+    light.setSetpoint(level);
+    hostAdvanceMillis(10);
+    light.updateScreen();
+  }
+  state.counters["pixels"] = benchmark::Counter((double)gfx.getPixelsWritten() / state.iterations());
+}
+BENCHMARK(BM_LightLevelStep);
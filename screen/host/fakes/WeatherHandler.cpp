@@ -0,0 +1,54 @@
+#include "WeatherHandler.h"
+
+// Host replacement for WeatherHandler.cpp - there is no HTTP/JSON stack on the
+// host, so the weather stays at its initial values and updates report failure
+
+WeatherHandler::WeatherHandler(InternetHandler* internet,
+                               const String& apiKey,
+                               const String& city,
+                               const String& countryCode)
+  : internetHandler(internet),
+    apiKey(apiKey),
+    city(city),
+    countryCode(countryCode) {
+  configValid = (apiKey.length() > 0 && city.length() > 0 && countryCode.length() > 0);
+}
+
+bool WeatherHandler::updateWeather() {
+  return false;
+}
+
+String WeatherHandler::getWeatherTemperature() const {
+  return weatherTemp;
+}
+
+bool WeatherHandler::getTemperature(float& value) const {
+  value = temperature;
+  return temperatureValid;
+}
+
+int WeatherHandler::getHumidity() const {
+  return humidity;
+}
+
+float WeatherHandler::getWindSpeed() const {
+  return windSpeed;
+}
+
+String WeatherHandler::getCondition() const {
+  return condition;
+}
+
+void WeatherHandler::setLocation(const String& newCity, const String& newCountryCode) {
+  city = newCity;
+  countryCode = newCountryCode;
+  configValid = (apiKey.length() > 0 && city.length() > 0 && countryCode.length() > 0);
+}
+
+void WeatherHandler::setApiKey(const String& newApiKey) {
+  apiKey = newApiKey;
+  configValid = (apiKey.length() > 0 && city.length() > 0 && countryCode.length() > 0);
+}
+
+void WeatherHandler::update() {
+}
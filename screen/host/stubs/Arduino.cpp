@@ -0,0 +1,430 @@
+#include "Arduino.h"
+#include "esp_timer.h"
+#include "esp_sleep.h"
+#include "esp_sntp.h"
+#include "driver/rtc_io.h"
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+#include <malloc.h>
+
+HardwareSerial Serial;
+EspClass ESP;
+
+// ---------------------------------------------------------------------------
+// Time
+// ---------------------------------------------------------------------------
+
+static const std::chrono::steady_clock::time_point processStart = std::chrono::steady_clock::now();
+static std::atomic<uint64_t> advancedMicros(0);
+static std::atomic<bool> clockSimulated(false);
+static uint64_t simulatedBase = 0;             // Wall clock when simulation started
+
+static uint64_t hostMicros() {
+  if (clockSimulated.load(std::memory_order_relaxed)) {
+    return simulatedBase + advancedMicros.load();
+  }
+  auto elapsed = std::chrono::steady_clock::now() - processStart;
+  return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() + advancedMicros.load();
+}
+
+unsigned long millis() {
+  return (unsigned long)(hostMicros() / 1000);
+}
+
+unsigned long micros() {
+  return (unsigned long)hostMicros();
+}
+
+int64_t esp_timer_get_time() {
+  return (int64_t)hostMicros();
+}
+
+void delay(uint32_t ms) {
+  if (clockSimulated.load(std::memory_order_relaxed)) {
+    hostAdvanceMillis(ms);
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(uint32_t us) {
+  if (clockSimulated.load(std::memory_order_relaxed)) {
+    advancedMicros += us;
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void yield() {
+  std::this_thread::yield();
+}
+
+void hostAdvanceMillis(unsigned long ms) {
+  advancedMicros += (uint64_t)ms * 1000;
+}
+
+void hostUseSimulatedClock() {
+  if (clockSimulated) return;
+  // Carry on from the current time, so the clock never steps back
+  auto elapsed = std::chrono::steady_clock::now() - processStart;
+  simulatedBase = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+  clockSimulated = true;
+}
+
+bool hostIsClockSimulated() {
+  return clockSimulated;
+}
+
+// As in the ESP32 core: the offset becomes a POSIX TZ string, so localtime_r
+// in the firmware applies it
+void configTime(long gmtOffsetSec, int daylightOffsetSec, const char* server1, const char* server2,
+                const char* server3) {
+  (void)server1;
+  (void)server2;
+  (void)server3;
+  long offset = gmtOffsetSec + daylightOffsetSec;
+  char tz[24];
+  snprintf(tz, sizeof(tz), "UTC%c%02ld:%02ld", offset > 0 ? '-' : '+', labs(offset) / 3600,
+           (labs(offset) % 3600) / 60);
+  setenv("TZ", tz, 1);
+  tzset();
+}
+
+bool getLocalTime(struct tm* info, uint32_t timeoutMs) {
+  (void)timeoutMs;
+  time_t now = time(nullptr);
+  localtime_r(&now, info);
+  return true;
+}
+
+void sntp_restart() {}
+
+sntp_sync_status_t sntp_get_sync_status() {
+  return SNTP_SYNC_STATUS_COMPLETED;
+}
+
+// ---------------------------------------------------------------------------
+// Math helpers
+// ---------------------------------------------------------------------------
+
+static std::mt19937 randomEngine(0);
+
+long random(long max) {
+  return max > 0 ? random(0, max) : 0;
+}
+
+long random(long min, long max) {
+  if (min >= max) return min;
+  return min + (long)(randomEngine() % (unsigned long)(max - min));
+}
+
+void randomSeed(unsigned long seed) {
+  randomEngine.seed(seed);
+}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  if (inMax == inMin) return outMin;
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// ---------------------------------------------------------------------------
+// GPIO, CPU and heap
+// ---------------------------------------------------------------------------
+
+void pinMode(uint8_t pin, uint8_t mode) { (void)pin; (void)mode; }
+void digitalWrite(uint8_t pin, uint8_t value) { (void)pin; (void)value; }
+int digitalRead(uint8_t pin) { (void)pin; return HIGH; }
+void analogWrite(uint8_t pin, int value) { (void)pin; (void)value; }
+int analogRead(uint8_t pin) { (void)pin; return 0; }
+void attachInterrupt(uint8_t pin, void (*handler)(), int mode) { (void)pin; (void)handler; (void)mode; }
+void detachInterrupt(uint8_t pin) { (void)pin; }
+
+esp_err_t gpio_wakeup_enable(gpio_num_t pin, gpio_int_type_t type) { (void)pin; (void)type; return ESP_OK; }
+esp_err_t gpio_wakeup_disable(gpio_num_t pin) { (void)pin; return ESP_OK; }
+esp_err_t gpio_set_intr_type(gpio_num_t pin, gpio_int_type_t type) { (void)pin; (void)type; return ESP_OK; }
+esp_err_t rtc_gpio_init(gpio_num_t pin) { (void)pin; return ESP_OK; }
+esp_err_t rtc_gpio_set_direction(gpio_num_t pin, rtc_gpio_mode_t mode) { (void)pin; (void)mode; return ESP_OK; }
+esp_err_t rtc_gpio_deinit(gpio_num_t pin) { (void)pin; return ESP_OK; }
+esp_err_t rtc_gpio_pullup_en(gpio_num_t pin) { (void)pin; return ESP_OK; }
+esp_err_t rtc_gpio_pulldown_dis(gpio_num_t pin) { (void)pin; return ESP_OK; }
+
+static std::atomic<uint32_t> cpuFrequencyMhz(240);
+
+uint32_t getCpuFrequencyMhz() {
+  return cpuFrequencyMhz;
+}
+
+bool setCpuFrequencyMhz(uint32_t mhz) {
+  cpuFrequencyMhz = mhz;
+  return true;
+}
+
+bool psramFound() {
+  return false;
+}
+
+// The device has ~320 KB of heap; report host usage against that size
+#define HOST_HEAP_SIZE (320 * 1024)
+
+static uint32_t minFreeHeap = HOST_HEAP_SIZE;
+
+uint32_t esp_get_free_heap_size() {
+  struct mallinfo2 info = mallinfo2();
+  uint32_t used = (uint32_t)min<size_t>(info.uordblks, HOST_HEAP_SIZE);
+  uint32_t freeHeap = HOST_HEAP_SIZE - used;
+  if (freeHeap < minFreeHeap) minFreeHeap = freeHeap;
+  return freeHeap;
+}
+
+uint32_t esp_get_minimum_free_heap_size() {
+  esp_get_free_heap_size();
+  return minFreeHeap;
+}
+
+// ESP-IDF heap hooks (CONFIG_HEAP_USE_HOOKS): the host build replaces the C
+// allocator entry points so every allocation reaches the same hooks as on the
+// device. The firmware's definitions override these empty ones.
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+
+__attribute__((weak)) void esp_heap_trace_alloc_hook(void* ptr, size_t size, uint32_t caps) {}
+__attribute__((weak)) void esp_heap_trace_free_hook(void* ptr) {}
+
+void* malloc(size_t size) {
+  void* ptr = __libc_malloc(size);
+  if (ptr) esp_heap_trace_alloc_hook(ptr, size, 0);
+  return ptr;
+}
+
+void* calloc(size_t count, size_t size) {
+  void* ptr = __libc_calloc(count, size);
+  if (ptr) esp_heap_trace_alloc_hook(ptr, count * size, 0);
+  return ptr;
+}
+
+void* realloc(void* ptr, size_t size) {
+  // A move counts as an allocation, like in heap_caps_realloc
+  void* moved = __libc_realloc(ptr, size);
+  if (moved && moved != ptr) {
+    if (ptr) esp_heap_trace_free_hook(ptr);
+    esp_heap_trace_alloc_hook(moved, size, 0);
+  }
+  return moved;
+}
+
+void free(void* ptr) {
+  if (ptr) esp_heap_trace_free_hook(ptr);
+  __libc_free(ptr);
+}
+}
+
+uint32_t EspClass::getFreeHeap() { return esp_get_free_heap_size(); }
+uint32_t EspClass::getMinFreeHeap() { return esp_get_minimum_free_heap_size(); }
+uint32_t EspClass::getHeapSize() { return HOST_HEAP_SIZE; }
+uint32_t EspClass::getMaxAllocHeap() { return esp_get_free_heap_size(); }
+uint32_t EspClass::getPsramSize() { return 0; }
+uint32_t EspClass::getFreePsram() { return 0; }
+const char* EspClass::getChipModel() { return "Host"; }
+void EspClass::restart() { esp_restart(); }
+
+// ---------------------------------------------------------------------------
+// System, restart and sleep
+// ---------------------------------------------------------------------------
+
+static std::vector<shutdown_handler_t> shutdownHandlers;
+
+const char* esp_err_to_name(esp_err_t code) {
+  switch (code) {
+    case ESP_OK: return "ESP_OK";
+    case ESP_FAIL: return "ESP_FAIL";
+    case ESP_ERR_NO_MEM: return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG: return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_NOT_SUPPORTED: return "ESP_ERR_NOT_SUPPORTED";
+    default: return "UNKNOWN ERROR";
+  }
+}
+
+esp_err_t esp_register_shutdown_handler(shutdown_handler_t handler) {
+  for (shutdown_handler_t registered : shutdownHandlers) {
+    if (registered == handler) return ESP_ERR_INVALID_STATE;
+  }
+  shutdownHandlers.push_back(handler);
+  return ESP_OK;
+}
+
+esp_err_t esp_unregister_shutdown_handler(shutdown_handler_t handler) {
+  for (size_t i = 0; i < shutdownHandlers.size(); i++) {
+    if (shutdownHandlers[i] == handler) {
+      shutdownHandlers.erase(shutdownHandlers.begin() + i);
+      return ESP_OK;
+    }
+  }
+  return ESP_ERR_INVALID_STATE;
+}
+
+void esp_restart() {
+  for (shutdown_handler_t handler : shutdownHandlers) {
+    handler();
+  }
+  throw HostRestart();
+}
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() {
+  return ESP_SLEEP_WAKEUP_UNDEFINED;
+}
+
+esp_err_t esp_sleep_enable_ext1_wakeup(uint64_t mask, esp_sleep_ext1_wakeup_mode_t mode) {
+  (void)mask;
+  (void)mode;
+  return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_gpio_wakeup() {
+  return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t timeUs) {
+  (void)timeUs;
+  return ESP_OK;
+}
+
+void esp_deep_sleep_start() {
+  // Deep sleep ends in a reset on the device
+  esp_restart();
+}
+
+// ---------------------------------------------------------------------------
+// Print / Stream
+// ---------------------------------------------------------------------------
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+  size_t written = 0;
+  while (size--) {
+    if (!write(*buffer++)) break;
+    written++;
+  }
+  return written;
+}
+
+size_t Print::printf(const char* format, ...) {
+  char local[128];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(local, sizeof(local), format, args);
+  va_end(args);
+  if (length < 0) return 0;
+  if ((size_t)length < sizeof(local)) return write(local, length);
+
+  std::vector<char> buffer(length + 1);
+  va_start(args, format);
+  vsnprintf(buffer.data(), buffer.size(), format, args);
+  va_end(args);
+  return write(buffer.data(), length);
+}
+
+String Stream::readString() {
+  String result;
+  int c;
+  while ((c = read()) >= 0) result += (char)c;
+  return result;
+}
+
+String Stream::readStringUntil(char terminator) {
+  String result;
+  int c;
+  while ((c = read()) >= 0 && c != terminator) result += (char)c;
+  return result;
+}
+
+// ---------------------------------------------------------------------------
+// Serial
+// ---------------------------------------------------------------------------
+
+HardwareSerial::HardwareSerial() {
+  const char* setting = getenv("QNOB_HOST_SERIAL");
+  echo = setting && setting[0] == '1';
+}
+
+void HardwareSerial::begin(unsigned long baud, uint32_t config, int8_t rxPin, int8_t txPin) {
+  (void)baud;
+  (void)config;
+  (void)rxPin;
+  (void)txPin;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  if (echo) fputc(c, stdout);
+  return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+  if (echo) fwrite(buffer, 1, size, stdout);
+  return size;
+}
+
+int HardwareSerial::available() {
+  std::lock_guard<std::mutex> lock(inputMutex);
+  return (int)input.size();
+}
+
+int HardwareSerial::read() {
+  std::lock_guard<std::mutex> lock(inputMutex);
+  if (input.empty()) return -1;
+  uint8_t c = input.front();
+  input.pop_front();
+  return c;
+}
+
+int HardwareSerial::peek() {
+  std::lock_guard<std::mutex> lock(inputMutex);
+  return input.empty() ? -1 : input.front();
+}
+
+void HardwareSerial::inject(const char* text) {
+  std::lock_guard<std::mutex> lock(inputMutex);
+  while (text && *text) input.push_back((uint8_t)*text++);
+}
+
+// ---------------------------------------------------------------------------
+// IPAddress
+// ---------------------------------------------------------------------------
+
+const IPAddress INADDR_NONE(0, 0, 0, 0);
+
+bool IPAddress::fromString(const char* text) {
+  uint8_t parts[4] = { 0, 0, 0, 0 };
+  int part = 0;
+  int value = -1;
+
+  for (const char* p = text; ; p++) {
+    if (*p >= '0' && *p <= '9') {
+      value = (value < 0 ? 0 : value * 10) + (*p - '0');
+      if (value > 255) return false;
+    } else if (*p == '.' || *p == 0) {
+      if (value < 0 || part > 3) return false;
+      parts[part++] = (uint8_t)value;
+      value = -1;
+      if (*p == 0) break;
+    } else {
+      return false;
+    }
+  }
+  if (part != 4) return false;
+
+  for (int i = 0; i < 4; i++) address.bytes[i] = parts[i];
+  return true;
+}
+
+String IPAddress::toString() const {
+  char buffer[16];
+  snprintf(buffer, sizeof(buffer), "%u.%u.%u.%u", address.bytes[0], address.bytes[1], address.bytes[2],
+           address.bytes[3]);
+  return String(buffer);
+}
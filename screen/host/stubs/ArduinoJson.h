@@ -0,0 +1,6 @@
+#ifndef HOST_ARDUINO_JSON_H
+#define HOST_ARDUINO_JSON_H
+
+// Not available on the host - WeatherHandler.cpp is replaced by a fake
+
+#endif // HOST_ARDUINO_JSON_H
@@ -0,0 +1,28 @@
+#ifndef HOST_ARDUINO_OTA_H
+#define HOST_ARDUINO_OTA_H
+
+#include "Arduino.h"
+#include <functional>
+
+#define U_FLASH 0
+#define U_SPIFFS 100
+
+typedef enum { OTA_AUTH_ERROR, OTA_BEGIN_ERROR, OTA_CONNECT_ERROR, OTA_RECEIVE_ERROR, OTA_END_ERROR } ota_error_t;
+
+// OTA updates are not available on the host
+class ArduinoOTAClass {
+public:
+  ArduinoOTAClass& setHostname(const char* hostname) { (void)hostname; return *this; }
+  ArduinoOTAClass& setPassword(const char* password) { (void)password; return *this; }
+  ArduinoOTAClass& onStart(std::function<void()> handler) { (void)handler; return *this; }
+  ArduinoOTAClass& onEnd(std::function<void()> handler) { (void)handler; return *this; }
+  ArduinoOTAClass& onProgress(std::function<void(unsigned int, unsigned int)> handler) { (void)handler; return *this; }
+  ArduinoOTAClass& onError(std::function<void(ota_error_t)> handler) { (void)handler; return *this; }
+  void begin() {}
+  void handle() {}
+  int getCommand() { return 0; }
+};
+
+extern ArduinoOTAClass ArduinoOTA;
+
+#endif // HOST_ARDUINO_OTA_H
@@ -0,0 +1,514 @@
+#include "Arduino_GFX_Library.h"
+
+#define DEGTORAD 0.017453292519943295769236907684886f
+
+static inline void swapInt16(int16_t& a, int16_t& b) {
+  int16_t t = a;
+  a = b;
+  b = t;
+}
+
+Arduino_DataBus* create_default_Arduino_DataBus() {
+  return new Arduino_DataBus();
+}
+
+Arduino_GFX::Arduino_GFX(int16_t w, int16_t h)
+  : _width(w), _height(h), framebuffer(new uint16_t[w * h]()), cursorX(0), cursorY(0),
+    textSizeX(1), textSizeY(1), textColor(WHITE), textBgColor(WHITE), wrap(true), pixelsWritten(0) {}
+
+Arduino_GFX::~Arduino_GFX() {
+  delete[] framebuffer;
+}
+
+bool Arduino_GFX::begin(int32_t speed) {
+  (void)speed;
+  return true;
+}
+
+uint16_t Arduino_GFX::getPixel(int16_t x, int16_t y) const {
+  if (x < 0 || y < 0 || x >= _width || y >= _height) return 0;
+  return framebuffer[y * _width + x];
+}
+
+void Arduino_GFX::writePixel(int16_t x, int16_t y, uint16_t color) {
+  if (x < 0 || y < 0 || x >= _width || y >= _height) return;
+  framebuffer[y * _width + x] = color;
+  pixelsWritten++;
+}
+
+void Arduino_GFX::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  if (w < 0) {
+    x += w + 1;
+    w = -w;
+  }
+  if (y < 0 || y >= _height || x >= _width || x + w <= 0) return;
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (x + w > _width) w = _width - x;
+  writeFillRectPreclipped(x, y, w, 1, color);
+}
+
+void Arduino_GFX::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  if (h < 0) {
+    y += h + 1;
+    h = -h;
+  }
+  if (x < 0 || x >= _width || y >= _height || y + h <= 0) return;
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (y + h > _height) h = _height - y;
+  writeFillRectPreclipped(x, y, 1, h, color);
+}
+
+void Arduino_GFX::writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  for (int16_t j = 0; j < h; j++) {
+    uint16_t* row = framebuffer + (y + j) * _width + x;
+    for (int16_t i = 0; i < w; i++) row[i] = color;
+  }
+  pixelsWritten += (uint64_t)w * h;
+}
+
+void Arduino_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  if (y0 == y1) {
+    writeFastHLine(min(x0, x1), y0, abs(x1 - x0) + 1, color);
+    return;
+  }
+  if (x0 == x1) {
+    writeFastVLine(x0, min(y0, y1), abs(y1 - y0) + 1, color);
+    return;
+  }
+
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) {
+    swapInt16(x0, y0);
+    swapInt16(x1, y1);
+  }
+  if (x0 > x1) {
+    swapInt16(x0, x1);
+    swapInt16(y0, y1);
+  }
+
+  int16_t dx = x1 - x0;
+  int16_t dy = abs(y1 - y0);
+  int16_t err = dx / 2;
+  int16_t ystep = y0 < y1 ? 1 : -1;
+
+  for (; x0 <= x1; x0++) {
+    if (steep) {
+      writePixel(y0, x0, color);
+    } else {
+      writePixel(x0, y0, color);
+    }
+    err -= dy;
+    if (err < 0) {
+      y0 += ystep;
+      err += dx;
+    }
+  }
+}
+
+void Arduino_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (w < 0) {
+    x += w + 1;
+    w = -w;
+  }
+  int16_t right = min((int16_t)(x + w), _width);
+  int16_t bottom = min((int16_t)(y + h), _height);
+  x = max(x, (int16_t)0);
+  y = max(y, (int16_t)0);
+  if (x >= right || y >= bottom) return;
+  writeFillRectPreclipped(x, y, right - x, bottom - y, color);
+}
+
+void Arduino_GFX::draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h) {
+  for (int16_t j = 0; j < h; j++) {
+    for (int16_t i = 0; i < w; i++) {
+      writePixel(x + i, y + j, bitmap[j * w + i]);
+    }
+  }
+}
+
+void Arduino_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  writeFastHLine(x, y, w, color);
+  writeFastHLine(x, y + h - 1, w, color);
+  writeFastVLine(x, y, h, color);
+  writeFastVLine(x + w - 1, y, h, color);
+}
+
+void Arduino_GFX::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+  int16_t maxRadius = min(w, h) / 2;
+  if (r > maxRadius) r = maxRadius;
+  writeFastHLine(x + r, y, w - 2 * r, color);
+  writeFastHLine(x + r, y + h - 1, w - 2 * r, color);
+  writeFastVLine(x, y + r, h - 2 * r, color);
+  writeFastVLine(x + w - 1, y + r, h - 2 * r, color);
+  circleHelper(x + r, y + r, r, 1, color);
+  circleHelper(x + w - r - 1, y + r, r, 2, color);
+  circleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+  circleHelper(x + r, y + h - r - 1, r, 8, color);
+}
+
+void Arduino_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+  int16_t maxRadius = min(w, h) / 2;
+  if (r > maxRadius) r = maxRadius;
+  fillRect(x + r, y, w - 2 * r, h, color);
+  fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
+  fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, color);
+}
+
+void Arduino_GFX::circleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, uint16_t color) {
+  int16_t f = 1 - r;
+  int16_t ddF_x = 1;
+  int16_t ddF_y = -2 * r;
+  int16_t x = 0;
+  int16_t y = r;
+
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    if (corners & 4) {
+      writePixel(x0 + x, y0 + y, color);
+      writePixel(x0 + y, y0 + x, color);
+    }
+    if (corners & 2) {
+      writePixel(x0 + x, y0 - y, color);
+      writePixel(x0 + y, y0 - x, color);
+    }
+    if (corners & 8) {
+      writePixel(x0 - y, y0 + x, color);
+      writePixel(x0 - x, y0 + y, color);
+    }
+    if (corners & 1) {
+      writePixel(x0 - y, y0 - x, color);
+      writePixel(x0 - x, y0 - y, color);
+    }
+  }
+}
+
+void Arduino_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color) {
+  int16_t f = 1 - r;
+  int16_t ddF_x = 1;
+  int16_t ddF_y = -2 * r;
+  int16_t x = 0;
+  int16_t y = r;
+  int16_t px = x;
+  int16_t py = y;
+
+  delta++;  // Avoid some +1's in the loop
+
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    // These checks avoid double-drawing certain lines
+    if (x < (y + 1)) {
+      if (corners & 1) writeFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+      if (corners & 2) writeFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+    }
+    if (y != py) {
+      if (corners & 1) writeFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+      if (corners & 2) writeFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+      py = y;
+    }
+    px = x;
+  }
+}
+
+void Arduino_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+  writePixel(x0, y0 + r, color);
+  writePixel(x0, y0 - r, color);
+  writePixel(x0 + r, y0, color);
+  writePixel(x0 - r, y0, color);
+  circleHelper(x0, y0, r, 0xF, color);
+}
+
+void Arduino_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+  writeFastVLine(x0, y0 - r, 2 * r + 1, color);
+  fillCircleHelper(x0, y0, r, 3, 0, color);
+}
+
+void Arduino_GFX::drawEllipse(int16_t x, int16_t y, int16_t rx, int16_t ry, uint16_t color) {
+  if (rx < 2 || ry < 2) return;
+  int32_t rx2 = rx * rx;
+  int32_t ry2 = ry * ry;
+  int32_t fx2 = 4 * rx2;
+  int32_t fy2 = 4 * ry2;
+  int32_t s;
+  int16_t xi, yi;
+
+  for (xi = 0, yi = ry, s = 2 * ry2 + rx2 * (1 - 2 * ry); ry2 * xi <= rx2 * yi; xi++) {
+    writePixel(x + xi, y + yi, color);
+    writePixel(x - xi, y + yi, color);
+    writePixel(x - xi, y - yi, color);
+    writePixel(x + xi, y - yi, color);
+    if (s >= 0) {
+      s += fx2 * (1 - yi);
+      yi--;
+    }
+    s += ry2 * ((4 * xi) + 6);
+  }
+
+  for (xi = rx, yi = 0, s = 2 * rx2 + ry2 * (1 - 2 * rx); rx2 * yi <= ry2 * xi; yi++) {
+    writePixel(x + xi, y + yi, color);
+    writePixel(x - xi, y + yi, color);
+    writePixel(x - xi, y - yi, color);
+    writePixel(x + xi, y - yi, color);
+    if (s >= 0) {
+      s += fy2 * (1 - xi);
+      xi--;
+    }
+    s += rx2 * ((4 * yi) + 6);
+  }
+}
+
+void Arduino_GFX::fillEllipse(int16_t x, int16_t y, int16_t rx, int16_t ry, uint16_t color) {
+  if (rx < 2 || ry < 2) return;
+  int32_t rx2 = rx * rx;
+  int32_t ry2 = ry * ry;
+  int32_t fx2 = 4 * rx2;
+  int32_t fy2 = 4 * ry2;
+  int32_t s;
+  int16_t xi, yi;
+
+  for (xi = 0, yi = ry, s = 2 * ry2 + rx2 * (1 - 2 * ry); ry2 * xi <= rx2 * yi; xi++) {
+    writeFastHLine(x - xi, y - yi, xi * 2 + 1, color);
+    writeFastHLine(x - xi, y + yi, xi * 2 + 1, color);
+    if (s >= 0) {
+      s += fx2 * (1 - yi);
+      yi--;
+    }
+    s += ry2 * ((4 * xi) + 6);
+  }
+
+  for (xi = rx, yi = 0, s = 2 * rx2 + ry2 * (1 - 2 * rx); rx2 * yi <= ry2 * xi; yi++) {
+    writeFastHLine(x - xi, y - yi, xi * 2 + 1, color);
+    writeFastHLine(x - xi, y + yi, xi * 2 + 1, color);
+    if (s >= 0) {
+      s += fy2 * (1 - xi);
+      xi--;
+    }
+    s += rx2 * ((4 * yi) + 6);
+  }
+}
+
+void Arduino_GFX::drawArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float start, float end, uint16_t color) {
+  if (r1 < r2) swapInt16(r1, r2);
+  if (r1 < 1) r1 = 1;
+  if (r2 < 1) r2 = 1;
+  bool equal = fabsf(start - end) < 0.0001f;
+  start = fmodf(start, 360);
+  end = fmodf(end, 360);
+  if (start < 0) start += 360;
+  if (end < 0) end += 360;
+
+  // Outline of the ring segment: both edges, plus the two radial caps
+  for (int16_t r = r2; r <= r1; r += (r1 - r2 > 0 ? r1 - r2 : 1)) {
+    float step = 1.0f / r * 57.29578f;
+    float span = equal ? 360 : (end >= start ? end - start : end + 360 - start);
+    for (float a = 0; a <= span; a += step) {
+      float rad = (start + a) * DEGTORAD;
+      writePixel(x + lroundf(cosf(rad) * r), y + lroundf(sinf(rad) * r), color);
+    }
+    if (r1 == r2) break;
+  }
+  if (!equal) {
+    drawLine(x + lroundf(cosf(start * DEGTORAD) * r2), y + lroundf(sinf(start * DEGTORAD) * r2),
+             x + lroundf(cosf(start * DEGTORAD) * r1), y + lroundf(sinf(start * DEGTORAD) * r1), color);
+    drawLine(x + lroundf(cosf(end * DEGTORAD) * r2), y + lroundf(sinf(end * DEGTORAD) * r2),
+             x + lroundf(cosf(end * DEGTORAD) * r1), y + lroundf(sinf(end * DEGTORAD) * r1), color);
+  }
+}
+
+void Arduino_GFX::fillArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float start, float end, uint16_t color) {
+  if (r1 < r2) swapInt16(r1, r2);
+  if (r1 < 1) r1 = 1;
+  if (r2 < 1) r2 = 1;
+  bool equal = fabsf(start - end) < 0.0001f;
+  start = fmodf(start, 360);
+  end = fmodf(end, 360);
+  if (start < 0) start += 360;
+  if (end < 0) end += 360;
+
+  if (equal) {
+    fillArcHelper(x, y, r1, r2, 0, 180, color);
+    fillArcHelper(x, y, r1, r2, 180, 360, color);
+  } else if (start > end) {
+    fillArcHelper(x, y, r1, r2, start, 360, color);
+    fillArcHelper(x, y, r1, r2, 0, end, color);
+  } else {
+    fillArcHelper(x, y, r1, r2, start, end, color);
+  }
+}
+
+// Scanline fill of a ring segment, as in Arduino_GFX::writeFillArcHelper -
+// each row is walked once and runs inside both radii and both edge
+// half-planes are emitted as horizontal lines
+void Arduino_GFX::fillArcHelper(int16_t cx, int16_t cy, int16_t oradius, int16_t iradius, float start, float end,
+                                uint16_t color) {
+  if (start == 90 || start == 180 || start == 270 || start == 360) start -= 0.1f;
+  if (end == 90 || end == 180 || end == 270 || end == 360) end -= 0.1f;
+
+  float s_cos = cosf(start * DEGTORAD);
+  float e_cos = cosf(end * DEGTORAD);
+  float sslope = s_cos / sinf(start * DEGTORAD);
+  float eslope = e_cos / sinf(end * DEGTORAD);
+  float swidth = 0.5f / s_cos;
+  float ewidth = -0.5f / e_cos;
+  --iradius;
+  int32_t ir2 = iradius * iradius + iradius;
+  int32_t or2 = oradius * oradius + oradius;
+
+  bool start180 = !(start < 180);
+  bool end180 = end < 180;
+  bool reversed = start + 180 < end || (end < start && start < end + 180);
+
+  int32_t xs = -oradius;
+  int32_t y = -oradius;
+  int32_t ye = oradius;
+  int32_t xe = oradius + 1;
+  if (!reversed) {
+    if ((end >= 270 || end < 90) && (start >= 270 || start < 90)) {
+      xs = 0;
+    } else if (end < 270 && end >= 90 && start < 270 && start >= 90) {
+      xe = 1;
+    }
+    if (end >= 180 && start >= 180) {
+      ye = 0;
+    } else if (end < 180 && start < 180) {
+      y = 0;
+    }
+  }
+
+  do {
+    int32_t y2 = y * y;
+    int32_t x = xs;
+    if (x < 0) {
+      while (x * x + y2 >= or2) ++x;
+      if (xe != 1) xe = 1 - x;
+    }
+    float ysslope = (y + swidth) * sslope;
+    float yeslope = (y + ewidth) * eslope;
+    int32_t len = 0;
+    do {
+      bool flg1 = start180 != (x <= ysslope);
+      bool flg2 = end180 != (x <= yeslope);
+      int32_t distance = x * x + y2;
+      if (distance >= ir2 && ((flg1 && flg2) || (reversed && (flg1 || flg2))) && x != xe && distance < or2) {
+        ++len;
+      } else {
+        if (len) {
+          writeFastHLine(cx + x - len, cy + y, len, color);
+          len = 0;
+        }
+        if (distance >= or2) break;
+        if (x < 0 && distance < ir2) x = -x;
+      }
+    } while (++x <= xe);
+  } while (++y <= ye);
+}
+
+void Arduino_GFX::drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+  drawLine(x0, y0, x1, y1, color);
+  drawLine(x1, y1, x2, y2, color);
+  drawLine(x2, y2, x0, y0, color);
+}
+
+void Arduino_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+  int16_t a, b, y, last;
+
+  // Sort coordinates by Y order (y2 >= y1 >= y0)
+  if (y0 > y1) {
+    swapInt16(y0, y1);
+    swapInt16(x0, x1);
+  }
+  if (y1 > y2) {
+    swapInt16(y2, y1);
+    swapInt16(x2, x1);
+  }
+  if (y0 > y1) {
+    swapInt16(y0, y1);
+    swapInt16(x0, x1);
+  }
+
+  if (y0 == y2) {  // All on the same line
+    a = b = x0;
+    if (x1 < a) a = x1;
+    else if (x1 > b) b = x1;
+    if (x2 < a) a = x2;
+    else if (x2 > b) b = x2;
+    writeFastHLine(a, y0, b - a + 1, color);
+    return;
+  }
+
+  int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0, dx12 = x2 - x1, dy12 = y2 - y1;
+  int32_t sa = 0, sb = 0;
+
+  last = y1 == y2 ? y1 : y1 - 1;
+
+  for (y = y0; y <= last; y++) {
+    a = x0 + sa / dy01;
+    b = x0 + sb / dy02;
+    sa += dx01;
+    sb += dx02;
+    if (a > b) swapInt16(a, b);
+    writeFastHLine(a, y, b - a + 1, color);
+  }
+
+  sa = (int32_t)dx12 * (y - y1);
+  sb = (int32_t)dx02 * (y - y0);
+  for (; y <= y2; y++) {
+    a = x1 + sa / dy12;
+    b = x0 + sb / dy02;
+    sa += dx12;
+    sb += dx02;
+    if (a > b) swapInt16(a, b);
+    writeFastHLine(a, y, b - a + 1, color);
+  }
+}
+
+void Arduino_GFX::getTextBounds(const char* text, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w,
+                                uint16_t* h) {
+  size_t length = text ? strlen(text) : 0;
+  *x1 = x;
+  *y1 = y;
+  *w = length * 6 * textSizeX;
+  *h = length ? 8 * textSizeY : 0;
+}
+
+size_t Arduino_GFX::write(uint8_t c) {
+  if (c == '\n') {
+    cursorX = 0;
+    cursorY += 8 * textSizeY;
+    return 1;
+  }
+  if (c == '\r') return 1;
+
+  if (wrap && cursorX + 6 * textSizeX > _width) {
+    cursorX = 0;
+    cursorY += 8 * textSizeY;
+  }
+  // Glyph cell: background if set, then a 5x7 body in the text color
+  if (textBgColor != textColor) {
+    fillRect(cursorX, cursorY, 6 * textSizeX, 8 * textSizeY, textBgColor);
+  }
+  if (c != ' ') {
+    fillRect(cursorX, cursorY, 5 * textSizeX, 7 * textSizeY, textColor);
+  }
+  cursorX += 6 * textSizeX;
+  return 1;
+}
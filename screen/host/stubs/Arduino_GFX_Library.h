@@ -0,0 +1,147 @@
+#ifndef HOST_ARDUINO_GFX_LIBRARY_H
+#define HOST_ARDUINO_GFX_LIBRARY_H
+
+#include "Arduino.h"
+
+#define GFX_NOT_DEFINED -1
+#define DF_GFX_RST 14
+#define DF_GFX_BL 2
+
+#define BLACK 0x0000
+#define NAVY 0x000F
+#define DARKGREEN 0x03E0
+#define DARKCYAN 0x03EF
+#define MAROON 0x7800
+#define PURPLE 0x780F
+#define OLIVE 0x7BE0
+#define LIGHTGREY 0xC618
+#define DARKGREY 0x7BEF
+#define BLUE 0x001F
+#define GREEN 0x07E0
+#define CYAN 0x07FF
+#define RED 0xF800
+#define MAGENTA 0xF81F
+#define YELLOW 0xFFE0
+#define WHITE 0xFFFF
+#define ORANGE 0xFD20
+#define GREENYELLOW 0xAFE5
+#define PINK 0xF81F
+
+class Arduino_DataBus {
+public:
+  virtual ~Arduino_DataBus() {}
+};
+
+Arduino_DataBus* create_default_Arduino_DataBus();
+
+/**
+ * Software renderer with the Arduino_GFX drawing API.
+ *
+ * Draws into an RGB565 framebuffer instead of a panel, with the library's own
+ * primitives (Bresenham lines, midpoint circles, the scanline fillArc helper),
+ * so drawing code costs on the host roughly what it costs in pixel writes on
+ * the device. Pixel writes are counted for benchmarks. As in the library, every
+ * rectangle and line fill ends in writeFillRectPreclipped, which panel
+ * subclasses can override. Glyphs are drawn as solid
+ * 5x7 blocks in a 6x8 cell since no font is bundled.
+ */
+class Arduino_GFX : public Print {
+protected:
+  int16_t _width;
+  int16_t _height;
+  uint16_t* framebuffer;
+  int16_t cursorX;
+  int16_t cursorY;
+  uint8_t textSizeX;
+  uint8_t textSizeY;
+  uint16_t textColor;
+  uint16_t textBgColor;
+  bool wrap;
+  uint64_t pixelsWritten;
+
+public:
+  Arduino_GFX(int16_t w, int16_t h);
+  virtual ~Arduino_GFX();
+
+  virtual bool begin(int32_t speed = GFX_NOT_DEFINED);
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+  void setRotation(uint8_t rotation) { (void)rotation; }
+  void invertDisplay(bool invert) { (void)invert; }
+  void displayOn() {}
+  void displayOff() {}
+  void startWrite() {}
+  void endWrite() {}
+
+  static uint16_t color565(uint8_t red, uint8_t green, uint8_t blue) {
+    return ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3);
+  }
+
+  // Pixels and lines
+  void writePixel(int16_t x, int16_t y, uint16_t color);
+  void drawPixel(int16_t x, int16_t y, uint16_t color) { writePixel(x, y, color); }
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { writeFastHLine(x, y, w, color); }
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { writeFastVLine(x, y, h, color); }
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+  virtual void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+  // Rectangles
+  void fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+  void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+
+  // Circles, ellipses and arcs
+  void drawCircle(int16_t x, int16_t y, int16_t r, uint16_t color);
+  void fillCircle(int16_t x, int16_t y, int16_t r, uint16_t color);
+  void drawEllipse(int16_t x, int16_t y, int16_t rx, int16_t ry, uint16_t color);
+  void fillEllipse(int16_t x, int16_t y, int16_t rx, int16_t ry, uint16_t color);
+  void drawArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float start, float end, uint16_t color);
+  void fillArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float start, float end, uint16_t color);
+
+  // Triangles
+  void drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+  void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+
+  // Bitmaps
+  void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h);
+
+  // Text
+  void setCursor(int16_t x, int16_t y) { cursorX = x; cursorY = y; }
+  int16_t getCursorX() const { return cursorX; }
+  int16_t getCursorY() const { return cursorY; }
+  void setTextSize(uint8_t size) { textSizeX = textSizeY = size > 0 ? size : 1; }
+  void setTextSize(uint8_t sx, uint8_t sy) { textSizeX = sx > 0 ? sx : 1; textSizeY = sy > 0 ? sy : 1; }
+  void setTextColor(uint16_t color) { textColor = textBgColor = color; }
+  void setTextColor(uint16_t color, uint16_t background) { textColor = color; textBgColor = background; }
+  void setTextWrap(bool enabled) { wrap = enabled; }
+  void getTextBounds(const char* text, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h);
+  void getTextBounds(const String& text, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+    getTextBounds(text.c_str(), x, y, x1, y1, w, h);
+  }
+  size_t write(uint8_t c) override;
+  using Print::write;
+
+  // Host helpers
+  const uint16_t* getFramebuffer() const { return framebuffer; }
+  uint16_t getPixel(int16_t x, int16_t y) const;
+  uint64_t getPixelsWritten() const { return pixelsWritten; }
+  void resetPixelsWritten() { pixelsWritten = 0; }
+
+private:
+  void fillArcHelper(int16_t cx, int16_t cy, int16_t oradius, int16_t iradius, float start, float end, uint16_t color);
+  void circleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, uint16_t color);
+  void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color);
+};
+
+class Arduino_GC9A01 : public Arduino_GFX {
+public:
+  Arduino_GC9A01(Arduino_DataBus* bus, int8_t rst = GFX_NOT_DEFINED, uint8_t rotation = 0, bool ips = false,
+                 int16_t w = 240, int16_t h = 240)
+      : Arduino_GFX(w, h) { (void)bus; (void)rst; (void)rotation; (void)ips; }
+};
+
+#endif // HOST_ARDUINO_GFX_LIBRARY_H
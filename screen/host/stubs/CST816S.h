@@ -0,0 +1,76 @@
+#ifndef HOST_CST816S_H
+#define HOST_CST816S_H
+
+#include "Arduino.h"
+#include <deque>
+#include <mutex>
+#include <vector>
+
+struct data_struct {
+  byte gestureID;
+  byte points;
+  byte event;
+  int x;
+  int y;
+  uint8_t version;
+  uint8_t versionInfo[3];
+};
+
+// Touch controller fed by injected touches instead of I2C
+class CST816S {
+private:
+  std::deque<data_struct> pending;
+  std::mutex pendingMutex;
+
+  // Live controllers, for hostInjectAll - the panel's is inside TouchPanel
+  static std::vector<CST816S*>& instances() {
+    static std::vector<CST816S*> controllers;
+    return controllers;
+  }
+
+public:
+  data_struct data;
+
+  CST816S(int sda, int scl, int rst, int irq) : data() {
+    (void)sda;
+    (void)scl;
+    (void)rst;
+    (void)irq;
+    instances().push_back(this);
+  }
+  ~CST816S() {
+    std::vector<CST816S*>& controllers = instances();
+    controllers.erase(std::find(controllers.begin(), controllers.end(), this));
+  }
+  CST816S(const CST816S&) = delete;
+  CST816S& operator=(const CST816S&) = delete;
+  void begin(int interrupt = RISING) { (void)interrupt; }
+  void sleep() {}
+  String gesture() { return "NONE"; }
+
+  bool available() {
+    std::lock_guard<std::mutex> lock(pendingMutex);
+    if (pending.empty()) return false;
+    data = pending.front();
+    pending.pop_front();
+    return true;
+  }
+
+  // Host helpers - queue one touch event at (x, y), or a full sample
+  void inject(int x, int y) {
+    data_struct touch = {};
+    touch.points = 1;
+    touch.x = x;
+    touch.y = y;
+    inject(touch);
+  }
+  void inject(const data_struct& touch) {
+    std::lock_guard<std::mutex> lock(pendingMutex);
+    pending.push_back(touch);
+  }
+  static void hostInjectAll(const data_struct& touch) {
+    for (CST816S* controller : instances()) controller->inject(touch);
+  }
+};
+
+#endif // HOST_CST816S_H
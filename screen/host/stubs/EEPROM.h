@@ -0,0 +1,47 @@
+#ifndef HOST_EEPROM_H
+#define HOST_EEPROM_H
+
+#include "Arduino.h"
+#include <vector>
+
+/**
+ * Flash-emulated EEPROM as in the ESP32 core: a RAM image that commit()
+ * writes back. The host "flash" is a second buffer, so commits cost a copy
+ * and can be counted, and a fresh begin() after restart reloads the last
+ * committed image.
+ */
+class EEPROMClass {
+private:
+  std::vector<uint8_t> data;
+  std::vector<uint8_t> flash;
+  uint32_t commitCount;
+
+public:
+  EEPROMClass() : commitCount(0) {}
+
+  bool begin(size_t size);
+  void end() {}
+  uint8_t read(int address) const { return address >= 0 && (size_t)address < data.size() ? data[address] : 0; }
+  void write(int address, uint8_t value) { if (address >= 0 && (size_t)address < data.size()) data[address] = value; }
+  bool commit();
+  uint8_t* getDataPtr() { return data.data(); }
+  size_t length() const { return data.size(); }
+
+  template <typename T> T& get(int address, T& value) {
+    if (address >= 0 && address + sizeof(T) <= data.size()) memcpy(&value, &data[address], sizeof(T));
+    return value;
+  }
+
+  template <typename T> const T& put(int address, const T& value) {
+    if (address >= 0 && address + sizeof(T) <= data.size()) memcpy(&data[address], &value, sizeof(T));
+    return value;
+  }
+
+  // Host helpers
+  uint32_t getCommitCount() const { return commitCount; }
+  void eraseFlash() { std::fill(flash.begin(), flash.end(), 0xFF); std::fill(data.begin(), data.end(), 0xFF); }
+};
+
+extern EEPROMClass EEPROM;
+
+#endif // HOST_EEPROM_H
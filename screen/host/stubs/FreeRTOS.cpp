@@ -0,0 +1,322 @@
+#include "Arduino.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <pthread.h>
+#include <thread>
+#include <time.h>
+#include <vector>
+
+struct HostTask {
+  TaskFunction_t function;
+  void* parameter;
+  char name[16];
+  UBaseType_t number;
+  UBaseType_t priority;
+  BaseType_t coreId;
+  pthread_t thread;
+  std::mutex notifyMutex;
+  std::condition_variable notified;
+  uint32_t notifyCount = 0;
+};
+
+// Thrown by vTaskDelete(NULL) to unwind the calling task's thread
+struct HostTaskExit {};
+
+static thread_local HostTask* currentTask = nullptr;
+static thread_local BaseType_t currentCore = 1;
+
+static const auto schedulerStart = std::chrono::steady_clock::now();
+
+// Live tasks, for uxTaskGetSystemState
+static std::mutex taskListMutex;
+static std::vector<HostTask*> taskList;
+static UBaseType_t nextTaskNumber = 1;
+
+// ---------------------------------------------------------------------------
+// Critical sections
+// ---------------------------------------------------------------------------
+
+void vPortEnterCritical(portMUX_TYPE* mux) {
+  while (__atomic_exchange_n(&mux->locked, 1, __ATOMIC_ACQUIRE)) {
+    std::this_thread::yield();
+  }
+}
+
+void vPortExitCritical(portMUX_TYPE* mux) {
+  __atomic_store_n(&mux->locked, 0, __ATOMIC_RELEASE);
+}
+
+BaseType_t xPortGetCoreID() {
+  return currentCore;
+}
+
+// ---------------------------------------------------------------------------
+// Tasks
+// ---------------------------------------------------------------------------
+
+static void runTask(HostTask* task) {
+  currentTask = task;
+  currentCore = task->coreId == tskNO_AFFINITY ? 0 : task->coreId;
+  try {
+    task->function(task->parameter);
+  } catch (const HostTaskExit&) {
+  }
+
+  std::lock_guard<std::mutex> lock(taskListMutex);
+  taskList.erase(std::find(taskList.begin(), taskList.end(), task));
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stackDepth,
+                                   void* parameter, UBaseType_t priority, TaskHandle_t* handle,
+                                   BaseType_t coreId) {
+  (void)stackDepth;
+  HostTask* task = new HostTask();
+  task->function = function;
+  task->parameter = parameter;
+  strncpy(task->name, name ? name : "", sizeof(task->name) - 1);
+  task->name[sizeof(task->name) - 1] = 0;
+  task->priority = priority;
+  task->coreId = coreId;
+  if (handle) *handle = task;
+
+  // Listed before the thread starts so it can't exit first
+  std::lock_guard<std::mutex> lock(taskListMutex);
+  task->number = nextTaskNumber++;
+  taskList.push_back(task);
+  std::thread thread(runTask, task);
+  task->thread = thread.native_handle();
+  thread.detach();
+  return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t function, const char* name, uint32_t stackDepth,
+                       void* parameter, UBaseType_t priority, TaskHandle_t* handle) {
+  return xTaskCreatePinnedToCore(function, name, stackDepth, parameter, priority, handle, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+  // Host threads can't be killed from outside; only self-deletion ends one
+  if (task == nullptr || task == currentTask) {
+    throw HostTaskExit();
+  }
+}
+
+void vTaskDelay(TickType_t ticks) {
+  if (hostIsClockSimulated()) {
+    hostAdvanceMillis(ticks * portTICK_PERIOD_MS);
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(ticks * portTICK_PERIOD_MS));
+}
+
+TickType_t xTaskGetTickCount() {
+  if (hostIsClockSimulated()) {
+    return (TickType_t)(millis() / portTICK_PERIOD_MS);
+  }
+  auto elapsed = std::chrono::steady_clock::now() - schedulerStart;
+  return (TickType_t)std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() / portTICK_PERIOD_MS;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+  (void)task;
+  return 4096;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+  return currentTask;
+}
+
+char* pcTaskGetName(TaskHandle_t task) {
+  static char mainName[] = "loopTask";
+  if (!task) task = currentTask;
+  return task ? task->name : mainName;
+}
+
+UBaseType_t uxTaskGetNumberOfTasks() {
+  std::lock_guard<std::mutex> lock(taskListMutex);
+  return taskList.size();
+}
+
+static uint32_t cpuTimeMicros(clockid_t clock) {
+  struct timespec now;
+  if (clock_gettime(clock, &now) != 0) return 0;
+  return (uint32_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+}
+
+UBaseType_t uxTaskGetSystemState(TaskStatus_t* statusArray, UBaseType_t arraySize, uint32_t* totalRunTime) {
+  std::lock_guard<std::mutex> lock(taskListMutex);
+  if (taskList.size() > arraySize) return 0;
+
+  UBaseType_t count = 0;
+  for (HostTask* task : taskList) {
+    TaskStatus_t& status = statusArray[count++];
+    clockid_t clock;
+    status.xHandle = task;
+    status.pcTaskName = task->name;
+    status.xTaskNumber = task->number;
+    status.eCurrentState = task == currentTask ? eRunning : eBlocked;
+    status.uxCurrentPriority = task->priority;
+    status.uxBasePriority = task->priority;
+    status.ulRunTimeCounter = pthread_getcpuclockid(task->thread, &clock) == 0 ? cpuTimeMicros(clock) : 0;
+    status.usStackHighWaterMark = uxTaskGetStackHighWaterMark(task);
+    status.xCoreID = task->coreId;
+  }
+  if (totalRunTime) {
+    auto elapsed = std::chrono::steady_clock::now() - schedulerStart;
+    *totalRunTime = (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+  }
+  return count;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  if (!task) return pdFAIL;
+  {
+    std::lock_guard<std::mutex> lock(task->notifyMutex);
+    task->notifyCount++;
+  }
+  task->notified.notify_one();
+  return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticks) {
+  HostTask* task = currentTask;
+  if (!task) {
+    // Not a task thread (e.g. the main thread) - nothing can notify it
+    if (ticks != portMAX_DELAY) vTaskDelay(ticks);
+    return 0;
+  }
+  std::unique_lock<std::mutex> lock(task->notifyMutex);
+  auto pending = [task] { return task->notifyCount > 0; };
+  if (ticks == portMAX_DELAY) {
+    task->notified.wait(lock, pending);
+  } else {
+    task->notified.wait_for(lock, std::chrono::milliseconds(ticks * portTICK_PERIOD_MS), pending);
+  }
+  uint32_t count = task->notifyCount;
+  if (clearCountOnExit) {
+    task->notifyCount = 0;
+  } else if (count > 0) {
+    task->notifyCount--;
+  }
+  return count;
+}
+
+// ---------------------------------------------------------------------------
+// Semaphores - a counting semaphore covers mutexes (starts at 1) and
+// binary semaphores (starts at 0), both with a maximum count of 1
+// ---------------------------------------------------------------------------
+
+struct HostSemaphore {
+  std::mutex mutex;
+  std::condition_variable available;
+  UBaseType_t count;
+  UBaseType_t maxCount;
+};
+
+static SemaphoreHandle_t createSemaphore(UBaseType_t initial, UBaseType_t maxCount) {
+  HostSemaphore* semaphore = new HostSemaphore();
+  semaphore->count = initial;
+  semaphore->maxCount = maxCount;
+  return semaphore;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+  return createSemaphore(1, 1);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+  return createSemaphore(0, 1);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore) {
+  delete semaphore;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks) {
+  if (!semaphore) return pdFALSE;
+  std::unique_lock<std::mutex> lock(semaphore->mutex);
+  auto ready = [semaphore] { return semaphore->count > 0; };
+  if (ticks == portMAX_DELAY) {
+    semaphore->available.wait(lock, ready);
+  } else if (!semaphore->available.wait_for(lock, std::chrono::milliseconds(ticks * portTICK_PERIOD_MS), ready)) {
+    return pdFALSE;
+  }
+  semaphore->count--;
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+  if (!semaphore) return pdFALSE;
+  {
+    std::lock_guard<std::mutex> lock(semaphore->mutex);
+    if (semaphore->count >= semaphore->maxCount) return pdFALSE;
+    semaphore->count++;
+  }
+  semaphore->available.notify_one();
+  return pdTRUE;
+}
+
+// ---------------------------------------------------------------------------
+// Event groups
+// ---------------------------------------------------------------------------
+
+struct HostEventGroup {
+  std::mutex mutex;
+  std::condition_variable changed;
+  EventBits_t bits = 0;
+};
+
+EventGroupHandle_t xEventGroupCreate() {
+  return new HostEventGroup();
+}
+
+void vEventGroupDelete(EventGroupHandle_t group) {
+  delete group;
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits) {
+  EventBits_t result;
+  {
+    std::lock_guard<std::mutex> lock(group->mutex);
+    group->bits |= bits;
+    result = group->bits;
+  }
+  group->changed.notify_all();
+  return result;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits) {
+  std::lock_guard<std::mutex> lock(group->mutex);
+  EventBits_t previous = group->bits;
+  group->bits &= ~bits;
+  return previous;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t group) {
+  std::lock_guard<std::mutex> lock(group->mutex);
+  return group->bits;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clearOnExit,
+                                BaseType_t waitForAll, TickType_t ticks) {
+  std::unique_lock<std::mutex> lock(group->mutex);
+  auto satisfied = [group, bits, waitForAll] {
+    return waitForAll ? (group->bits & bits) == bits : (group->bits & bits) != 0;
+  };
+  bool met;
+  if (ticks == portMAX_DELAY) {
+    group->changed.wait(lock, satisfied);
+    met = true;
+  } else {
+    met = group->changed.wait_for(lock, std::chrono::milliseconds(ticks * portTICK_PERIOD_MS), satisfied);
+  }
+  EventBits_t result = group->bits;
+  if (met && clearOnExit) group->bits &= ~bits;
+  return result;
+}
@@ -0,0 +1,19 @@
+#ifndef HOST_HTTP_CLIENT_H
+#define HOST_HTTP_CLIENT_H
+
+#include "Arduino.h"
+
+#define HTTP_CODE_OK 200
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+
+// No HTTP on the host - every request fails to connect
+class HTTPClient {
+public:
+  bool begin(const String& url) { (void)url; return true; }
+  void end() {}
+  void setTimeout(uint16_t timeoutMs) { (void)timeoutMs; }
+  int GET() { return HTTPC_ERROR_CONNECTION_REFUSED; }
+  String getString() { return String(); }
+};
+
+#endif // HOST_HTTP_CLIENT_H
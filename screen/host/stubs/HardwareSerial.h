@@ -0,0 +1,45 @@
+#ifndef HOST_HARDWARE_SERIAL_H
+#define HOST_HARDWARE_SERIAL_H
+
+#include <deque>
+#include <mutex>
+#include "Print.h"
+
+#define SERIAL_8N1 0x800001c
+
+/**
+ * Serial port on the host.
+ *
+ * Output is discarded unless echo is enabled (QNOB_HOST_SERIAL=1 in the
+ * environment, or setEcho), so benchmarks don't measure the terminal. Input
+ * can be injected to drive the serial command path.
+ */
+class HardwareSerial : public Stream {
+private:
+  std::deque<uint8_t> input;
+  std::mutex inputMutex;
+  bool echo;
+
+public:
+  HardwareSerial();
+
+  void begin(unsigned long baud, uint32_t config = SERIAL_8N1, int8_t rxPin = -1, int8_t txPin = -1);
+  void end() {}
+  operator bool() const { return true; }
+
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  using Print::write;
+
+  int available() override;
+  int read() override;
+  int peek() override;
+
+  // Host helpers
+  void setEcho(bool enabled) { echo = enabled; }
+  void inject(const char* text);
+};
+
+extern HardwareSerial Serial;
+
+#endif // HOST_HARDWARE_SERIAL_H
@@ -0,0 +1,35 @@
+#ifndef HOST_IP_ADDRESS_H
+#define HOST_IP_ADDRESS_H
+
+#include <cstdint>
+#include "WString.h"
+
+// IPv4 address stored in network order, as in the ESP32 core
+class IPAddress {
+private:
+  union {
+    uint8_t bytes[4];
+    uint32_t dword;
+  } address;
+
+public:
+  IPAddress() { address.dword = 0; }
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) {
+    address.bytes[0] = a; address.bytes[1] = b; address.bytes[2] = c; address.bytes[3] = d;
+  }
+  IPAddress(uint32_t value) { address.dword = value; }
+
+  operator uint32_t() const { return address.dword; }
+  bool operator==(const IPAddress& other) const { return address.dword == other.address.dword; }
+  bool operator!=(const IPAddress& other) const { return address.dword != other.address.dword; }
+  uint8_t operator[](int index) const { return address.bytes[index]; }
+  uint8_t& operator[](int index) { return address.bytes[index]; }
+
+  bool fromString(const char* text);
+  bool fromString(const String& text) { return fromString(text.c_str()); }
+  String toString() const;
+};
+
+extern const IPAddress INADDR_NONE;
+
+#endif // HOST_IP_ADDRESS_H
@@ -0,0 +1,157 @@
+#include "WiFi.h"
+#include "ArduinoOTA.h"
+#include "PubSubClient.h"
+#include "EEPROM.h"
+#include <atomic>
+#include <mutex>
+
+WiFiClass WiFi;
+ArduinoOTAClass ArduinoOTA;
+EEPROMClass EEPROM;
+
+// ---------------------------------------------------------------------------
+// WiFi
+// ---------------------------------------------------------------------------
+
+wl_status_t WiFiClass::begin(const char* networkSsid, const char* password, int32_t channel,
+                             const uint8_t* bssid, bool connect) {
+  (void)password;
+  (void)channel;
+  (void)bssid;
+  ssid = networkSsid ? networkSsid : "";
+  if (connect && !ssid.isEmpty()) currentStatus = WL_CONNECTED;
+  return currentStatus;
+}
+
+bool WiFiClass::disconnect(bool wifiOff, bool eraseAp) {
+  (void)eraseAp;
+  currentStatus = WL_DISCONNECTED;
+  if (wifiOff) currentMode = WIFI_OFF;
+  return true;
+}
+
+bool WiFiClass::config(IPAddress ip, IPAddress gateway, IPAddress subnet, IPAddress dns1, IPAddress dns2) {
+  (void)ip;
+  (void)gateway;
+  (void)subnet;
+  (void)dns1;
+  (void)dns2;
+  return true;
+}
+
+uint8_t* WiFiClass::BSSID() {
+  static uint8_t bssid[6] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+  return bssid;
+}
+
+bool WiFiClass::softAP(const char* apSsid, const char* password, int channel, int hidden, int maxConnections) {
+  (void)apSsid;
+  (void)password;
+  (void)channel;
+  (void)hidden;
+  (void)maxConnections;
+  currentMode = currentMode == WIFI_STA ? WIFI_AP_STA : WIFI_AP;
+  return true;
+}
+
+int WiFiClient::connect(IPAddress ip, uint16_t port) {
+  (void)ip;
+  (void)port;
+  open = WiFi.status() == WL_CONNECTED;
+  return open;
+}
+
+int WiFiClient::connect(const char* host, uint16_t port) {
+  (void)host;
+  (void)port;
+  open = WiFi.status() == WL_CONNECTED;
+  return open;
+}
+
+// ---------------------------------------------------------------------------
+// PubSubClient
+// ---------------------------------------------------------------------------
+
+static std::mutex clientsMutex;
+static std::vector<PubSubClient*> clients;
+static std::atomic<uint32_t> totalPublishCount(0);
+
+PubSubClient::PubSubClient(Client& client)
+  : buffer(MQTT_MAX_PACKET_SIZE), currentState(MQTT_DISCONNECTED), publishCount(0) {
+  (void)client;
+  std::lock_guard<std::mutex> lock(clientsMutex);
+  clients.push_back(this);
+}
+
+PubSubClient::~PubSubClient() {
+  std::lock_guard<std::mutex> lock(clientsMutex);
+  for (size_t i = 0; i < clients.size(); i++) {
+    if (clients[i] == this) {
+      clients.erase(clients.begin() + i);
+      break;
+    }
+  }
+}
+
+PubSubClient& PubSubClient::setCallback(MQTT_CALLBACK_SIGNATURE) {
+  this->callback = callback;
+  return *this;
+}
+
+bool PubSubClient::connect(const char* id, const char* user, const char* pass) {
+  (void)id;
+  (void)user;
+  (void)pass;
+  currentState = MQTT_CONNECTED;
+  return true;
+}
+
+bool PubSubClient::publish(const char* topic, const char* payload) {
+  return publish(topic, reinterpret_cast<const uint8_t*>(payload), payload ? strlen(payload) : 0);
+}
+
+bool PubSubClient::publish(const char* topic, const uint8_t* payload, unsigned int length) {
+  (void)payload;
+  if (!connected() || strlen(topic) + length + 7 > buffer.size()) return false;
+  publishCount++;
+  totalPublishCount++;
+  return true;
+}
+
+uint32_t PubSubClient::hostGetTotalPublishCount() {
+  return totalPublishCount;
+}
+
+void PubSubClient::hostDeliver(const char* topic, const uint8_t* payload, unsigned int length) {
+  std::lock_guard<std::mutex> lock(clientsMutex);
+  size_t topicLength = strlen(topic);
+  for (PubSubClient* client : clients) {
+    if (!client->connected() || !client->callback) continue;
+    // Packets that don't fit the client buffer are dropped, as on the device
+    if (topicLength + 1 + length > client->buffer.size()) continue;
+
+    // Topic (NUL terminated) followed by the payload, both in the client buffer
+    char* topicCopy = reinterpret_cast<char*>(client->buffer.data());
+    memcpy(topicCopy, topic, topicLength + 1);
+    uint8_t* payloadCopy = client->buffer.data() + topicLength + 1;
+    memcpy(payloadCopy, payload, length);
+    client->callback(topicCopy, payloadCopy, length);
+  }
+}
+
+// ---------------------------------------------------------------------------
+// EEPROM
+// ---------------------------------------------------------------------------
+
+bool EEPROMClass::begin(size_t size) {
+  // Erased flash reads as 0xFF; a larger begin keeps what was committed
+  flash.resize(size, 0xFF);
+  data = flash;
+  return true;
+}
+
+bool EEPROMClass::commit() {
+  flash = data;
+  commitCount++;
+  return true;
+}
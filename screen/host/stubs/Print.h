@@ -0,0 +1,48 @@
+#ifndef HOST_PRINT_H
+#define HOST_PRINT_H
+
+#include <cstddef>
+#include <cstdint>
+#include "WString.h"
+#include "IPAddress.h"
+
+// Print/Stream as in the Arduino core, formatting into write()
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size);
+  size_t write(const char* text) { return text ? write(reinterpret_cast<const uint8_t*>(text), strlen(text)) : 0; }
+  size_t write(const char* buffer, size_t size) { return write(reinterpret_cast<const uint8_t*>(buffer), size); }
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+  size_t print(const String& text) { return write(text.c_str(), text.length()); }
+  size_t print(const char* text) { return write(text); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int number, int base = 10) { return print(String(number, base)); }
+  size_t print(unsigned int number, int base = 10) { return print(String(number, base)); }
+  size_t print(long number, int base = 10) { return print(String(number, base)); }
+  size_t print(unsigned long number, int base = 10) { return print(String(number, base)); }
+  size_t print(double number, int decimals = 2) { return print(String(number, decimals)); }
+  size_t print(const IPAddress& address) { return print(address.toString()); }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(const T& value) { size_t n = print(value); return n + println(); }
+  template <typename T> size_t println(const T& value, int format) { size_t n = print(value, format); return n + println(); }
+
+  virtual void flush() {}
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+
+  String readString();
+  String readStringUntil(char terminator);
+  void setTimeout(unsigned long timeoutMs) { (void)timeoutMs; }
+};
+
+#endif // HOST_PRINT_H
@@ -0,0 +1,62 @@
+#ifndef HOST_PUB_SUB_CLIENT_H
+#define HOST_PUB_SUB_CLIENT_H
+
+#include "Arduino.h"
+#include "Client.h"
+#include <functional>
+#include <vector>
+
+#ifndef MQTT_MAX_PACKET_SIZE
+#define MQTT_MAX_PACKET_SIZE 256
+#endif
+
+#define MQTT_CONNECTION_TIMEOUT_STATE -4
+#define MQTT_CONNECTION_LOST -3
+#define MQTT_CONNECT_FAILED -2
+#define MQTT_DISCONNECTED -1
+#define MQTT_CONNECTED 0
+
+#define MQTT_CALLBACK_SIGNATURE std::function<void(char*, uint8_t*, unsigned int)> callback
+
+/**
+ * MQTT client with an in-process broker.
+ *
+ * connect() always succeeds. Nothing leaves the process: publishes are
+ * counted, and hostDeliver() hands a message to every connected client
+ * through its callback, copied into the client buffer first as the real
+ * library does when reading a PUBLISH packet.
+ */
+class PubSubClient {
+private:
+  MQTT_CALLBACK_SIGNATURE;
+  std::vector<uint8_t> buffer;
+  int currentState;
+  uint32_t publishCount;
+
+public:
+  explicit PubSubClient(Client& client);
+  ~PubSubClient();
+
+  PubSubClient& setServer(const char* domain, uint16_t port) { (void)domain; (void)port; return *this; }
+  PubSubClient& setCallback(MQTT_CALLBACK_SIGNATURE);
+  bool setBufferSize(uint16_t size) { buffer.resize(size); return true; }
+  uint16_t getBufferSize() const { return (uint16_t)buffer.size(); }
+
+  bool connect(const char* id, const char* user = nullptr, const char* pass = nullptr);
+  void disconnect() { currentState = MQTT_DISCONNECTED; }
+  bool connected() const { return currentState == MQTT_CONNECTED; }
+  int state() const { return currentState; }
+  bool loop() { return connected(); }
+
+  bool publish(const char* topic, const char* payload);
+  bool publish(const char* topic, const uint8_t* payload, unsigned int length);
+  bool subscribe(const char* topic, uint8_t qos = 0) { (void)topic; (void)qos; return connected(); }
+  bool unsubscribe(const char* topic) { (void)topic; return connected(); }
+
+  // Host helpers
+  uint32_t getPublishCount() const { return publishCount; }
+  static uint32_t hostGetTotalPublishCount();     // Over all clients, since process start
+  static void hostDeliver(const char* topic, const uint8_t* payload, unsigned int length);
+};
+
+#endif // HOST_PUB_SUB_CLIENT_H
@@ -0,0 +1,54 @@
+#ifndef HOST_SOFTWARE_SERIAL_H
+#define HOST_SOFTWARE_SERIAL_H
+
+#include "Arduino.h"
+#include <deque>
+#include <vector>
+
+// Knob UART - writes are dropped, input can be injected
+class SoftwareSerial : public Stream {
+private:
+  std::deque<uint8_t> input;
+
+  // Live ports, for hostInjectAll - the knob's port is inside KnobController
+  static std::vector<SoftwareSerial*>& instances() {
+    static std::vector<SoftwareSerial*> ports;
+    return ports;
+  }
+
+public:
+  SoftwareSerial(int8_t rxPin = -1, int8_t txPin = -1) {
+    (void)rxPin;
+    (void)txPin;
+    instances().push_back(this);
+  }
+  ~SoftwareSerial() {
+    std::vector<SoftwareSerial*>& ports = instances();
+    ports.erase(std::find(ports.begin(), ports.end(), this));
+  }
+  SoftwareSerial(const SoftwareSerial&) = delete;
+  SoftwareSerial& operator=(const SoftwareSerial&) = delete;
+  void begin(unsigned long baud) { (void)baud; }
+  void end() {}
+
+  size_t write(uint8_t c) override { (void)c; return 1; }
+  using Print::write;
+  int available() override { return (int)input.size(); }
+  int read() override {
+    if (input.empty()) return -1;
+    uint8_t c = input.front();
+    input.pop_front();
+    return c;
+  }
+  int peek() override { return input.empty() ? -1 : input.front(); }
+
+  // Host helpers
+  void inject(const char* text) {
+    while (text && *text) input.push_back((uint8_t)*text++);
+  }
+  static void hostInjectAll(const char* text) {
+    for (SoftwareSerial* port : instances()) port->inject(text);
+  }
+};
+
+#endif // HOST_SOFTWARE_SERIAL_H
@@ -0,0 +1,83 @@
+#include "WString.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+
+static std::string formatInteger(unsigned long long number, bool negative, unsigned char base) {
+  if (base < 2 || base > 36) base = 10;
+  char digits[72];
+  int pos = sizeof(digits) - 1;
+  digits[pos] = 0;
+  do {
+    int digit = number % base;
+    digits[--pos] = digit < 10 ? '0' + digit : 'a' + digit - 10;
+    number /= base;
+  } while (number > 0);
+  if (negative) digits[--pos] = '-';
+  return std::string(&digits[pos]);
+}
+
+static std::string formatSigned(long long number, unsigned char base) {
+  // Arduino prints negative numbers with a sign only in base 10
+  if (number < 0 && base == 10) {
+    return formatInteger(0ULL - (unsigned long long)number, true, base);
+  }
+  return formatInteger((unsigned long long)number, false, base);
+}
+
+String::String(int number, unsigned char base) : value(formatSigned(number, base)) {}
+String::String(unsigned int number, unsigned char base) : value(formatInteger(number, false, base)) {}
+String::String(long number, unsigned char base) : value(formatSigned(number, base)) {}
+String::String(unsigned long number, unsigned char base) : value(formatInteger(number, false, base)) {}
+String::String(long long number, unsigned char base) : value(formatSigned(number, base)) {}
+String::String(unsigned long long number, unsigned char base) : value(formatInteger(number, false, base)) {}
+
+String::String(float number, unsigned int decimals) : String((double)number, decimals) {}
+
+String::String(double number, unsigned int decimals) {
+  char buffer[64];
+  snprintf(buffer, sizeof(buffer), "%.*f", (int)decimals, number);
+  value = buffer;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+  if (from > to) std::swap(from, to);
+  if (from >= value.size()) return String();
+  if (to > value.size()) to = value.size();
+  return String(value.substr(from, to - from));
+}
+
+void String::trim() {
+  size_t start = 0;
+  while (start < value.size() && isspace((unsigned char)value[start])) start++;
+  size_t end = value.size();
+  while (end > start && isspace((unsigned char)value[end - 1])) end--;
+  value = value.substr(start, end - start);
+}
+
+void String::toLowerCase() {
+  for (char& c : value) c = tolower((unsigned char)c);
+}
+
+void String::toUpperCase() {
+  for (char& c : value) c = toupper((unsigned char)c);
+}
+
+void String::replace(const String& from, const String& to) {
+  if (from.value.empty()) return;
+  size_t pos = 0;
+  while ((pos = value.find(from.value, pos)) != std::string::npos) {
+    value.replace(pos, from.value.size(), to.value);
+    pos += to.value.size();
+  }
+}
+
+void String::toCharArray(char* buffer, unsigned int size, unsigned int index) const {
+  if (size == 0) return;
+  size_t count = 0;
+  if (index < value.size()) {
+    count = std::min<size_t>(size - 1, value.size() - index);
+    memcpy(buffer, value.data() + index, count);
+  }
+  buffer[count] = 0;
+}
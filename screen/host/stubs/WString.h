@@ -0,0 +1,104 @@
+#ifndef HOST_WSTRING_H
+#define HOST_WSTRING_H
+
+#include <cstdlib>
+#include <cstring>
+#include <strings.h>
+#include <string>
+
+// Arduino String on top of std::string - same interface, same value semantics
+class String {
+private:
+  std::string value;
+
+public:
+  String() {}
+  String(const char* text) : value(text ? text : "") {}
+  String(const std::string& text) : value(text) {}
+  explicit String(char c) : value(1, c) {}
+  explicit String(int number, unsigned char base = 10);
+  explicit String(unsigned int number, unsigned char base = 10);
+  explicit String(long number, unsigned char base = 10);
+  explicit String(unsigned long number, unsigned char base = 10);
+  explicit String(long long number, unsigned char base = 10);
+  explicit String(unsigned long long number, unsigned char base = 10);
+  explicit String(float number, unsigned int decimals = 2);
+  explicit String(double number, unsigned int decimals = 2);
+
+  const char* c_str() const { return value.c_str(); }
+  unsigned int length() const { return value.length(); }
+  bool isEmpty() const { return value.empty(); }
+  bool reserve(unsigned int size) { value.reserve(size); return true; }
+
+  char charAt(unsigned int index) const { return index < value.size() ? value[index] : 0; }
+  char operator[](unsigned int index) const { return charAt(index); }
+  char& operator[](unsigned int index) { return value[index]; }
+  void setCharAt(unsigned int index, char c) { if (index < value.size()) value[index] = c; }
+
+  String& operator=(const char* text) { value = text ? text : ""; return *this; }
+  String& operator+=(const String& other) { value += other.value; return *this; }
+  String& operator+=(const char* text) { if (text) value += text; return *this; }
+  String& operator+=(char c) { value += c; return *this; }
+  String& operator+=(int number) { return *this += String(number); }
+  String& operator+=(unsigned int number) { return *this += String(number); }
+  String& operator+=(long number) { return *this += String(number); }
+  String& operator+=(unsigned long number) { return *this += String(number); }
+  bool concat(const String& other) { value += other.value; return true; }
+  bool concat(const char* text) { if (text) value += text; return true; }
+  bool concat(char c) { value += c; return true; }
+
+  bool equals(const String& other) const { return value == other.value; }
+  bool equals(const char* text) const { return value == (text ? text : ""); }
+  bool equalsIgnoreCase(const String& other) const { return strcasecmp(c_str(), other.c_str()) == 0; }
+  bool operator==(const String& other) const { return value == other.value; }
+  bool operator==(const char* text) const { return equals(text); }
+  bool operator!=(const String& other) const { return value != other.value; }
+  bool operator!=(const char* text) const { return !equals(text); }
+  bool operator<(const String& other) const { return value < other.value; }
+  int compareTo(const String& other) const { return value.compare(other.value); }
+  bool startsWith(const String& prefix) const { return value.compare(0, prefix.value.size(), prefix.value) == 0; }
+  bool endsWith(const String& suffix) const {
+    return value.size() >= suffix.value.size() &&
+           value.compare(value.size() - suffix.value.size(), suffix.value.size(), suffix.value) == 0;
+  }
+
+  int indexOf(char c, unsigned int from = 0) const { return toIndex(value.find(c, from)); }
+  int indexOf(const String& text, unsigned int from = 0) const { return toIndex(value.find(text.value, from)); }
+  int lastIndexOf(char c) const { return toIndex(value.rfind(c)); }
+  int lastIndexOf(const String& text) const { return toIndex(value.rfind(text.value)); }
+
+  String substring(unsigned int from) const { return from < value.size() ? String(value.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const;
+
+  long toInt() const { return strtol(value.c_str(), nullptr, 10); }
+  float toFloat() const { return strtof(value.c_str(), nullptr); }
+  double toDouble() const { return strtod(value.c_str(), nullptr); }
+
+  void trim();
+  void toLowerCase();
+  void toUpperCase();
+  void replace(const String& from, const String& to);
+  void remove(unsigned int index, unsigned int count = (unsigned int)-1) {
+    if (index < value.size()) value.erase(index, count);
+  }
+  void toCharArray(char* buffer, unsigned int size, unsigned int index = 0) const;
+  void getBytes(unsigned char* buffer, unsigned int size, unsigned int index = 0) const {
+    toCharArray(reinterpret_cast<char*>(buffer), size, index);
+  }
+
+private:
+  static int toIndex(size_t position) { return position == std::string::npos ? -1 : (int)position; }
+};
+
+inline String operator+(const String& a, const String& b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, const char* b) { String r(a); r += b; return r; }
+inline String operator+(const char* a, const String& b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, char b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, int b) { return a + String(b); }
+inline String operator+(const String& a, unsigned int b) { return a + String(b); }
+inline String operator+(const String& a, long b) { return a + String(b); }
+inline String operator+(const String& a, unsigned long b) { return a + String(b); }
+inline String operator+(const String& a, float b) { return a + String(b); }
+inline String operator+(const String& a, double b) { return a + String(b); }
+
+#endif // HOST_WSTRING_H
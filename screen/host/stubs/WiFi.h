@@ -0,0 +1,90 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include "Arduino.h"
+#include "WiFiClient.h"
+
+typedef enum {
+  WL_NO_SHIELD = 255,
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL,
+  WL_SCAN_COMPLETED,
+  WL_CONNECTED,
+  WL_CONNECT_FAILED,
+  WL_CONNECTION_LOST,
+  WL_DISCONNECTED
+} wl_status_t;
+
+typedef enum {
+  WIFI_OFF = 0,
+  WIFI_STA,
+  WIFI_AP,
+  WIFI_AP_STA
+} wifi_mode_t;
+
+typedef enum {
+  WIFI_POWER_19_5dBm = 78,
+  WIFI_POWER_8_5dBm = 34,
+} wifi_power_t;
+
+/**
+ * Station/AP state without a radio.
+ *
+ * begin() "connects" immediately, so code paths that wait for WL_CONNECTED run
+ * through without the real timeouts. The host can force a status for tests of
+ * the failure paths.
+ */
+class WiFiClass {
+private:
+  wl_status_t currentStatus = WL_DISCONNECTED;
+  wifi_mode_t currentMode = WIFI_OFF;
+  String ssid;
+
+public:
+  wl_status_t begin(const char* networkSsid, const char* password = nullptr, int32_t channel = 0,
+                    const uint8_t* bssid = nullptr, bool connect = true);
+  bool disconnect(bool wifiOff = false, bool eraseAp = false);
+  bool reconnect() { currentStatus = WL_CONNECTED; return true; }
+  wl_status_t status() { return currentStatus; }
+  bool isConnected() { return currentStatus == WL_CONNECTED; }
+  bool mode(wifi_mode_t newMode) { currentMode = newMode; return true; }
+  wifi_mode_t getMode() { return currentMode; }
+  bool config(IPAddress ip, IPAddress gateway, IPAddress subnet, IPAddress dns1 = IPAddress(), IPAddress dns2 = IPAddress());
+  bool setHostname(const char* hostname) { (void)hostname; return true; }
+  bool setAutoReconnect(bool enabled) { (void)enabled; return true; }
+  bool setSleep(bool enabled) { (void)enabled; return true; }
+  bool setTxPower(wifi_power_t power) { (void)power; return true; }
+
+  IPAddress localIP() { return currentStatus == WL_CONNECTED ? IPAddress(192, 168, 1, 50) : IPAddress(); }
+  IPAddress gatewayIP() { return IPAddress(192, 168, 1, 1); }
+  IPAddress subnetMask() { return IPAddress(255, 255, 255, 0); }
+  IPAddress dnsIP(uint8_t index = 0) { (void)index; return IPAddress(192, 168, 1, 1); }
+  String SSID() { return ssid; }
+  int8_t RSSI() { return currentStatus == WL_CONNECTED ? -55 : 0; }
+  int32_t channel() { return 6; }
+  uint8_t* BSSID();
+  String macAddress() { return "02:00:00:00:00:42"; }
+
+  // Scans find nothing on the host
+  int16_t scanNetworks(bool async = false) { (void)async; return 0; }
+  void scanDelete() {}
+  String SSID(uint8_t index) { (void)index; return String(); }
+  int32_t RSSI(uint8_t index) { (void)index; return 0; }
+  int32_t channel(uint8_t index) { (void)index; return 0; }
+  uint8_t* BSSID(uint8_t index) { (void)index; return BSSID(); }
+
+  bool softAP(const char* apSsid, const char* password = nullptr, int channel = 1, int hidden = 0, int maxConnections = 4);
+  bool softAPConfig(IPAddress ip, IPAddress gateway, IPAddress subnet) { (void)ip; (void)gateway; (void)subnet; return true; }
+  bool softAPdisconnect(bool wifiOff = false) { (void)wifiOff; return true; }
+  IPAddress softAPIP() { return IPAddress(192, 168, 4, 1); }
+  uint8_t softAPgetStationNum() { return 0; }
+
+  int hostByName(const char* host, IPAddress& result) { (void)host; result = IPAddress(93, 184, 216, 34); return 1; }
+
+  // Host helper
+  void hostSetStatus(wl_status_t status) { currentStatus = status; }
+};
+
+extern WiFiClass WiFi;
+
+#endif // HOST_WIFI_H
@@ -0,0 +1,49 @@
+#ifndef HOST_WIFI_CLIENT_H
+#define HOST_WIFI_CLIENT_H
+
+#include "Arduino.h"
+#include "Client.h"
+
+// TCP socket without a peer - connects whenever WiFi is up, but nothing is
+// ever received and writes are dropped
+class WiFiClient : public Client {
+private:
+  bool open = false;
+
+public:
+  int connect(IPAddress ip, uint16_t port) override;
+  int connect(const char* host, uint16_t port) override;
+  int connect(const char* host, uint16_t port, int32_t timeoutMs) { (void)timeoutMs; return connect(host, port); }
+  size_t write(uint8_t c) override { (void)c; return open ? 1 : 0; }
+  size_t write(const uint8_t* buffer, size_t size) override { (void)buffer; return open ? size : 0; }
+  using Print::write;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int read(uint8_t* buffer, size_t size) override { (void)buffer; (void)size; return -1; }
+  int peek() override { return -1; }
+  void stop() override { open = false; }
+  uint8_t connected() override { return open; }
+  int fd() const { return -1; }
+  operator bool() override { return open; }
+  void setNoDelay(bool noDelay) { (void)noDelay; }
+  void setTimeout(uint32_t seconds) { (void)seconds; }
+  IPAddress remoteIP() const { return IPAddress(); }
+  uint16_t remotePort() const { return 0; }
+  IPAddress localIP() const { return IPAddress(); }
+};
+
+class WiFiServer {
+public:
+  WiFiServer(uint16_t port = 80, uint8_t maxClients = 4) { (void)port; (void)maxClients; }
+  void begin(uint16_t port = 0) { (void)port; }
+  void end() {}
+  void close() {}
+  void stop() {}
+  void setNoDelay(bool noDelay) { (void)noDelay; }
+  bool hasClient() { return false; }
+  WiFiClient available() { return WiFiClient(); }
+  WiFiClient accept() { return WiFiClient(); }
+  operator bool() { return true; }
+};
+
+#endif // HOST_WIFI_CLIENT_H
@@ -0,0 +1,13 @@
+#ifndef HOST_WIFI_CLIENT_SECURE_H
+#define HOST_WIFI_CLIENT_SECURE_H
+
+#include "WiFiClient.h"
+
+class WiFiClientSecure : public WiFiClient {
+public:
+  void setInsecure() {}
+  void setCACert(const char* rootCA) { (void)rootCA; }
+  void setHandshakeTimeout(unsigned long seconds) { (void)seconds; }
+};
+
+#endif // HOST_WIFI_CLIENT_SECURE_H
@@ -0,0 +1,26 @@
+#ifndef HOST_WIFI_UDP_H
+#define HOST_WIFI_UDP_H
+
+#include "Arduino.h"
+
+// UDP socket without a network - sends succeed, nothing is ever received
+class WiFiUDP : public Stream {
+public:
+  uint8_t begin(uint16_t port) { (void)port; return 1; }
+  void stop() {}
+  int beginPacket(IPAddress ip, uint16_t port) { (void)ip; (void)port; return 1; }
+  int endPacket() { return 1; }
+  size_t write(uint8_t c) override { (void)c; return 1; }
+  size_t write(const uint8_t* buffer, size_t size) override { (void)buffer; return size; }
+  using Print::write;
+  int parsePacket() { return 0; }
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int read(unsigned char* buffer, size_t length) { (void)buffer; (void)length; return 0; }
+  int read(char* buffer, size_t length) { (void)buffer; (void)length; return 0; }
+  int peek() override { return -1; }
+  IPAddress remoteIP() { return IPAddress(); }
+  uint16_t remotePort() { return 0; }
+};
+
+#endif // HOST_WIFI_UDP_H
@@ -0,0 +1,15 @@
+#ifndef HOST_ESP_PM_H
+#define HOST_ESP_PM_H
+
+// CONFIG_PM_ENABLE stays undefined, so PowerManager runs without frequency scaling
+#include "esp_system.h"
+
+typedef enum {
+  ESP_PM_CPU_FREQ_MAX,
+  ESP_PM_APB_FREQ_MAX,
+  ESP_PM_NO_LIGHT_SLEEP,
+} esp_pm_lock_type_t;
+
+typedef struct esp_pm_lock* esp_pm_lock_handle_t;
+
+#endif // HOST_ESP_PM_H
@@ -0,0 +1,16 @@
+#ifndef HOST_ESP_SNTP_H
+#define HOST_ESP_SNTP_H
+
+#include <ctime>
+
+typedef enum {
+  SNTP_SYNC_STATUS_RESET,
+  SNTP_SYNC_STATUS_COMPLETED,
+  SNTP_SYNC_STATUS_IN_PROGRESS,
+} sntp_sync_status_t;
+
+// The host clock is already synchronized
+void sntp_restart();
+sntp_sync_status_t sntp_get_sync_status();
+
+#endif // HOST_ESP_SNTP_H
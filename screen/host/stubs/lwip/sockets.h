@@ -0,0 +1,8 @@
+#ifndef HOST_LWIP_SOCKETS_H
+#define HOST_LWIP_SOCKETS_H
+
+// lwIP follows the BSD socket API, so the host's own sockets stand in for it
+#include <sys/socket.h>
+#include <errno.h>
+
+#endif // HOST_LWIP_SOCKETS_H
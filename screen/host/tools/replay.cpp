@@ -0,0 +1,330 @@
+// Replays an input capture (the lines sent by the firmware's capture:dump
+// command) through the real controller code on a simulated clock
+//
+//   replay [capture.txt] [--tail ms]
+//
+// Reads stdin when no path is given; lines without "capture:" are skipped, so
+// a raw TCP session log works as input. The display and network task bodies
+// run in one thread on their device periods (5 ms and 10 ms), with each knob
+// line and touch sample injected before the next frame and each MQTT message
+// delivered before the next network cycle. Time moves only through those
+// periods and the firmware's own delays, so a capture replays the same way
+// every run. --tail keeps running after the last input (default 2000 ms) to
+// let animations and rate-limited publishes settle.
+//
+// Reports frame times (host CPU, so compare runs on one machine), publishes,
+// knob-to-pixel latency in simulated time and the final UI state, then a
+// "replay:" line for scripts.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "SetupHandler.h"
+#include "StateBroadcaster.h"
+#include "CaptureFormat.h"
+#include "RoundPanel.h"
+
+#define REPLAY_FRAME_INTERVAL 5       // Display task period while active (LoopHandler)
+#define REPLAY_NETWORK_INTERVAL 10    // Network task period while active
+
+struct CapturedInput {
+  CaptureRecordHeader header;
+  std::vector<uint8_t> payload;
+};
+
+struct CaptureFile {
+  int version = 0;
+  unsigned long duration = 0;
+  bool truncated = false;
+  ResumeSnapshot initialState = {};
+  std::vector<uint8_t> bytes;
+  bool ended = false;
+};
+
+static int base64Value(char c) {
+  if (c >= 'A' && c <= 'Z') return c - 'A';
+  if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+  if (c >= '0' && c <= '9') return c - '0' + 52;
+  if (c == '+') return 62;
+  if (c == '/') return 63;
+  return -1;
+}
+
+static void appendBase64(const std::string& text, std::vector<uint8_t>& bytes) {
+  uint32_t chunk = 0;
+  int bits = 0;
+  for (char c : text) {
+    int value = base64Value(c);
+    if (value < 0) continue;  // '=' padding, stray whitespace
+    chunk = (chunk << 6) | value;
+    bits += 6;
+    if (bits >= 8) {
+      bits -= 8;
+      bytes.push_back((uint8_t)(chunk >> bits));
+    }
+  }
+}
+
+static unsigned long fieldValue(const std::string& line, const char* key) {
+  std::string pattern = std::string(",") + key + "=";
+  size_t position = line.find(pattern);
+  return position == std::string::npos ? 0 : strtoul(line.c_str() + position + pattern.size(), nullptr, 10);
+}
+
+static bool readCapture(std::istream& in, CaptureFile& capture) {
+  std::string line;
+  bool begun = false;
+  while (std::getline(in, line)) {
+    size_t start = line.find("capture:");
+    if (start == std::string::npos) continue;
+    line = line.substr(start + 8);
+    while (!line.empty() && (line.back() == '\r' || line.back() == ' ')) line.pop_back();
+
+    if (line.compare(0, 6, "begin,") == 0) {
+      // A second dump in the same log replaces the first
+      capture = CaptureFile();
+      capture.version = (int)fieldValue(line, "version");
+      capture.duration = fieldValue(line, "duration");
+      capture.truncated = fieldValue(line, "truncated") != 0;
+      capture.initialState.mode = (uint8_t)fieldValue(line, "mode");
+      capture.initialState.soundSetpoint = (uint8_t)fieldValue(line, "sound");
+      capture.initialState.lightSetpoint = (uint8_t)fieldValue(line, "light");
+      capture.initialState.playing = (uint8_t)fieldValue(line, "playing");
+      begun = true;
+    } else if (line.compare(0, 5, "data,") == 0) {
+      appendBase64(line.substr(5), capture.bytes);
+    } else if (line == "end") {
+      capture.ended = true;
+    }
+  }
+  return begun;
+}
+
+static bool parseRecords(const std::vector<uint8_t>& bytes, std::vector<CapturedInput>& inputs) {
+  size_t offset = 0;
+  while (offset + sizeof(CaptureRecordHeader) <= bytes.size()) {
+    CapturedInput input;
+    memcpy(&input.header, &bytes[offset], sizeof(input.header));
+    offset += sizeof(input.header);
+    if (offset + input.header.length > bytes.size()) return false;
+    input.payload.assign(bytes.begin() + offset, bytes.begin() + offset + input.header.length);
+    offset += input.header.length;
+    inputs.push_back(input);
+  }
+  return offset == bytes.size();
+}
+
+static const char* modeName(uint8_t mode) {
+  static const char* const names[] = { "sound", "light", "temperature", "home", "calibrate", "initialization",
+                                       "info", "sleep" };
+  return mode < sizeof(names) / sizeof(names[0]) ? names[mode] : "unknown";
+}
+
+// Simulated ms since the replay started
+static unsigned long replayStart = 0;
+
+static unsigned long elapsed() {
+  return millis() - replayStart;
+}
+
+static void advanceTo(unsigned long time) {
+  unsigned long now = elapsed();
+  if (time > now) hostAdvanceMillis(time - now);
+}
+
+static void setUpFirmware() {
+  // As SetupHandler does on a cold boot, minus the boot screen and tasks
+  xMutex = xSemaphoreCreateMutex();
+  eepromManager.begin();
+  eepromManager.wifiCredentials[0].ssid = "HostNetwork";
+  eepromManager.wifiCredentials[0].password = "password";
+  eepromManager.lastConnectedNetworkIndex = 0;
+  eepromManager.saveSoundMQTTServer("broker.local", 8883, "user", "secret");
+
+  tcpClient = new WiFiTCPClient(&eepromManager);
+  tcpClient->initialize();
+  StateBroadcaster::getInstance()->setTCPClient(tcpClient);
+
+  gfx = new RoundPanel(nullptr);  // As the firmware creates it
+  displayController = new DisplayController(gfx, 6, 7, 19, 5, nullptr);
+  displayController->initScreen();
+  displayController->setTCPClient(tcpClient);
+
+  knobController = new KnobController(KNOB_RX_PIN, KNOB_TX_PIN);
+  knobController->begin(9600);
+
+  commandHandler = new CommandHandler(displayController, &eepromManager, tcpClient);
+  commandHandler->initialize();
+  displayController->registerKnobController(knobController);
+  commandHandler->registerKnobController(knobController);
+
+  tcpClient->connectToMQTTServer();
+}
+
+int main(int argc, char** argv) {
+  const char* path = nullptr;
+  unsigned long tail = 2000;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--tail") == 0 && i + 1 < argc) {
+      tail = strtoul(argv[++i], nullptr, 10);
+    } else {
+      path = argv[i];
+    }
+  }
+
+  std::ifstream inputFile;
+  if (path) {
+    inputFile.open(path);
+    if (!inputFile) {
+      fprintf(stderr, "replay: cannot open %s\n", path);
+      return 1;
+    }
+  }
+  std::istream& in = path ? inputFile : std::cin;
+
+  CaptureFile capture;
+  if (!readCapture(in, capture)) {
+    fprintf(stderr, "replay: no capture:begin line in the input\n");
+    return 1;
+  }
+  if (capture.version != CAPTURE_FORMAT_VERSION) {
+    fprintf(stderr, "replay: capture is format version %d, expected %d\n", capture.version, CAPTURE_FORMAT_VERSION);
+    return 1;
+  }
+  if (!capture.ended) {
+    fprintf(stderr, "replay: capture is incomplete (no capture:end), replaying what arrived\n");
+  }
+  std::vector<CapturedInput> inputs;
+  if (!parseRecords(capture.bytes, inputs)) {
+    fprintf(stderr, "replay: capture data is cut off after %zu records, replaying those\n", inputs.size());
+  }
+
+  hostUseSimulatedClock();
+  setUpFirmware();
+
+  // Start where the capture started
+  displayController->restoreResumeState(capture.initialState);
+  LatencyTracer::getInstance()->reset();
+  uint32_t publishesBefore = PubSubClient::hostGetTotalPublishCount();
+
+  replayStart = millis();
+  unsigned long lastInput = inputs.empty() ? 0 : inputs.back().header.time;
+  unsigned long endTime = std::max(lastInput, capture.duration) + tail;
+  unsigned long nextFrame = 0;
+  unsigned long nextNetwork = 0;
+  size_t nextInput = 0;
+  size_t nextMessage = 0;
+  uint32_t inputCounts[3] = { 0, 0, 0 };
+
+  std::vector<uint32_t> frameMicros;
+  uint32_t slowestFrame = 0;
+  unsigned long slowestFrameTime = 0;
+
+  while (nextFrame <= endTime || nextNetwork <= endTime) {
+    if (nextFrame <= nextNetwork) {
+      advanceTo(nextFrame);
+
+      // Knob and touch input that has arrived by now
+      for (; nextInput < inputs.size() && inputs[nextInput].header.time <= elapsed(); nextInput++) {
+        const CapturedInput& input = inputs[nextInput];
+        if (input.header.type == CAPTURE_KNOB_LINE) {
+          std::string line(input.payload.begin(), input.payload.end());
+          line += '\n';
+          SoftwareSerial::hostInjectAll(line.c_str());
+        } else if (input.header.type == CAPTURE_TOUCH && input.payload.size() >= sizeof(CaptureTouch)) {
+          CaptureTouch touch;
+          memcpy(&touch, input.payload.data(), sizeof(touch));
+          data_struct sample = {};
+          sample.x = touch.x;
+          sample.y = touch.y;
+          sample.gestureID = touch.gestureID;
+          sample.points = touch.points;
+          sample.event = touch.event;
+          CST816S::hostInjectAll(sample);
+        } else {
+          continue;
+        }
+        inputCounts[input.header.type]++;
+      }
+
+      // Display task body
+      unsigned long frameStart = elapsed();
+      auto wallStart = std::chrono::steady_clock::now();
+      xSemaphoreTake(xMutex, portMAX_DELAY);
+      displayController->update();
+      knobController->update();
+      xSemaphoreGive(xMutex);
+      uint32_t took = (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - wallStart).count();
+      frameMicros.push_back(took);
+      if (took > slowestFrame) {
+        slowestFrame = took;
+        slowestFrameTime = frameStart;
+      }
+      nextFrame = elapsed() + REPLAY_FRAME_INTERVAL;
+    } else {
+      advanceTo(nextNetwork);
+
+      // Messages the broker has delivered by now - PubSubClient::loop hands them over
+      for (; nextMessage < inputs.size() && inputs[nextMessage].header.time <= elapsed(); nextMessage++) {
+        const CapturedInput& input = inputs[nextMessage];
+        if (input.header.type != CAPTURE_MQTT) continue;
+        const char* topic = reinterpret_cast<const char*>(input.payload.data());
+        size_t topicLength = strnlen(topic, input.payload.size());
+        if (topicLength == input.payload.size()) continue;
+        PubSubClient::hostDeliver(topic, input.payload.data() + topicLength + 1,
+                                  (unsigned int)(input.payload.size() - topicLength - 1));
+        inputCounts[CAPTURE_MQTT]++;
+      }
+
+      // Network task body
+      xSemaphoreTake(xMutex, portMAX_DELAY);
+      tcpClient->update();
+      commandHandler->update();
+      StateBroadcaster::getInstance()->update();
+      eepromManager.update();
+      xSemaphoreGive(xMutex);
+      nextNetwork = elapsed() + REPLAY_NETWORK_INTERVAL;
+    }
+  }
+
+  std::vector<uint32_t> sorted = frameMicros;
+  std::sort(sorted.begin(), sorted.end());
+  auto framePercentile = [&sorted](int percent) -> uint32_t {
+    if (sorted.empty()) return 0;
+    size_t index = (sorted.size() * percent + 99) / 100;
+    return sorted[index > 0 ? index - 1 : 0];
+  };
+
+  ResumeSnapshot finalState = {};
+  displayController->captureResumeState(finalState);
+  uint32_t publishes = PubSubClient::hostGetTotalPublishCount() - publishesBefore;
+  LatencyTracer* tracer = LatencyTracer::getInstance();
+
+  printf("[Replay] %zu inputs over %lu ms%s: %u knob lines, %u touch samples, %u MQTT messages\n",
+         inputs.size(), capture.duration, capture.truncated ? " (capture truncated)" : "",
+         inputCounts[CAPTURE_KNOB_LINE], inputCounts[CAPTURE_TOUCH], inputCounts[CAPTURE_MQTT]);
+  printf("[Replay] %zu frames, frame time p50 %u us, p99 %u us, max %u us at %lu ms\n", frameMicros.size(),
+         framePercentile(50), framePercentile(99), slowestFrame, slowestFrameTime);
+  printf("[Replay] %u MQTT publishes, knob->pixel p50 %.1f ms, p99 %.1f ms (%lu samples)\n", publishes,
+         tracer->getPercentile(LATENCY_KNOB_TO_PIXEL, 50) / 1000.0,
+         tracer->getPercentile(LATENCY_KNOB_TO_PIXEL, 99) / 1000.0,
+         (unsigned long)tracer->getCount(LATENCY_KNOB_TO_PIXEL));
+  printf("[Replay] start: %s, sound %u, light %u, %s\n", modeName(capture.initialState.mode),
+         capture.initialState.soundSetpoint, capture.initialState.lightSetpoint,
+         capture.initialState.playing ? "playing" : "paused");
+  printf("[Replay] final: %s, sound %u, light %u, %s\n", modeName(finalState.mode), finalState.soundSetpoint,
+         finalState.lightSetpoint, finalState.playing ? "playing" : "paused");
+  printf("replay:inputs=%zu,frames=%zu,frame_p50_us=%u,frame_p99_us=%u,frame_max_us=%u,publishes=%u,"
+         "mode=%s,sound=%u,light=%u,playing=%u\n",
+         inputs.size(), frameMicros.size(), framePercentile(50), framePercentile(99), slowestFrame, publishes,
+         modeName(finalState.mode), finalState.soundSetpoint, finalState.lightSetpoint, finalState.playing);
+  return 0;
+}
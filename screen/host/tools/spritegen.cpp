@@ -0,0 +1,228 @@
+// Renders the firmware's icons into the run-length sprites of SpriteData.cpp
+//
+//   spritegen [SpriteData.cpp]
+//
+// Writes stdout when no path is given; the "sprites" target regenerates the
+// firmware's copy. Each icon is drawn with the same Arduino_GFX primitives the
+// firmware used to call on every redraw, onto the host framebuffer, then cut
+// out, palettized (black first, white second - the tintable ink) and encoded
+// as described in Sprite.h. Icons with text keep the text out of the sprite:
+// the stub font is not the panel's.
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include <Arduino_GFX_Library.h>
+#include "Buttons.h"
+
+struct Crop {
+  int x, y, w, h;
+};
+
+typedef void (*DrawIcon)(Arduino_GFX* gfx, int centerX, int centerY);
+
+static const int CENTER = 120;
+
+//////////////////////////////////////////////////
+// Media buttons
+//////////////////////////////////////////////////
+
+static void drawPlay(Arduino_GFX* gfx, int x, int y) {
+  int width = MEDIA_BUTTON_SIZE;
+  int height = MEDIA_BUTTON_SIZE;
+  gfx->fillTriangle(
+    x - width / 4, y - height / 3,  // Top left
+    x - width / 4, y + height / 3,  // Bottom left
+    x + width / 3, y,               // Right point
+    WHITE);
+}
+
+static void drawPause(Arduino_GFX* gfx, int x, int y) {
+  int width = MEDIA_BUTTON_SIZE;
+  int height = MEDIA_BUTTON_SIZE;
+  int barWidth = width / 5;
+  int barHeight = height / 2;
+  int spacing = width / 8;
+  gfx->fillRect(x - spacing - barWidth / 2, y - barHeight / 2, barWidth, barHeight, WHITE);
+  gfx->fillRect(x + spacing - barWidth / 2, y - barHeight / 2, barWidth, barHeight, WHITE);
+}
+
+static void drawRewind(Arduino_GFX* gfx, int x, int y) {
+  int width = MEDIA_BUTTON_SIZE;
+  int height = MEDIA_BUTTON_SIZE;
+  int triangleWidth = width / 3;
+  int triangleHeight = height / 2;
+  int spacing = width / 12;
+  gfx->fillTriangle(
+    x + triangleWidth / 2 - spacing, y,
+    x - triangleWidth / 2 - spacing, y - triangleHeight / 2,
+    x - triangleWidth / 2 - spacing, y + triangleHeight / 2,
+    WHITE);
+  gfx->fillTriangle(
+    x - spacing, y,
+    x - triangleWidth - spacing, y - triangleHeight / 2,
+    x - triangleWidth - spacing, y + triangleHeight / 2,
+    WHITE);
+}
+
+static void drawForward(Arduino_GFX* gfx, int x, int y) {
+  int width = MEDIA_BUTTON_SIZE;
+  int height = MEDIA_BUTTON_SIZE;
+  int triangleWidth = width / 3;
+  int triangleHeight = height / 2;
+  int spacing = width / 12;
+  gfx->fillTriangle(
+    x - triangleWidth / 2 + spacing, y,
+    x + triangleWidth / 2 + spacing, y - triangleHeight / 2,
+    x + triangleWidth / 2 + spacing, y + triangleHeight / 2,
+    WHITE);
+  gfx->fillTriangle(
+    x + spacing, y,
+    x + triangleWidth + spacing, y - triangleHeight / 2,
+    x + triangleWidth + spacing, y + triangleHeight / 2,
+    WHITE);
+}
+
+//////////////////////////////////////////////////
+// Home screen mode icons
+//////////////////////////////////////////////////
+
+static void drawBulb(Arduino_GFX* gfx, int centerX, int centerY) {
+  gfx->fillCircle(centerX, centerY, 25, gfx->color565(255, 255, 0));
+  gfx->fillRect(centerX - 7, centerY + 25, 14, 15, gfx->color565(180, 180, 180));
+  for (int i = 0; i < 360; i += 45) {
+    float rad = i * PI / 180;
+    int x1 = centerX + 30 * cos(rad);
+    int y1 = centerY + 30 * sin(rad);
+    int x2 = centerX + 40 * cos(rad);
+    int y2 = centerY + 40 * sin(rad);
+    gfx->drawLine(x1, y1, x2, y2, gfx->color565(255, 255, 0));
+  }
+}
+
+static void drawThermometer(Arduino_GFX* gfx, int centerX, int centerY) {
+  gfx->fillCircle(centerX, centerY + 30, 15, gfx->color565(255, 0, 0));
+  gfx->fillRect(centerX - 5, centerY - 40, 10, 70, gfx->color565(255, 0, 0));
+  gfx->drawCircle(centerX, centerY + 30, 17, WHITE);
+  gfx->drawRect(centerX - 7, centerY - 40, 14, 70, WHITE);
+  for (int y = centerY - 30; y <= centerY + 10; y += 10) {
+    gfx->drawLine(centerX - 12, y, centerX - 7, y, WHITE);
+  }
+}
+
+static void drawSpeaker(Arduino_GFX* gfx, int centerX, int centerY) {
+  gfx->fillRect(centerX - 25, centerY - 20, 20, 40, gfx->color565(192, 192, 192));
+  gfx->fillTriangle(
+    centerX - 5, centerY - 30,
+    centerX - 5, centerY + 30,
+    centerX + 20, centerY,
+    gfx->color565(160, 160, 160));
+  gfx->drawRect(centerX - 25, centerY - 20, 20, 40, WHITE);
+  gfx->drawTriangle(
+    centerX - 5, centerY - 30,
+    centerX - 5, centerY + 30,
+    centerX + 20, centerY,
+    WHITE);
+  gfx->drawArc(centerX + 25, centerY, 10, 5, 270, 90, WHITE);
+  gfx->drawArc(centerX + 35, centerY, 15, 5, 270, 90, WHITE);
+}
+
+//////////////////////////////////////////////////
+// Encoding
+//////////////////////////////////////////////////
+
+// Bounding box of everything the icons paint, so they all replace each other
+static Crop paintedArea(const std::vector<DrawIcon>& icons) {
+  int left = CENTER * 2, top = CENTER * 2, right = -1, bottom = -1;
+  for (DrawIcon icon : icons) {
+    Arduino_GC9A01 gfx(nullptr);
+    icon(&gfx, CENTER, CENTER);
+    for (int y = 0; y < gfx.height(); y++) {
+      for (int x = 0; x < gfx.width(); x++) {
+        if (gfx.getPixel(x, y) != BLACK) {
+          left = std::min(left, x);
+          right = std::max(right, x);
+          top = std::min(top, y);
+          bottom = std::max(bottom, y);
+        }
+      }
+    }
+  }
+  return { left, top, right - left + 1, bottom - top + 1 };
+}
+
+static bool writeSprite(FILE* out, const char* name, DrawIcon icon, const Crop& crop) {
+  Arduino_GC9A01 gfx(nullptr);
+  icon(&gfx, CENTER, CENTER);
+
+  std::vector<uint16_t> palette = { BLACK, WHITE };
+  std::vector<uint8_t> indices;
+  for (int y = crop.y; y < crop.y + crop.h; y++) {
+    for (int x = crop.x; x < crop.x + crop.w; x++) {
+      uint16_t color = gfx.getPixel(x, y);
+      size_t index = 0;
+      while (index < palette.size() && palette[index] != color) index++;
+      if (index == palette.size()) {
+        if (palette.size() == 16) {
+          fprintf(stderr, "%s: more than 16 colors\n", name);
+          return false;
+        }
+        palette.push_back(color);
+      }
+      indices.push_back((uint8_t)index);
+    }
+  }
+  palette.resize(16, BLACK);
+
+  std::vector<uint8_t> runs;
+  for (size_t i = 0; i < indices.size();) {
+    size_t length = 1;
+    while (length < 16 && i + length < indices.size() && indices[i + length] == indices[i]) length++;
+    runs.push_back((uint8_t)((indices[i] << 4) | (length - 1)));
+    i += length;
+  }
+
+  fprintf(out, "\n// %s: %dx%d, %zu bytes\n", name, crop.w, crop.h, runs.size());
+  fprintf(out, "static const uint16_t %s_PALETTE[16] PROGMEM = {", name);
+  for (size_t i = 0; i < palette.size(); i++) {
+    fprintf(out, "%s0x%04X", i % 8 == 0 ? "\n  " : " ", palette[i]);
+    if (i + 1 < palette.size()) fputc(',', out);
+  }
+  fprintf(out, "\n};\n");
+  fprintf(out, "static const uint8_t %s_RUNS[] PROGMEM = {", name);
+  for (size_t i = 0; i < runs.size(); i++) {
+    fprintf(out, "%s0x%02X", i % 16 == 0 ? "\n  " : " ", runs[i]);
+    if (i + 1 < runs.size()) fputc(',', out);
+  }
+  fprintf(out, "\n};\n");
+  fprintf(out, "const Sprite SPRITE_%s = { %d, %d, %d, %d, %s_PALETTE, %s_RUNS };\n",
+          name, crop.w, crop.h, crop.x - CENTER, crop.y - CENTER, name, name);
+  return true;
+}
+
+int main(int argc, char** argv) {
+  FILE* out = stdout;
+  if (argc > 1 && !(out = fopen(argv[1], "w"))) {
+    fprintf(stderr, "cannot write %s\n", argv[1]);
+    return 1;
+  }
+
+  fprintf(out, "// Generated by host/tools/spritegen.cpp - do not edit\n\n#include \"Sprite.h\"\n");
+
+  // Buttons cover their whole widget bounds, clearing their own background
+  int half = MEDIA_BUTTON_SIZE / 2;
+  Crop button = { CENTER - half, CENTER - half, MEDIA_BUTTON_SIZE + 1, MEDIA_BUTTON_SIZE + 1 };
+  Crop mode = paintedArea({ drawBulb, drawThermometer, drawSpeaker });
+
+  bool ok = writeSprite(out, "PLAY", drawPlay, button) &&
+            writeSprite(out, "PAUSE", drawPause, button) &&
+            writeSprite(out, "REWIND", drawRewind, button) &&
+            writeSprite(out, "FORWARD", drawForward, button) &&
+            writeSprite(out, "BULB", drawBulb, mode) &&
+            writeSprite(out, "THERMOMETER", drawThermometer, mode) &&
+            writeSprite(out, "SPEAKER", drawSpeaker, mode);
+
+  if (out != stdout) fclose(out);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,196 @@
+// Converts a trace dump (the lines sent by the firmware's trace:dump command)
+// into Chrome trace JSON for chrome://tracing or https://ui.perfetto.dev
+//
+//   trace2chrome [dump.txt [trace.json]]
+//
+// Reads stdin / writes stdout when a path is missing. Lines without "trace:"
+// are skipped, so a raw TCP session log works as input. Each firmware task
+// becomes one thread track; spans nest per task.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "TraceFormat.h"
+
+static int base64Value(char c) {
+  if (c >= 'A' && c <= 'Z') return c - 'A';
+  if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+  if (c >= '0' && c <= '9') return c - '0' + 52;
+  if (c == '+') return 62;
+  if (c == '/') return 63;
+  return -1;
+}
+
+static std::vector<uint8_t> decodeBase64(const std::string& text) {
+  std::vector<uint8_t> bytes;
+  uint32_t chunk = 0;
+  int bits = 0;
+  for (char c : text) {
+    int value = base64Value(c);
+    if (value < 0) continue;  // '=' padding, stray whitespace
+    chunk = (chunk << 6) | value;
+    bits += 6;
+    if (bits >= 8) {
+      bits -= 8;
+      bytes.push_back((uint8_t)(chunk >> bits));
+    }
+  }
+  return bytes;
+}
+
+static std::string jsonEscape(const std::string& text) {
+  std::string escaped;
+  for (char c : text) {
+    if (c == '"' || c == '\\') {
+      escaped += '\\';
+      escaped += c;
+    } else if ((unsigned char)c < 0x20) {
+      char code[8];
+      snprintf(code, sizeof(code), "\\u%04x", c);
+      escaped += code;
+    } else {
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+
+int main(int argc, char** argv) {
+  std::ifstream inputFile;
+  std::ofstream outputFile;
+  if (argc > 1) {
+    inputFile.open(argv[1]);
+    if (!inputFile) {
+      fprintf(stderr, "trace2chrome: cannot open %s\n", argv[1]);
+      return 1;
+    }
+  }
+  if (argc > 2) {
+    outputFile.open(argv[2]);
+    if (!outputFile) {
+      fprintf(stderr, "trace2chrome: cannot create %s\n", argv[2]);
+      return 1;
+    }
+  }
+  std::istream& in = argc > 1 ? inputFile : std::cin;
+  std::ostream& out = argc > 2 ? outputFile : std::cout;
+
+  std::map<uint32_t, std::string> taskNames;
+  std::vector<TraceRecord> records;
+  std::string line;
+  bool begun = false;
+  bool ended = false;
+
+  while (std::getline(in, line)) {
+    size_t start = line.find("trace:");
+    if (start == std::string::npos) continue;
+    line = line.substr(start + 6);
+    while (!line.empty() && (line.back() == '\r' || line.back() == ' ')) line.pop_back();
+
+    if (line.compare(0, 6, "begin,") == 0) {
+      int version = 0;
+      const char* versionField = strstr(line.c_str(), "version=");
+      if (versionField) version = atoi(versionField + 8);
+      if (version != TRACE_FORMAT_VERSION) {
+        fprintf(stderr, "trace2chrome: dump is format version %d, expected %d\n", version, TRACE_FORMAT_VERSION);
+        return 1;
+      }
+      // A second dump in the same log replaces the first
+      records.clear();
+      taskNames.clear();
+      begun = true;
+      ended = false;
+    } else if (line.compare(0, 5, "task,") == 0) {
+      size_t comma = line.find(',', 5);
+      if (comma == std::string::npos) continue;
+      uint32_t handle = (uint32_t)strtoul(line.substr(5, comma - 5).c_str(), nullptr, 16);
+      taskNames[handle] = line.substr(comma + 1);
+    } else if (line.compare(0, 5, "data,") == 0) {
+      std::vector<uint8_t> bytes = decodeBase64(line.substr(5));
+      // Records are little-endian, like the host
+      for (size_t offset = 0; offset + sizeof(TraceRecord) <= bytes.size(); offset += sizeof(TraceRecord)) {
+        TraceRecord record;
+        memcpy(&record, &bytes[offset], sizeof(record));
+        records.push_back(record);
+      }
+    } else if (line == "end") {
+      ended = true;
+    }
+  }
+
+  if (!begun) {
+    fprintf(stderr, "trace2chrome: no trace:begin line in the input\n");
+    return 1;
+  }
+  if (!ended) {
+    fprintf(stderr, "trace2chrome: dump is incomplete (no trace:end), converting what arrived\n");
+  }
+
+  out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+  out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"QNOB\"}}";
+
+  // Name every task that recorded something
+  std::map<uint32_t, bool> seenTasks;
+  for (const TraceRecord& record : records) {
+    if (seenTasks[record.task]) continue;
+    seenTasks[record.task] = true;
+    std::string name;
+    auto known = taskNames.find(record.task);
+    if (known != taskNames.end()) {
+      name = known->second;
+    } else {
+      char fallback[24];
+      snprintf(fallback, sizeof(fallback), "task %08x", record.task);
+      name = fallback;
+    }
+    out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << record.task
+        << ",\"args\":{\"name\":\"" << jsonEscape(name) << "\"}}";
+  }
+
+  // Unwrap the 32-bit microsecond clock in ring order; records from the
+  // two cores may be slightly out of order, hence the signed delta
+  int64_t time = 0;
+  uint32_t previous = records.empty() ? 0 : records.front().timestamp;
+  char buffer[256];
+  for (const TraceRecord& record : records) {
+    time += (int32_t)(record.timestamp - previous);
+    previous = record.timestamp;
+    const char* name = traceEventName(record.event);
+
+    switch (record.type) {
+      case TRACE_BEGIN:
+        snprintf(buffer, sizeof(buffer),
+                 ",\n{\"name\":\"%s\",\"cat\":\"qnob\",\"ph\":\"B\",\"ts\":%lld,\"pid\":0,\"tid\":%u,\"args\":{\"core\":%u}}",
+                 name, (long long)time, record.task, record.core);
+        break;
+      case TRACE_END:
+        snprintf(buffer, sizeof(buffer),
+                 ",\n{\"name\":\"%s\",\"cat\":\"qnob\",\"ph\":\"E\",\"ts\":%lld,\"pid\":0,\"tid\":%u,\"args\":{\"result\":%u}}",
+                 name, (long long)time, record.task, record.arg);
+        break;
+      case TRACE_INSTANT:
+        snprintf(buffer, sizeof(buffer),
+                 ",\n{\"name\":\"%s\",\"cat\":\"qnob\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%lld,\"pid\":0,\"tid\":%u,\"args\":{\"value\":%u}}",
+                 name, (long long)time, record.task, record.arg);
+        break;
+      case TRACE_COUNTER:
+        snprintf(buffer, sizeof(buffer),
+                 ",\n{\"name\":\"%s\",\"ph\":\"C\",\"ts\":%lld,\"pid\":0,\"args\":{\"value\":%u}}",
+                 name, (long long)time, record.arg);
+        break;
+      default:
+        continue;
+    }
+    out << buffer;
+  }
+
+  out << "\n]}\n";
+  fprintf(stderr, "trace2chrome: %zu records, %zu tasks\n", records.size(), seenTasks.size());
+  return 0;
+}
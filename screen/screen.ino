@@ -2,16 +2,10 @@
 #include "LoopHandler.h"
 
 void setup() {
-  // Check if we're waking from deep sleep
-  esp_sleep_wakeup_cause_t wakeup_reason = esp_sleep_get_wakeup_cause();
-  
-  // If waking from deep sleep, perform a full restart
-  if (wakeup_reason == ESP_SLEEP_WAKEUP_EXT1) {
-    Serial.begin(115200);
-    Serial.println("Waking from deep sleep - performing system reset");
-    delay(100);  // Small delay to ensure Serial output completes
-    esp_restart();  // Full system restart 
-    return;  // Never reached
+  // Waking from deep sleep resumes from RTC state instead of restarting -
+  // SetupHandler falls back to a full boot if that state isn't valid
+  if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_EXT1) {
+    SleepHandler::releaseWakeupPins();
   }
   
   // Create and use SetupHandler for initialization
@@ -30,13 +24,6 @@ void loop() {
   // Create static LoopHandler instance to manage the main loop
   static LoopHandler loopHandler;
   
-  // If a sleep handler is initialized, register the LoopHandler with it
-  static bool sleepHandlerRegistered = false;
-  if (!sleepHandlerRegistered && sleepHandler != nullptr) {
-    sleepHandler->setLoopHandler(&loopHandler);
-    sleepHandlerRegistered = true;
-  }
-  
   // Handle the main loop
   loopHandler.handle();
 }
\ No newline at end of file